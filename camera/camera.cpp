@@ -1,27 +1,317 @@
 #include "camera.h"
+
+#include <stdio.h>
+
+#ifdef HAVE_CUDA
 #include "cudaMappedMemory.h"
 #include "cudaYUV.h"
 #include "cudaRGB.h"
+#include "cudaNormalize.h"
 
 
-bool camera::ConvertBAYER_GR8toRGBA( void* input, void** output )
-{	
-	if( !input || !output )
-		return false;
+// Wraps the CUDA kernels, registered with the conversion backends at load time
+class cudaConvertBackend : public mtsai::image::ConvertBackend
+{
+public:
+	cudaConvertBackend()					{ mtsai::image::RegisterConvertBackend(this); }
 
-	if( !mRGBA )
+	const char* Name() const				{ return "cuda"; }
+	mtsai::image::ConvertBackendType Type() const	{ return mtsai::image::CONVERT_BACKEND_CUDA; }
+
+	bool Available() const
+	{
+		int devices = 0;
+		return cudaGetDeviceCount(&devices) == cudaSuccess && devices > 0;
+	}
+
+	void* Alloc( size_t size )
+	{
+		void* ptr = NULL;
+
+		if( CUDA_FAILED(cudaMalloc(&ptr, size)) )
+			return NULL;
+
+		return ptr;
+	}
+
+	void Free( void* ptr )
+	{
+		CUDA(cudaFree(ptr));
+	}
+
+	bool NV12toRGBA( const uint8_t* src, void* dst, mtsai::image::PixelType type, size_t width, size_t height,
+					 const mtsai::image::ColourSpace& colour )
+	{
+		if( type == mtsai::image::PIXEL_TYPE_RGBA8 )
+			return CUDA_SUCCESS(cudaNV12ToRGBA8((uint8_t*)src, (uchar4*)dst, width, height, colour));
+
+		return CUDA_SUCCESS(cudaNV12ToRGBAf((uint8_t*)src, (float4*)dst, width, height, colour));
+	}
+
+	bool UYVYtoRGBA( const uint8_t* src, void* dst, mtsai::image::PixelType type, size_t width, size_t height,
+					 const mtsai::image::ColourSpace& colour )
+	{
+		if( type == mtsai::image::PIXEL_TYPE_RGBA8 )
+			return CUDA_SUCCESS(cudaYUVToRGBA8((uint8_t*)src, (uchar4*)dst, width, height, colour));
+
+		return CUDA_SUCCESS(cudaYUVToRGBAf((uint8_t*)src, (float4*)dst, width, height, colour));
+	}
+
+	bool RGBtoRGBA( const uint8_t* src, void* dst, mtsai::image::PixelType type, size_t width, size_t height )
+	{
+		if( type == mtsai::image::PIXEL_TYPE_RGBA8 )
+			return CUDA_SUCCESS(cudaRGBToRGBA8((uint8_t*)src, (uchar4*)dst, width, height));
+
+		return CUDA_SUCCESS(cudaRGBToRGBAf((uint8_t*)src, (float4*)dst, width, height));
+	}
+
+	bool BayerGR8toRGBA( const uint8_t* src, void* dst, mtsai::image::PixelType type, size_t width, size_t height )
+	{
+		if( type == mtsai::image::PIXEL_TYPE_RGBA8 )
+			return CUDA_SUCCESS(cudaBAYER_GR8toRGBA8((uint8_t*)src, (uchar4*)dst, width, height));
+
+		return CUDA_SUCCESS(cudaBAYER_GR8toRGBA((uint8_t*)src, (float4*)dst, width, height));
+	}
+
+	bool RGBA8toRGBAf( const uint8_t* src, float* dst, size_t width, size_t height )
+	{
+		return CUDA_SUCCESS(cudaNormalizeRGBA((uchar4*)src, make_float2(0.0f, 255.0f),
+											  (float4*)dst, make_float2(0.0f, 255.0f), width, height));
+	}
+
+	// The NV12 and UYVY kernels take a source pitch, NV12 with the chroma
+	// plane right below the luma. Other layouts go through the packed calls.
+	bool ConvertFrame( const mtsai::image::FrameDescriptor& frame, const void* src, void* dst, mtsai::image::PixelType type )
 	{
-		if( CUDA_FAILED(cudaMalloc(&mRGBA, mWidth * mHeight * sizeof(float4))) )
+		uint8_t* data = (uint8_t*)src + frame.planes[0].offset;
+		const size_t stride = frame.planes[0].stride;
+		const bool rgba8 = (type == mtsai::image::PIXEL_TYPE_RGBA8);
+
+		if( frame.fourcc == mtsai::image::FOURCC_NV12 && frame.planeCount == 2 &&
+			frame.planes[1].stride == stride && frame.planes[1].offset == frame.planes[0].offset + stride * frame.height )
 		{
-			printf(LOG_CUDA "gvCamera -- failed to allocate memory for %ux%u RGBA texture\n", mWidth, mHeight);
-			return false;
+			if( rgba8 )
+				return CUDA_SUCCESS(cudaNV12ToRGBA8(data, stride, (uchar4*)dst, frame.width * sizeof(uchar4), frame.width, frame.height, frame.colour));
+
+			return CUDA_SUCCESS(cudaNV12ToRGBAf(data, stride, (float4*)dst, frame.width * sizeof(float4), frame.width, frame.height, frame.colour));
 		}
+
+		// the UYVY kernel counts its pitch in 16 bit words
+		if( frame.fourcc == mtsai::image::FOURCC_UYVY && (stride & 1) == 0 )
+		{
+			if( rgba8 )
+				return CUDA_SUCCESS(cudaYUVToRGBA8(data, stride / 2, (uchar4*)dst, frame.width * sizeof(uchar4), frame.width, frame.height, frame.colour));
+
+			return CUDA_SUCCESS(cudaYUVToRGBAf(data, stride / 2, (float4*)dst, frame.width * sizeof(float4), frame.width, frame.height, frame.colour));
+		}
+
+		return mtsai::image::ConvertBackend::ConvertFrame(frame, src, dst, type);
 	}
+};
+
+static cudaConvertBackend gCudaConvertBackend;
+#endif
+
+
+camera::camera(int height, int width)
+{
+	mWidth  = width;
+	mHeight = height;
+	mDepth  = 0;
+	mSize   = 0;
+	mRGBA   = 0;
+	mRGBAf  = 0;
+	mRGBASize  = 0;
+	mRGBAfSize = 0;
+
+	mPixelType = mtsai::image::PIXEL_TYPE_RGBA8;
+
+	mDescriptor.sourceId = mtsai::image::NewFrameSourceId();
+
+	mBackend = mtsai::image::GetConvertBackend();
+	printf("camera -- using %s conversion backend\n", mBackend->Name());
+}
+
+camera::~camera()
+{
+	freeRGBA();
+}
+
+
+void camera::freeRGBA()
+{
+	if( mRGBA != NULL )
+	{
+		mBackend->Free(mRGBA);
+		mRGBA = NULL;
+	}
+
+	if( mRGBAf != NULL )
+	{
+		mBackend->Free(mRGBAf);
+		mRGBAf = NULL;
+	}
+
+	mRGBASize  = 0;
+	mRGBAfSize = 0;
+}
+
+
+bool camera::SetConvertBackend( mtsai::image::ConvertBackendType type )
+{
+	mtsai::image::ConvertBackend* backend = mtsai::image::GetConvertBackend(type);
+
+	if( backend == mBackend )
+		return true;
+
+	// the output buffers belong to the previous backend
+	freeRGBA();
+
+	mBackend = backend;
+	printf("camera -- using %s conversion backend\n", mBackend->Name());
+	return (type == mtsai::image::CONVERT_BACKEND_AUTO) || (mBackend->Type() == type);
+}
+
+
+bool camera::SetPixelType( mtsai::image::PixelType type )
+{
+	if( type == mPixelType )
+		return true;
+
+	// the output buffer is sized for the previous type
+	if( mRGBA != NULL )
+	{
+		mBackend->Free(mRGBA);
+		mRGBA = NULL;
+		mRGBASize = 0;
+	}
+
+	mPixelType = type;
+	return true;
+}
+
+
+void camera::SetColourSpace( const mtsai::image::ColourSpace& colour )
+{
+	if( colour.matrix != mColourSpace.matrix || colour.range != mColourSpace.range )
+		printf("camera -- YUV colour space %s\n", mtsai::image::ColourSpaceName(colour));
+
+	mColourSpace = colour;
+}
+
+
+bool camera::allocRGBA()
+{
+	const size_t size = mWidth * mHeight * mtsai::image::PixelSize(mPixelType);
+
+	if( mRGBA != NULL && mRGBASize == size )
+		return true;
+
+	// sized for the previous resolution, a bigger frame would write past it
+	if( mRGBA != NULL )
+	{
+		mBackend->Free(mRGBA);
+		mRGBA = NULL;
+		mRGBASize = 0;
+	}
+
+	mRGBA = mBackend->Alloc(size);
+
+	if( !mRGBA )
+	{
+		printf("camera -- failed to allocate memory for %ux%u RGBA texture (%s)\n", mWidth, mHeight, mBackend->Name());
+		return false;
+	}
+
+	mRGBASize = size;
+	return true;
+}
+
+
+bool camera::allocRGBAf()
+{
+	const size_t size = mWidth * mHeight * sizeof(float) * 4;
+
+	if( mRGBAf != NULL && mRGBAfSize == size )
+		return true;
+
+	if( mRGBAf != NULL )
+	{
+		mBackend->Free(mRGBAf);
+		mRGBAf = NULL;
+		mRGBAfSize = 0;
+	}
+
+	mRGBAf = mBackend->Alloc(size);
+
+	if( !mRGBAf )
+	{
+		printf("camera -- failed to allocate memory for %ux%u float RGBA (%s)\n", mWidth, mHeight, mBackend->Name());
+		return false;
+	}
+
+	mRGBAfSize = size;
+	return true;
+}
+
+
+bool camera::CaptureFrame( mtsai::image::FrameDescriptor* frame, unsigned long timeout )
+{
+	if( !frame )
+		return false;
+
+	void* cpu  = NULL;
+	void* cuda = NULL;
+
+	if( !Capture(&cpu, &cuda, timeout) )
+		return false;
+
+	*frame = mDescriptor;
+	frame->cpu  = cpu;
+	frame->cuda = cuda;
+	return true;
+}
+
+
+bool camera::ConvertFrame( const mtsai::image::FrameDescriptor& frame, void** output )
+{
+	if( !output )
+		return false;
+
+	// the CUDA backend reads device memory, the CPU one host memory
+	const void* input = (mBackend->Type() == mtsai::image::CONVERT_BACKEND_CUDA) ? frame.cuda : frame.cpu;
+
+	if( !input || frame.width != mWidth || frame.height != mHeight )
+		return false;
+
+	if( !allocRGBA() )
+		return false;
+
+	if( !mBackend->ConvertFrame(frame, input, mRGBA, mPixelType) )
+	{
+		char fourcc[5];
+		mtsai::image::FourccToString(frame.fourcc, fourcc);
+		printf("camera -- conversion %s %ux%u failed (%s)\n", fourcc, frame.width, frame.height, mBackend->Name());
+		return false;
+	}
+
+	*output = mRGBA;
+	return true;
+}
+
+
+bool camera::ConvertBAYER_GR8toRGBA( void* input, void** output )
+{	
+	if( !input || !output )
+		return false;
+
+	if( !allocRGBA() )
+		return false;
 	
-	// USB webcam is RGB
-	if( CUDA_FAILED(cudaBAYER_GR8toRGBA((uint8_t*)input, (float4*)mRGBA, mWidth, mHeight)) )
+	// GigE cameras are Bayer GR8
+	if( !mBackend->BayerGR8toRGBA((uint8_t*)input, mRGBA, mPixelType, mWidth, mHeight) )
 	{
-		printf(LOG_CUDA "gvCamera -- conversion cudaRGBToRGBAf failed\n");
+		printf("camera -- conversion BAYER_GR8toRGBA failed (%s)\n", mBackend->Name());
 		return false;
 	}
 
@@ -29,29 +319,25 @@ bool camera::ConvertBAYER_GR8toRGBA( void* input, void** output )
 	return true;
 }
 
+// float4 RGBA whatever GetPixelType() is, as it always returned
 bool camera::ConvertYUVtoRGBf( void* input, void** output )
 {
+	if( mPixelType == mtsai::image::PIXEL_TYPE_RGBAF )
+		return ConvertYUVtoRGBA(input, output);
+
 	if( !input || !output )
 		return false;
 
-	if( !mRGBA )
+	if( !allocRGBAf() )
+		return false;
+
+	if( !mBackend->UYVYtoRGBAf((uint8_t*)input, (float*)mRGBAf, mWidth, mHeight, mColourSpace) )
 	{
-		if( CUDA_FAILED(cudaMalloc(&mRGBA, mWidth * mHeight * sizeof(float4))) )
-		{
-			printf(LOG_CUDA "cudaMalloc -- failed to allocate memory for %ux%u RGBA texture\n", mWidth, mHeight);
-			return false;
-		}
+		printf("camera -- conversion UYVYtoRGBf failed %ux%u (%s)\n", mWidth, mHeight, mBackend->Name());
+		return false;
 	}
 
-	// nvcamera is YUV
-	if( CUDA_FAILED(cudaYUVToRGBAf((uint8_t*)input, (float4*)mRGBA, mWidth, mHeight)) )
-		{
-			printf(LOG_CUDA "cudaYUVToRGBAf -- failed convert %ux%u RGBA texture\n", mWidth, mHeight);
-			return false;
-		}
-
-	*output = mRGBA;
-
+	*output = mRGBAf;
 	return true;
 }
 
@@ -61,18 +347,15 @@ bool camera::ConvertNV12toRGBA( void* input, void** output )
 	if( !input || !output )
 		return false;
 
-	if( !mRGBA )
-	{
-		if( CUDA_FAILED(cudaMalloc(&mRGBA, mWidth * mHeight * sizeof(float4))) )
-		{
-			printf(LOG_CUDA "gstCamera -- failed to allocate memory for %ux%u RGBA texture\n", mWidth, mHeight);
-			return false;
-		}
-	}
+	if( !allocRGBA() )
+		return false;
 	
 	// nvcamera is NV12
-	if( CUDA_FAILED(cudaNV12ToRGBAf((uint8_t*)input, (float4*)mRGBA, mWidth, mHeight)) )
+	if( !mBackend->NV12toRGBA((uint8_t*)input, mRGBA, mPixelType, mWidth, mHeight, mColourSpace) )
+	{
+		printf("camera -- conversion NV12toRGBA failed (%s)\n", mBackend->Name());
 		return false;
+	}
 	
 	*output = mRGBA;
 	return true;
@@ -83,18 +366,15 @@ bool camera::ConvertYUVtoRGBA( void* input, void** output )
 	if( !input || !output )
 		return false;
 
-	if( !mRGBA )
-	{
-		if( CUDA_FAILED(cudaMalloc(&mRGBA, mWidth * mHeight * sizeof(float4))) )
-		{
-			printf(LOG_CUDA "gstCamera -- failed to allocate memory for %ux%u RGBA texture\n", mWidth, mHeight);
-			return false;
-		}
-	}
+	if( !allocRGBA() )
+		return false;
 	
-	// nvcamera is YUV
-	if( CUDA_FAILED(cudaYUVToRGBAf((uint8_t*)input, (float4*)mRGBA, mWidth, mHeight)) )
+	// RTP is YCbCr-4:2:2
+	if( !mBackend->UYVYtoRGBA((uint8_t*)input, mRGBA, mPixelType, mWidth, mHeight, mColourSpace) )
+	{
+		printf("camera -- conversion UYVYtoRGBA failed %ux%u (%s)\n", mWidth, mHeight, mBackend->Name());
 		return false;
+	}
 	
 	*output = mRGBA;
 	return true;
@@ -105,19 +385,13 @@ bool camera::ConvertRGBtoRGBA( void* input, void** output )
 	if( !input || !output )
 		return false;
 
-	if( !mRGBA )
-	{
-		if( CUDA_FAILED(cudaMalloc(&mRGBA, mWidth * mHeight * sizeof(float4))) )
-		{
-			printf(LOG_CUDA "camera -- failed to allocate memory for %ux%u RGBA texture\n", mWidth, mHeight);
-			return false;
-		}
-	}
+	if( !allocRGBA() )
+		return false;
 	
 	// USB webcam is RGB
-	if( CUDA_FAILED(cudaRGBToRGBAf((uint8_t*)input, (float4*)mRGBA, mWidth, mHeight)) )
+	if( !mBackend->RGBtoRGBA((uint8_t*)input, mRGBA, mPixelType, mWidth, mHeight) )
 	{
-		printf(LOG_CUDA "camera -- conversion cudaRGBToRGBAf failed (%dx%d)\n", mWidth, mHeight);
+		printf("camera -- conversion RGBtoRGBA failed (%ux%u)\n", mWidth, mHeight);
 		return false;
 	}
 
@@ -125,3 +399,28 @@ bool camera::ConvertRGBtoRGBA( void* input, void** output )
 	return true;
 }
 
+
+bool camera::ConvertRGBAtoRGBAf( void* input, void** output )
+{
+	if( !input || !output )
+		return false;
+
+	// already float, nothing to widen
+	if( mPixelType == mtsai::image::PIXEL_TYPE_RGBAF )
+	{
+		*output = input;
+		return true;
+	}
+
+	if( !allocRGBAf() )
+		return false;
+
+	if( !mBackend->RGBA8toRGBAf((uint8_t*)input, (float*)mRGBAf, mWidth, mHeight) )
+	{
+		printf("camera -- conversion RGBA8toRGBAf failed (%s)\n", mBackend->Name());
+		return false;
+	}
+
+	*output = mRGBAf;
+	return true;
+}
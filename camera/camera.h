@@ -7,11 +7,13 @@
 #include <climits>
 #include <stdint.h>
 
+#include "image/convert.h"
+
 class camera
 {
 public:
-	camera(int height, int width) { mWidth = width; mHeight = height; mRGBA = 0; };
-	~camera() {};
+	camera(int height, int width);
+	virtual ~camera();
 
 	virtual bool Open() = 0;
 
@@ -19,18 +21,46 @@ public:
 	
 	// Capture frame
 	virtual bool Capture( void** cpu, void** cuda, unsigned long timeout=ULONG_MAX ) = 0;
+
+	// Capture() with the format, plane layout and timestamps of the frame,
+	// frame->cpu / frame->cuda hold the two pointers
+	bool CaptureFrame( mtsai::image::FrameDescriptor* frame, unsigned long timeout=ULONG_MAX );
+
+	// Descriptor of the frame returned by the last Capture()
+	inline const mtsai::image::FrameDescriptor& GetFrameDescriptor() const { return mDescriptor; }
 	
 	inline uint32_t GetWidth() const	  { return mWidth; }
 	inline uint32_t GetHeight() const	  { return mHeight; }
 	inline uint32_t GetPixelDepth() const { return mDepth; }
 	inline uint32_t GetSize() const		  { return mSize; }
 	
-	// Takes in captured YUV-NV12 CUDA image, converts to float4 RGBA (with pixel intensity 0-255)
+	// Conversion backend, input and output pointers of Convert*() belong to it
+	// (CUDA device memory for the CUDA backend, host memory for the CPU one)
+	bool SetConvertBackend( mtsai::image::ConvertBackendType type );
+	inline mtsai::image::ConvertBackend* GetConvertBackend() const { return mBackend; }
+
+	// Output pixel type of Convert*(), uchar4 RGBA by default
+	bool SetPixelType( mtsai::image::PixelType type );
+	inline mtsai::image::PixelType GetPixelType() const { return mPixelType; }
+
+	// Colour matrix and range the YUV conversions decode with, BT.601 limited
+	// range until the source reports its colorimetry
+	void SetColourSpace( const mtsai::image::ColourSpace& colour );
+	inline const mtsai::image::ColourSpace& GetColourSpace() const { return mColourSpace; }
+
+	// Takes in captured image, converts to RGBA of GetPixelType() (pixel intensity 0-255)
 	bool ConvertBAYER_GR8toRGBA( void* input, void** output );
 	bool ConvertNV12toRGBA( void* input, void** output );
 	bool ConvertYUVtoRGBA ( void* input, void** output );
 	bool ConvertRGBtoRGBA ( void* input, void** output );
+	// YCbCr-4:2:2 to float4 RGBA (0-255) regardless of GetPixelType()
 	bool ConvertYUVtoRGBf ( void* input, void** output );
+
+	// Any captured frame to RGBA of GetPixelType(), reads strided rows in place
+	bool ConvertFrame( const mtsai::image::FrameDescriptor& frame, void** output );
+
+	// Inference boundary, widens the 8 bit RGBA output to float4 RGBA (0-255)
+	bool ConvertRGBAtoRGBAf( void* input, void** output );
 	
 protected:
 	uint32_t mWidth;
@@ -39,6 +69,24 @@ protected:
 	uint32_t mSize;
 	
 	void* mRGBA;
+	void* mRGBAf;
+
+	// filled by every Capture(), sourceId is set once per instance
+	mtsai::image::FrameDescriptor mDescriptor;
+
+private:
+	// (re)allocated when mWidth x mHeight or the pixel type no longer match
+	bool allocRGBA();
+	bool allocRGBAf();
+	void freeRGBA();
+
+	// bytes mRGBA / mRGBAf were allocated with
+	size_t mRGBASize;
+	size_t mRGBAfSize;
+
+	mtsai::image::ConvertBackend* mBackend;
+	mtsai::image::PixelType mPixelType;
+	mtsai::image::ColourSpace mColourSpace;
 };
 
 #endif
@@ -11,7 +11,6 @@
 #include <signal.h>
 #include <unistd.h>
 
-#include "cudaNormalize.h"
 
 
 bool signal_recieved = false;
@@ -65,8 +64,8 @@ int main( int argc, char** argv )
 	if( !display )
 		printf("\ngst-camera:  failed to create openGL display\n");
 
-	const size_t texSz = camera->GetWidth() * camera->GetHeight() * sizeof(float4);
-	float4* texIn = (float4*)malloc(texSz);
+	const size_t texSz = camera->GetWidth() * camera->GetHeight() * sizeof(uchar4);
+	uchar4* texIn = (uchar4*)malloc(texSz);
 
 	/*if( texIn != NULL )
 		memset(texIn, 0, texSz);*/
@@ -74,9 +73,9 @@ int main( int argc, char** argv )
 	if( texIn != NULL )
 		for( uint32_t y=0; y < camera->GetHeight(); y++ )
 			for( uint32_t x=0; x < camera->GetWidth(); x++ )
-				texIn[y*camera->GetWidth()+x] = make_float4(0.0f, 1.0f, 1.0f, 1.0f);
+				texIn[y*camera->GetWidth()+x] = make_uchar4(0, 255, 255, 255);
 
-	glTexture* texture = glTexture::Create(camera->GetWidth(), camera->GetHeight(), GL_RGBA32F_ARB/*GL_RGBA8*/, texIn);
+	glTexture* texture = glTexture::Create(camera->GetWidth(), camera->GetHeight(), GL_RGBA8, texIn);
 
 	if( !texture )
 		printf("gst-camera:  failed to create openGL texture\n");
@@ -110,10 +109,7 @@ int main( int argc, char** argv )
 		if( !camera->ConvertNV12toRGBA(imgCUDA, &imgRGBA) )
 			printf("gst-camera:  failed to convert from NV12 to RGBA\n");
 
-		// rescale image pixel intensities
-		CUDA(cudaNormalizeRGBA((float4*)imgRGBA, make_float2(0.0f, 255.0f), 
-						   (float4*)imgRGBA, make_float2(0.0f, 1.0f), 
- 						   camera->GetWidth(), camera->GetHeight()));
+		// uchar4 RGBA maps straight onto the GL_RGBA8 texture, no rescale needed
 
 		// update display
 		if( display != NULL )
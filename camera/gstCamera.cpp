@@ -5,11 +5,15 @@
 #include "debug.h"
 #include "gstCamera.h"
 #include "gstUtility.h"
+#include "gst_runtime.h"
+#include "utils/mt_log.h"
 
 #include <gst/gst.h>
 #include <gst/app/gstappsink.h>
+#include <gst/video/video.h>
 
 #include <sstream> 
+#include <thread>
 #include <unistd.h>
 #include <string.h>
 
@@ -27,6 +31,12 @@ bool gstCamera::mOnboardCamera = false;
 #define DEPTH 12
 #define SIZE HEIGHT * WIDET * DEPTH / 8
 
+// wait for a pipeline state change, milliseconds
+#define STATE_TIMEOUT 5000
+
+// per frame lines, capped so a TRACE level does not flood the output
+static mtsai::utils::LogCategory logFrames("gstcamera", 30);
+
 // constructor
 gstCamera::gstCamera(int height, int width) :
 camera(height, width)
@@ -45,19 +55,34 @@ camera(height, width)
 	
 	mLatestRingbuffer = 0;
 	mLatestRetrieved  = false;
+	mSequence         = 0;
+	mStateWait        = false;
 	
-	for( uint32_t n=0; n < NUM_RINGBUFFERS; n++ )
-	{
-		mRingbufferCPU[n] = NULL;
-		mRingbufferGPU[n] = NULL;
-	}
+	mRingPool = new mtsai::image::FramePool(mtsai::image::FRAME_MEMORY_MAPPED, NUM_RINGBUFFERS);
 }
 
 
 // destructor	
 gstCamera::~gstCamera()
 {
+	// stop the streaming thread before the ringbuffers it writes go away
+	if( mPipeline != NULL )
+	{
+		Close();
+		
+		if( mAppSink != NULL )
+			gst_object_unref(mAppSink);
+		
+		if( mBus != NULL )
+			gst_object_unref(mBus);
+		
+		gst_object_unref(mPipeline);
+	}
 	
+	delete mRingPool;
+	delete mRingMutex;
+	delete mWaitMutex;
+	delete mWaitEvent;
 }
 
 
@@ -106,18 +131,34 @@ bool gstCamera::Capture( void** cpu, void** cuda, unsigned long timeout )
 	const uint32_t latest = mLatestRingbuffer;
 	const bool retrieved = mLatestRetrieved;
 	mLatestRetrieved = true;
-	mRingMutex->unlock();
+	mRingPool->Recycle();	// the previous frame is released by this call
 	
 	// skip if it was already retrieved
 	if( retrieved )
+	{
+		mRingMutex->unlock();
 		return false;
+	}
 	
 	if( cpu != NULL )
-		*cpu = mRingbufferCPU[latest];
+		*cpu = mRingPool->CPU(latest);
 	
 	if( cuda != NULL )
-		*cuda = mRingbufferGPU[latest];
-	
+		*cuda = mRingPool->CUDA(latest);
+	
+	// under the lock, a resolution change swaps the ringbuffers
+	const uint32_t sourceId = mDescriptor.sourceId;
+	mDescriptor          = mRingFrames[latest];
+	mDescriptor.sourceId = sourceId;
+	mDescriptor.cpu      = mRingPool->CPU(latest);
+	mDescriptor.cuda     = mRingPool->CUDA(latest);
+	
+	// the size the consumer sees changes with the frame it gets
+	mWidth  = mDescriptor.width;
+	mHeight = mDescriptor.height;
+	mSize   = mDescriptor.size;
+	mDepth  = (mSize * 8) / (mWidth * mHeight);
+	mRingMutex->unlock();
 	return true;
 }
 
@@ -168,61 +209,62 @@ void gstCamera::checkBuffer()
 		release_return;
 	}
 	
-	// retrieve caps
+	// caps are parsed once per negotiation, later samples compare the pointer
 	GstCaps* gstCaps = gst_sample_get_caps(gstSample);
+	const mtsai::gst::CapsUpdate update = mCaps.Update(gstCaps);
 	
-	if( !gstCaps )
+	if( update == mtsai::gst::CAPS_INVALID )
 	{
-		printf(LOG_GSTREAMER "gstreamer camera -- gst_buffer had NULL caps...\n");
+		printf(LOG_GSTREAMER "gstreamer camera -- sample caps missing or without width/height...\n");
+		gst_buffer_unmap(gstBuffer, &map);
 		release_return;
 	}
 	
-	GstStructure* gstCapsStruct = gst_caps_get_structure(gstCaps, 0);
-	
-	if( !gstCapsStruct )
-	{
-		printf(LOG_GSTREAMER "gstreamer camera -- gst_caps had NULL structure...\n");
-		release_return;
-	}
+	mtsai::image::FrameDescriptor frame = mCaps.Layout();
 	
-	// get width & height of the buffer
-	int width  = 0;
-	int height = 0;
+	// mWidth / mHeight / mDepth are the consumer's, published by Capture()
+	// with the frame they belong to
+	const uint32_t depth = (gstSize * 8) / (frame.width * frame.height);
 	
-	if( !gst_structure_get_int(gstCapsStruct, "width", &width) ||
-		!gst_structure_get_int(gstCapsStruct, "height", &height) )
+	if( update == mtsai::gst::CAPS_CHANGED )
 	{
-		printf(LOG_GSTREAMER "gstreamer camera -- gst_caps missing width/height...\n");
-		release_return;
+		// decode YUV with the colorimetry the source negotiated
+		const char* colorimetry = gst_structure_get_string(gst_caps_get_structure(gstCaps, 0), "colorimetry");
+		mtsai::image::ColourSpace colour = GetColourSpace();
+
+		if( colorimetry != NULL && mtsai::image::ParseColorimetry(colorimetry, &colour) )
+			SetColourSpace(colour);
+		
+		debug_print(LOG_GSTREAMER "gstreamer camera -- caps %ux%u, %u bpp, %u bytes\n", frame.width, frame.height, depth, gstSize);
 	}
 	
-	if( width < 1 || height < 1 )
-		release_return;
-	
-	mWidth  = width;
-	mHeight = height;
-	mDepth  = (gstSize * 8) / (width * height);
-	mSize   = gstSize;
-	
-	debug_print(LOG_GSTREAMER "gstreamer camera recieved %ix%i frame (%u bytes, %u bpp)\n", width, height, gstSize, mDepth);
+	// upstream may pad rows or move the chroma plane per buffer
+	mtsai::gst::ApplyVideoMeta(gstBuffer, &frame);
+
+	frame.size        = gstSize;
+	frame.colour      = GetColourSpace();
+	frame.pts         = GST_BUFFER_PTS_IS_VALID(gstBuffer) ? GST_BUFFER_PTS(gstBuffer) : 0;
+	frame.captureTime = mtsai::image::FrameClockNow();
+	frame.sequence    = mSequence++;
+
+	MT_LOG_TRACE(logFrames, "recieved %ux%u frame (%u bytes, %u bpp, stride %zu)", frame.width, frame.height, gstSize, depth, frame.planes[0].stride);
 	
-	// make sure ringbuffer is allocated
-	if( !mRingbufferCPU[0] )
+	// sized when the caps change, a new resolution gets fresh ringbuffers
+	// instead of overflowing the ones sized for the old frame
+	if( update == mtsai::gst::CAPS_CHANGED || gstSize > mRingPool->Capacity() )
 	{
-		for( uint32_t n=0; n < NUM_RINGBUFFERS; n++ )
+		if( !reserveRingbuffers(gstSize > mCaps.Layout().size ? gstSize : mCaps.Layout().size) )
 		{
-			if( !cudaAllocMapped(&mRingbufferCPU[n], &mRingbufferGPU[n], gstSize) )
-				printf(LOG_CUDA "gstreamer camera -- failed to allocate ringbuffer %u  (size=%u)\n", n, gstSize);
+			gst_buffer_unmap(gstBuffer, &map);
+			release_return;
 		}
-		
-		debug_print(LOG_CUDA "gstreamer camera -- allocated %u ringbuffers, %u bytes each\n", NUM_RINGBUFFERS, gstSize);
 	}
 	
 	// copy to next ringbuffer
 	const uint32_t nextRingbuffer = (mLatestRingbuffer + 1) % NUM_RINGBUFFERS;		
 	
 	//printf(LOG_GSTREAMER "gstreamer camera -- using ringbuffer #%u for next frame\n", nextRingbuffer);
-	memcpy(mRingbufferCPU[nextRingbuffer], gstData, gstSize);
+	memcpy(mRingPool->CPU(nextRingbuffer), gstData, gstSize);
 	gst_buffer_unmap(gstBuffer, &map); 
 	//gst_buffer_unref(gstBuffer);
 	gst_sample_unref(gstSample);
@@ -230,6 +272,7 @@ void gstCamera::checkBuffer()
 	
 	// update and signal sleeping threads
 	mRingMutex->lock();
+	mRingFrames[nextRingbuffer] = frame;
 	mLatestRingbuffer = nextRingbuffer;
 	mLatestRetrieved  = false;
 	mRingMutex->unlock();
@@ -238,6 +281,35 @@ void gstCamera::checkBuffer()
 
 
 
+// reserveRingbuffers
+bool gstCamera::reserveRingbuffers( size_t size )
+{
+	// the consumer may still read the last frame, old buffers wait for its next Capture()
+	mRingMutex->lock();
+	
+	const size_t capacity = mRingPool->Capacity();
+	const bool   reserved = mRingPool->Reserve(size);
+	
+	// frames in moved ringbuffers are not handed out anymore
+	if( mRingPool->Capacity() != capacity )
+		mLatestRetrieved = true;
+	
+	mRingMutex->unlock();
+	
+	if( !reserved )
+	{
+		printf(LOG_CUDA "gstreamer camera -- failed to allocate %u ringbuffers  (size=%zu)\n", NUM_RINGBUFFERS, size);
+		return false;
+	}
+	
+	if( mRingPool->Capacity() != capacity )
+		debug_print(LOG_CUDA "gstreamer camera -- allocated %u ringbuffers, %zu bytes each\n", NUM_RINGBUFFERS, mRingPool->Capacity());
+	
+	return true;
+}
+
+
+
 // buildLaunchStr
 bool gstCamera::buildLaunchStr(std::string pipeline)
 {
@@ -290,8 +362,6 @@ gstCamera* gstCamera::Create(std::string pipeline, int height, int width)
 
 bool gstCamera::init(std::string pipestr)
 {
-	GError* err = NULL;
-
 	// build pipeline string
 	if( !buildLaunchStr(pipestr) )
 	{
@@ -299,14 +369,14 @@ bool gstCamera::init(std::string pipestr)
 		return false;
 	}
 
-	// launch pipeline
-	mPipeline = gst_parse_launch(mLaunchStr.c_str(), &err);
+	// launch pipeline, from the cached template of this launch string
+	std::string error;
+	mPipeline = mtsai::gst::LaunchTemplateCache::Instance().Instantiate(mLaunchStr, mtsai::gst::LaunchValues(), &error);
 
-	if( err != NULL )
+	if( !mPipeline )
 	{
 		printf(LOG_GSTREAMER "gstreamer decoder failed to create pipeline\n");
-		printf(LOG_GSTREAMER "   (%s)\n", err->message);
-		g_error_free(err);
+		printf(LOG_GSTREAMER "   (%s)\n", error.c_str());
 		return false;
 	}
 
@@ -355,42 +425,89 @@ bool gstCamera::init(std::string pipestr)
 	return true;
 }
 
+// print the bus messages read while waiting on a state change
+static void printStateMsg( GstMessage* msg, void* user_data )
+{
+	gst_message_print(NULL, msg, user_data);
+}
+
+
 // Open
 bool gstCamera::Open()
+{
+	return Open(mtsai::gst::DeadlineIn(STATE_TIMEOUT)).Ok();
+}
+
+
+// Open
+mtsai::gst::StateChange gstCamera::Open( mtsai::gst::Deadline deadline )
 {
 	// transition pipline to STATE_PLAYING
 	debug_print(LOG_GSTREAMER "gstreamer transitioning pipeline to GST_STATE_PLAYING\n");
 	
-	const GstStateChangeReturn result = gst_element_set_state(mPipeline, GST_STATE_PLAYING);
+	mStateWait = true;
+	const mtsai::gst::StateChange change = mtsai::gst::SetState(mPipeline, GST_STATE_PLAYING, deadline, printStateMsg, this);
+	mStateWait = false;
 
-	if( result == GST_STATE_CHANGE_ASYNC )
+	if( !change )
 	{
-#if 0
-		GstMessage* asyncMsg = gst_bus_timed_pop_filtered(mBus, 5 * GST_SECOND, 
-    	 					      (GstMessageType)(GST_MESSAGE_ASYNC_DONE|GST_MESSAGE_ERROR)); 
+		printf(LOG_GSTREAMER "gstreamer failed to set pipeline state to PLAYING (%s after %.1f ms) %s\n",
+			   mtsai::gst::StateResultName(change.result), change.elapsedMs, change.error.c_str());
 
-		if( asyncMsg != NULL )
-		{
-			gst_message_print(mBus, asyncMsg, this);
-			gst_message_unref(asyncMsg);
-		}
-		else
-			printf(LOG_GSTREAMER "gstreamer NULL message after transitioning pipeline to PLAYING...\n");
-#endif
+		gst_element_set_state(mPipeline, GST_STATE_NULL);
+		return change;
 	}
-	else if( result != GST_STATE_CHANGE_SUCCESS )
+
+	debug_print(LOG_GSTREAMER "gstreamer pipeline PLAYING in %.1f ms\n", change.elapsedMs);
+	return change;
+}
+	
+
+// Prepare
+mtsai::gst::StateChange gstCamera::Prepare( mtsai::gst::Deadline deadline )
+{
+	mStateWait = true;
+	const mtsai::gst::StateChange change = mtsai::gst::SetState(mPipeline, GST_STATE_READY, deadline, printStateMsg, this);
+	mStateWait = false;
+
+	if( !change )
 	{
-		printf(LOG_GSTREAMER "gstreamer failed to set pipeline state to PLAYING (error %u)\n", result);
-		return false;
+		printf(LOG_GSTREAMER "gstreamer failed to set pipeline state to READY (%s after %.1f ms) %s\n",
+			   mtsai::gst::StateResultName(change.result), change.elapsedMs, change.error.c_str());
+
+		gst_element_set_state(mPipeline, GST_STATE_NULL);
 	}
 
-	checkMsgBus();
-	usleep(100*1000);
-	checkMsgBus();
+	return change;
+}
 
-	return true;
+
+// OpenAll
+std::vector<mtsai::gst::StateChange> gstCamera::OpenAll( const std::vector<gstCamera*>& cameras, unsigned long timeout )
+{
+	const mtsai::gst::Deadline deadline = mtsai::gst::DeadlineIn(timeout);
+	std::vector<mtsai::gst::StateChange> changes(cameras.size());
+
+	// READY for all first so the devices open side by side, then PLAYING
+	for( int phase=0; phase < 2; phase++ )
+	{
+		std::vector<std::thread> threads;
+
+		for( size_t n=0; n < cameras.size(); n++ )
+		{
+			if( phase == 1 && !changes[n] )
+				continue;
+
+			threads.emplace_back([&, n, phase]() { changes[n] = (phase == 0) ? cameras[n]->Prepare(deadline) : cameras[n]->Open(deadline); });
+		}
+
+		for( size_t n=0; n < threads.size(); n++ )
+			threads[n].join();
+	}
+
+	return changes;
 }
-	
+
 
 // Close
 void gstCamera::Close()
@@ -398,18 +515,22 @@ void gstCamera::Close()
 	// stop pipeline
 	debug_print(LOG_GSTREAMER "gstreamer transitioning pipeline to GST_STATE_NULL\n");
 
-	const GstStateChangeReturn result = gst_element_set_state(mPipeline, GST_STATE_NULL);
-
-	if( result != GST_STATE_CHANGE_SUCCESS )
-		printf(LOG_GSTREAMER "gstreamer failed to set pipeline state to PLAYING (error %u)\n", result);
+	mStateWait = true;
+	const mtsai::gst::StateChange change = mtsai::gst::SetState(mPipeline, GST_STATE_NULL, mtsai::gst::DeadlineIn(STATE_TIMEOUT), printStateMsg, this);
+	mStateWait = false;
 
-	usleep(250*1000);
+	if( !change )
+		printf(LOG_GSTREAMER "gstreamer failed to set pipeline state to NULL (%s) %s\n",
+			   mtsai::gst::StateResultName(change.result), change.error.c_str());
 }
 
 
 // checkMsgBus
 void gstCamera::checkMsgBus()
 {
+	if( mStateWait )
+		return;
+
 	while(true)
 	{
 		GstMessage* msg = gst_bus_pop(mBus);
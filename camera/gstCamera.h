@@ -6,8 +6,13 @@
 #define __GSTREAMER_CAMERA_H__
 
 #include <gst/gst.h>
+#include <atomic>
 #include <string>
+#include <vector>
 #include "camera.h"
+#include "gst_state.h"
+#include "gst_caps.h"
+#include "image/frame_pool.h"
 
 
 struct _GstAppSink;
@@ -27,9 +32,21 @@ public:
 	gstCamera(int height, int width);
 	~gstCamera();
 
+	// Go to PLAYING and wait for ASYNC_DONE or ERROR (5 s at most)
 	bool Open();
 
+	// Same with a deadline and the typed result, the pipeline goes back to
+	// NULL on failure or timeout
+	mtsai::gst::StateChange Open( mtsai::gst::Deadline deadline );
+
 	void Close();
+
+	// NULL -> READY only, opens the source without starting data flow
+	mtsai::gst::StateChange Prepare( mtsai::gst::Deadline deadline );
+
+	// Open every camera in parallel against one deadline, all to READY first
+	// and then to PLAYING, results in camera order
+	static std::vector<mtsai::gst::StateChange> OpenAll( const std::vector<gstCamera*>& cameras, unsigned long timeout );
 	
 	// Capture YUV (NV12)
 	bool Capture( void** cpu, void** cuda, unsigned long timeout=ULONG_MAX );
@@ -45,6 +62,7 @@ private:
 	bool buildLaunchStr(std::string pipeline);
 	void checkMsgBus();
 	void checkBuffer();
+	bool reserveRingbuffers( size_t size );
 	
 	_GstBus*     mBus;
 	_GstAppSink* mAppSink;
@@ -55,8 +73,14 @@ private:
  	static bool mOnboardCamera;
 	static const uint32_t NUM_RINGBUFFERS = 4;
 	
-	void* mRingbufferCPU[NUM_RINGBUFFERS];
-	void* mRingbufferGPU[NUM_RINGBUFFERS];
+	// mapped ringbuffers, sized at caps time and kept across Close() / Open()
+	mtsai::image::FramePool* mRingPool;
+	
+	// layout and timing of the frame in each ringbuffer
+	mtsai::image::FrameDescriptor mRingFrames[NUM_RINGBUFFERS];
+	
+	// caps of the last sample, parsed once per negotiation
+	mtsai::gst::CapsLayout mCaps;
 	
 	QWaitCondition* mWaitEvent;
 	
@@ -65,6 +89,10 @@ private:
 	
 	uint32_t mLatestRingbuffer;
 	bool     mLatestRetrieved;
+	uint64_t mSequence;
+
+	// set while Open()/Close() read the bus, checkMsgBus() leaves it alone
+	std::atomic<bool> mStateWait;
 };
 
 #endif
@@ -3,91 +3,18 @@
  */
 #include "debug.h"
 #include "gstUtility.h"
+#include "gst_runtime.h"
 
 #include <gst/gst.h>
 #include <stdint.h>
 #include <stdio.h>
 
 
-inline const char* gst_debug_level_str( GstDebugLevel level )
-{
-	switch (level)
-	{
-		case GST_LEVEL_NONE:	return "GST_LEVEL_NONE   ";
-		case GST_LEVEL_ERROR:	return "GST_LEVEL_ERROR  ";
-		case GST_LEVEL_WARNING:	return "GST_LEVEL_WARNING";
-		case GST_LEVEL_INFO:	return "GST_LEVEL_INFO   ";
-		case GST_LEVEL_DEBUG:	return "GST_LEVEL_DEBUG  ";
-		case GST_LEVEL_LOG:		return "GST_LEVEL_LOG    ";
-		case GST_LEVEL_FIXME:	return "GST_LEVEL_FIXME  ";
-#ifdef GST_LEVEL_TRACE
-		case GST_LEVEL_TRACE:	return "GST_LEVEL_TRACE  ";
-#endif
-		case GST_LEVEL_MEMDUMP:	return "GST_LEVEL_MEMDUMP";
-    		default:				return "<unknown>        ";
-    }
-}
-
-#define SEP "              "
-
-void rilog_debug_function(GstDebugCategory* category, GstDebugLevel level,
-                          const gchar* file, const char* function,
-                          gint line, GObject* object, GstDebugMessage* message,
-                          gpointer data)
-{
-	if( level > GST_LEVEL_WARNING /*GST_LEVEL_INFO*/ )
-		return;
-
-	//gchar* name = NULL;
-	//if( object != NULL )
-	//	g_object_get(object, "name", &name, NULL);
-
-	const char* typeName  = " ";
-	const char* className = " ";
-
-	if( object != NULL )
-	{
-		typeName  = G_OBJECT_TYPE_NAME(object);
-		className = G_OBJECT_CLASS_NAME(object);
-	}
-
-	debug_print(LOG_GSTREAMER "%s %s %s\n" SEP "%s:%i  %s\n" SEP "%s\n", 
-		  	gst_debug_level_str(level), typeName,
-		  	gst_debug_category_get_name(category), file, line, function, 
-            	gst_debug_message_get(message));
-
-}
-
-
+// one bootstrap and one log hook for the process: the library's, so the
+// legacy cameras share its level mapping and "gstreamer" rate limit
 bool gstreamerInit()
 {
-	int argc = 0;
-	//char* argv[] = { "none" };
-
-	if( !gst_init_check(&argc, NULL, NULL) )
-	{
-		printf(LOG_GSTREAMER "failed to initialize gstreamer library with gst_init()\n");
-		return false;
-	}
-
-	uint32_t ver[] = { 0, 0, 0, 0 };
-	gst_version( &ver[0], &ver[1], &ver[2], &ver[3] );
-
-	debug_print(LOG_GSTREAMER "initialized gstreamer, version %u.%u.%u.%u\n", ver[0], ver[1], ver[2], ver[3]);
-
-
-	// debugging
-	gst_debug_remove_log_function(gst_debug_log_default);
-	
-	if( true )
-	{
-		gst_debug_add_log_function(rilog_debug_function, NULL, NULL);
-
-		gst_debug_set_active(true);
-		gst_debug_set_colored(false);
-	}
-	
-	return true;
+	return mtsai::gst::Init();
 }
 //---------------------------------------------------------------------------------------------
 
@@ -8,6 +8,8 @@
 #include "gvStream.h"
 #if (VIDEO_SRC == VIDEO_GV_STREAM_SOURCE)
 #include <string.h>
+#include <algorithm>
+#include <chrono>
 #include <cuda_runtime.h>
 #include <cuda.h>
 #include "debug.h"
@@ -26,127 +28,119 @@ void error(char *msg) {
 }
 
 gvStream::gvStream(int height, int width) 
-  : camera(height, width)
+  : gvStream(height, width, gvStreamConfig())
 {
-	cancel = FALSE;
-	mWidth = width;
-    mFrame = 0;
-    mGpuBuffer = 0;
-	arv_option_camera_name = NULL;
-	arv_option_debug_domains = NULL;
-	arv_option_snaphot = FALSE;
-	arv_option_trigger = NULL;
-	arv_option_software_trigger = -1;
-	arv_option_frequency = -1.0;
-	arv_option_width = -1;
-	arv_option_height = -1;
-	arv_option_horizontal_binning = -1;
-	arv_option_vertical_binning = -1;
-	arv_option_exposure_time_us = -1;
-	arv_option_gain = -1;
-	gboolean arv_option_auto_socket_buffer = FALSE;
-	gboolean arv_option_no_packet_resend = FALSE;
-	arv_option_packet_timeout = 20;
-	arv_option_frame_retention = 100;
-	arv_option_gv_stream_channel = -1;
-	arv_option_gv_packet_delay = -1;
-	arv_option_gv_packet_size = -1;
-	gboolean arv_option_realtime = FALSE;
-	gboolean arv_option_high_priority = FALSE;
-	gboolean arv_option_no_packet_socket = FALSE;
-	arv_option_chunks = NULL;
-	arv_option_bandwidth_limit = -1;
 }
 
-void
-gvStream::set_cancel (int signal)
+gvStream::gvStream(int height, int width, const gvStreamConfig& config) 
+  : camera(height, width), mConfig(config)
 {
-	cancel = TRUE;
+	mWidth = width;
+    mFrame = 0;
+	mCamera = NULL;
+	mStream = NULL;
+	memset(&mCurrentFrame, 0, sizeof(gvFrame));
+	mCancel = false;
+	mMaxQueued = config.max_queued;
+	mBytesCompleted = 0;
+	mLastBytes = 0;
+	mLastFrames = 0;
+	data.buffer_count = 0;
+	data.chunks = NULL;
+	data.chunk_parser = NULL;
 }
 
 void
-gvStream::new_buffer_cb (ArvStream *stream, ApplicationData *data)
+gvStream::new_buffer_cb (ArvStream *stream, gvStream *self)
 {
 	ArvBuffer *buffer;
-	size_t size = 0;
 
 	buffer = arv_stream_try_pop_buffer (stream);
 	if (buffer != NULL) {
-		if (arv_buffer_get_status (buffer) == ARV_BUFFER_STATUS_SUCCESS)
-			data->buffer_count++;
+		if (arv_buffer_get_status (buffer) != ARV_BUFFER_STATUS_SUCCESS) {
+			/* Incomplete frame, give it straight back to Aravis */
+			arv_stream_push_buffer (stream, buffer);
+			return;
+		}
+
+		self->data.buffer_count++;
+		size_t size = 0;
+		arv_buffer_get_data (buffer, &size);
+		self->mBytesCompleted += size;
 
 		if (arv_buffer_get_payload_type (buffer) == ARV_BUFFER_PAYLOAD_TYPE_CHUNK_DATA &&
-		    data->chunks != NULL) {
+		    self->data.chunks != NULL) {
 			int i;
 
-			for (i = 0; data->chunks[i] != NULL; i++)
-				printf ("%s = %" G_GINT64_FORMAT "\n", data->chunks[i],
-					arv_chunk_parser_get_integer_value (data->chunk_parser, buffer, data->chunks[i]));
+			for (i = 0; self->data.chunks[i] != NULL; i++)
+				printf ("%s = %" G_GINT64_FORMAT "\n", self->data.chunks[i],
+					arv_chunk_parser_get_integer_value (self->data.chunk_parser, buffer, self->data.chunks[i]));
 		}
 
-		/* Image processing here */
-		mFrame++;
-		mBuffer = (void*)arv_buffer_get_data(buffer, &size);
-//		printf("Frame %d, Buffer 0x%x, Size %d\n", mFrame, (void*)mBuffer, (unsigned int)size);
-//		DumpHex(buffer, 128);
-		mFrameReady = true;
-		g_main_context_wakeup(context);
-
-		arv_stream_push_buffer (stream, buffer);
+		/* Queue the frame, it stays out of the stream until it is released */
+		{
+			std::lock_guard<std::mutex> lock(self->mQueueMutex);
+			self->mFrame++;
+			self->mReadyBuffers.push_back(buffer);
+
+			/* Nobody is consuming, recycle the oldest so the stream does not run dry */
+			while (self->mReadyBuffers.size() > self->mMaxQueued) {
+				arv_stream_push_buffer (stream, self->mReadyBuffers.front());
+				self->mReadyBuffers.pop_front();
+			}
+		}
+		self->mFrameEvent.notify_one();
 	}
 }
 
 void
 gvStream::stream_cb (void *user_data, ArvStreamCallbackType type, ArvBuffer *buffer)
 {
+	gvStream *self = (gvStream*)user_data;
+
 	if (type == ARV_STREAM_CALLBACK_TYPE_INIT) {
-		if (arv_option_realtime) {
+		if (self->mConfig.realtime) {
 			if (!arv_make_thread_realtime (10))
 				printf ("Failed to make stream thread realtime\n");
-		} else if (arv_option_high_priority) {
+		} else if (self->mConfig.high_priority) {
 			if (!arv_make_thread_high_priority (-10))
 				printf ("Failed to make stream thread high priority\n");
 		}
 	}
 }
 
-gboolean
-gvStream::periodic_task_cb (void *abstract_data)
+void
+gvStream::softwareTriggerThread ()
 {
-	ApplicationData *data = (ApplicationData*)abstract_data;
+	const std::chrono::microseconds period((long)(1000000.0 / mConfig.software_trigger));
 
-	printf ("Frame rate = %d Hz\n", data->buffer_count);
-	data->buffer_count = 0;
-
-	if (cancel) {
-		g_main_loop_quit (data->main_loop);
-		return FALSE;
+	while (!mCancel) {
+		arv_camera_software_trigger (mCamera);
+		std::this_thread::sleep_for (period);
 	}
-
-	return TRUE;
-}
-
-gboolean
-gvStream::emit_software_trigger (void *abstract_data)
-{
-	ArvCamera *mCamera = (ArvCamera*)abstract_data;
-
-	arv_camera_software_trigger (mCamera);
-
-	return TRUE;
 }
 
 void
-gvStream::control_lost_cb (ArvGvDevice *gv_device)
+gvStream::control_lost_cb (ArvGvDevice *gv_device, gvStream *self)
 {
 	printf ("Control lost\n");
 
-	cancel = TRUE;
+	self->mCancel = true;
+	self->mFrameEvent.notify_all();
 }
 
 gvStream::~gvStream(void)
 {
-
+	/* joins the trigger thread and detaches the callbacks from this */
+	Close();
+
+	if (!mOrphaned.empty()) {
+		printf("gvStream -- destroyed with %zu acquired frames not released\n", mOrphaned.size());
+		for (ArvBuffer *buffer : mOrphaned)
+			g_object_unref (buffer);
+		mOrphaned.clear();
+	}
+	freePool(mOrphanedPool);
 }
 
 char* gvStream::str_format(ArvPixelFormat format)
@@ -195,20 +189,22 @@ bool gvStream::Open()
 	data.buffer_count = 0;
 	data.chunks = NULL;
 	data.chunk_parser = NULL;
+	mCancel = false;
 
 	arv_g_thread_init (NULL);
 	arv_g_type_init ();
 
-	context = g_main_context_new ();
+	const char *camera_name = mConfig.camera_name.empty() ? NULL : mConfig.camera_name.c_str();
+	const char *chunks = mConfig.chunks.empty() ? NULL : mConfig.chunks.c_str();
 
-	arv_debug_enable (arv_option_debug_domains);
+	arv_debug_enable (mConfig.debug_domains.empty() ? NULL : mConfig.debug_domains.c_str());
 
-	if (arv_option_camera_name == NULL)
+	if (camera_name == NULL)
 		debug_print ("Looking for the first available camera\n");
 	else
-		debug_print ("Looking for camera '%s'\n", arv_option_camera_name);
+		debug_print ("Looking for camera '%s'\n", camera_name);
 
-	mCamera = arv_camera_new (arv_option_camera_name);
+	mCamera = arv_camera_new (camera_name);
 	if (mCamera != NULL) {
 		gint payload;
 		gint x, y, width, height;
@@ -218,14 +214,13 @@ bool gvStream::Open()
 		guint64 n_failures;
 		guint64 n_underruns;
 		int gain;
-		software_trigger_source = 0;
 		ArvPixelFormat format;
 		gint maxHeight, maxWidth;
 
-		if (arv_option_chunks != NULL) {
+		if (chunks != NULL) {
 			char *striped_chunks;
 
-			striped_chunks = g_strdup (arv_option_chunks);
+			striped_chunks = g_strdup (chunks);
 			arv_str_strip (striped_chunks, " ,:;", ',');
 			data.chunks = g_strsplit_set (striped_chunks, ",", -1);
 			g_free (striped_chunks);
@@ -240,23 +235,22 @@ bool gvStream::Open()
 			}
 		}
 
-		arv_camera_set_chunks (mCamera, arv_option_chunks);
-		arv_camera_set_region (mCamera, 0, 0, arv_option_width, arv_option_height);
-		arv_camera_set_binning (mCamera, arv_option_horizontal_binning, arv_option_vertical_binning);
-		arv_camera_set_exposure_time (mCamera, arv_option_exposure_time_us);
-		arv_camera_set_gain (mCamera, arv_option_gain);
+		arv_camera_set_chunks (mCamera, chunks);
+		arv_camera_set_region (mCamera, 0, 0, -1, -1);
+		arv_camera_set_binning (mCamera, mConfig.horizontal_binning, mConfig.vertical_binning);
+		arv_camera_set_exposure_time (mCamera, mConfig.exposure_time_us);
+		arv_camera_set_gain (mCamera, mConfig.gain);
 
 		if (arv_camera_is_uv_device(mCamera)) {
-			arv_camera_uv_set_bandwidth (mCamera, arv_option_bandwidth_limit);
+			arv_camera_uv_set_bandwidth (mCamera, mConfig.bandwidth_limit);
 		}
 
 		if (arv_camera_is_gv_device (mCamera)) {
-			arv_camera_gv_select_stream_channel (mCamera, arv_option_gv_stream_channel);
-			arv_camera_gv_set_packet_delay (mCamera, arv_option_gv_packet_delay);
-			arv_camera_gv_set_packet_size (mCamera, arv_option_gv_packet_size);
-			arv_camera_gv_set_stream_options (mCamera, arv_option_no_packet_socket ?
-							  ARV_GV_STREAM_OPTION_PACKET_SOCKET_DISABLED :
-							  ARV_GV_STREAM_OPTION_NONE);
+			arv_camera_gv_select_stream_channel (mCamera, mConfig.gv_stream_channel);
+			applyPacketOptions();
+			arv_camera_gv_set_stream_options (mCamera, mConfig.packet_socket ?
+							  ARV_GV_STREAM_OPTION_NONE :
+							  ARV_GV_STREAM_OPTION_PACKET_SOCKET_DISABLED);
 		}
 
 		arv_camera_get_sensor_size(mCamera, &maxWidth, &maxHeight);
@@ -321,53 +315,45 @@ bool gvStream::Open()
 		}
 #endif
 
-		mStream = arv_camera_create_stream (mCamera, stream_cb, NULL);
+		mStream = arv_camera_create_stream (mCamera, stream_cb, this);
 		if (mStream != NULL) {
-			if (ARV_IS_GV_STREAM (mStream)) {
-				if (arv_option_auto_socket_buffer)
-					g_object_set (mStream,
-						      "socket-buffer", ARV_GV_STREAM_SOCKET_BUFFER_AUTO,
-						      "socket-buffer-size", 0,
-						      NULL);
-				if (arv_option_no_packet_resend)
-					g_object_set (mStream,
-						      "packet-resend", ARV_GV_STREAM_PACKET_RESEND_NEVER,
-						      NULL);
-				g_object_set (mStream,
-					      "packet-timeout", (unsigned) arv_option_packet_timeout * 1000,
-					      "frame-retention", (unsigned) arv_option_frame_retention * 1000,
-					      NULL);
-			}
+			applyStreamOptions();
 
-			for (i = 0; i < 50; i++)
-				arv_stream_push_buffer (mStream, arv_buffer_new (payload, NULL));
+			if (!allocPool (payload)) {
+				g_clear_object (&mStream);
+				g_clear_object (&mCamera);
+				return false;
+			}
 
 			arv_camera_set_acquisition_mode (mCamera, ARV_ACQUISITION_MODE_CONTINUOUS);
 
-			if (arv_option_trigger != NULL)
-				arv_camera_set_trigger (mCamera, arv_option_trigger);
+			if (!mConfig.trigger.empty())
+				arv_camera_set_trigger (mCamera, mConfig.trigger.c_str());
 
-			if (arv_option_software_trigger > 0.0) {
-				arv_camera_set_trigger (mCamera, "Software");
-				software_trigger_source = g_timeout_add ((double) (0.5 + 1000.0 /
-										   arv_option_software_trigger),
-									 emit_software_trigger, mCamera);
-			}
-
-			arv_camera_start_acquisition (mCamera);
-
-			g_signal_connect (mStream, "new-buffer", G_CALLBACK (new_buffer_cb), &data);
+			/* new-buffer is emitted from the Aravis stream thread, no main loop needed */
+			g_signal_connect (mStream, "new-buffer", G_CALLBACK (new_buffer_cb), this);
 			arv_stream_set_emit_signals (mStream, TRUE);
 
 			g_signal_connect (arv_camera_get_device (mCamera), "control-lost",
-					  G_CALLBACK (control_lost_cb), NULL);
+					  G_CALLBACK (control_lost_cb), this);
 
-			data.main_loop = g_main_loop_new (NULL, FALSE);
+			mBytesCompleted = 0;
+			mLastBytes = 0;
+			mLastFrames = 0;
+			mLastMetrics = std::chrono::steady_clock::now();
 
-			old_sigint_handler = signal (SIGINT, set_cancel);
+			arv_camera_start_acquisition (mCamera);
+
+			if (mConfig.software_trigger > 0.0) {
+				arv_camera_set_trigger (mCamera, "Software");
+				mTriggerThread = std::thread(&gvStream::softwareTriggerThread, this);
+			}
 
-		} else
+		} else {
 			printf ("Can't create stream thread (check if the device is not already used)\n");
+			g_clear_object (&mCamera);
+			return false;
+		}
 
 	} else
 	{
@@ -381,54 +367,322 @@ bool gvStream::Open()
 
 void gvStream::Close()
 {
-#if 0
-	arv_stream_get_statistics (mStream, &n_completed_buffers, &n_failures, &n_underruns);
+	gvStreamMetrics metrics;
+
+	if (GetMetrics (&metrics)) {
+		printf ("Completed buffers = %llu\n", (unsigned long long) metrics.completed_buffers);
+		printf ("Failures          = %llu\n", (unsigned long long) metrics.failures);
+		printf ("Underruns         = %llu\n", (unsigned long long) metrics.underruns);
+		printf ("Resent packets    = %llu\n", (unsigned long long) metrics.resent_packets);
+		printf ("Missing packets   = %llu\n", (unsigned long long) metrics.missing_packets);
+	}
+	mCancel = true;
+	mFrameEvent.notify_all();
 
-	printf ("Completed buffers = %Lu\n", (unsigned long long) n_completed_buffers);
-	printf ("Failures          = %Lu\n", (unsigned long long) n_failures);
-	printf ("Underruns         = %Lu\n", (unsigned long long) n_underruns);
-#endif
-	g_object_unref (mCamera);
+	if (mTriggerThread.joinable())
+		mTriggerThread.join();
 
-	if (software_trigger_source > 0)
-		g_source_remove (software_trigger_source);
+	if (mCamera != NULL) {
+		arv_camera_stop_acquisition (mCamera);
+		g_signal_handlers_disconnect_by_data (arv_camera_get_device (mCamera), this);
+	}
 
-	signal (SIGINT, old_sigint_handler);
+	if (mStream != NULL) {
+		arv_stream_set_emit_signals (mStream, FALSE);
+		g_signal_handlers_disconnect_by_data (mStream, this);
+
+		/* Buffers we still hold are owned by us, the stream frees its own */
+		std::lock_guard<std::mutex> lock(mQueueMutex);
+		for (ArvBuffer *buffer : mReadyBuffers)
+			g_object_unref (buffer);
+		mReadyBuffers.clear();
+		if (mCurrentFrame.buffer != NULL)
+			g_object_unref (mCurrentFrame.buffer);
+		memset(&mCurrentFrame, 0, sizeof(gvFrame));
+	}
 
-	g_main_loop_unref (data.main_loop);
-	
-	arv_camera_stop_acquisition (mCamera);
+	{
+		std::lock_guard<std::mutex> lock(mQueueMutex);
+
+		/* ArvBuffers never free preallocated memory, do it once they are gone.
+		 * Frames still out from Acquire() keep their pool until released. */
+		if (!mAcquired.empty()) {
+			debug_print("gvStream -- closing with %zu acquired frames, pool freed on their release\n", mAcquired.size());
+			mOrphaned.insert(mOrphaned.end(), mAcquired.begin(), mAcquired.end());
+			mOrphanedPool.insert(mOrphanedPool.end(), mPool.begin(), mPool.end());
+			mAcquired.clear();
+			mPool.clear();
+		}
+		freePool(mPool);
+	}
 
-	g_object_unref (mStream);
+	g_clear_object (&mStream);
+	g_clear_object (&mCamera);
 
 	if (data.chunks != NULL)
 		g_strfreev (data.chunks);
+	data.chunks = NULL;
 
 	g_clear_object (&data.chunk_parser);
 }
 
+void gvStream::releaseBuffer( ArvBuffer* buffer )
+{
+	if (buffer != NULL && mStream != NULL)
+		arv_stream_push_buffer (mStream, buffer);
+}
+
+bool gvStream::allocPool( size_t payload )
+{
+	const unsigned int count = mConfig.buffer_count;
+
+	if (count < 2) {
+		printf("gvStream -- need at least 2 buffers in the pool (%u)\n", count);
+		return false;
+	}
+
+	for (unsigned int i = 0; i < count; i++) {
+		poolEntry entry;
+
+		if (!cudaAllocMapped(&entry.cpu, &entry.cuda, payload)) {
+			printf(LOG_CUDA "gvStream -- failed to allocate buffer %u (size=%zu)\n", i, payload);
+			return false;
+		}
+		mPool.push_back(entry);
+
+		/* The pool index is kept as user data to find the CUDA address again */
+		arv_stream_push_buffer (mStream, arv_buffer_new_full (payload, entry.cpu, GUINT_TO_POINTER(i), NULL));
+	}
+
+	debug_print("gvStream -- allocated %u mapped buffers, %zu bytes each\n", count, payload);
+	return true;
+}
+
+void gvStream::freePool( std::vector<poolEntry>& pool )
+{
+	for (size_t i = 0; i < pool.size(); i++)
+		CUDA(cudaFreeHost(pool[i].cpu));
+	pool.clear();
+}
+
+bool gvStream::waitFrame( std::unique_lock<std::mutex>& lock, unsigned long timeout )
+{
+	auto ready = [this]() { return !mReadyBuffers.empty() || mCancel; };
+
+	if (timeout == ULONG_MAX)
+		mFrameEvent.wait(lock, ready);
+	else if (!mFrameEvent.wait_for(lock, std::chrono::milliseconds(timeout), ready))
+		return false;
+
+	return !mReadyBuffers.empty();	/* false when cancelled */
+}
+
+void gvStream::fillFrame( ArvBuffer* buffer, gvFrame* frame )
+{
+	const unsigned int index = GPOINTER_TO_UINT(arv_buffer_get_user_data (buffer));
+
+	frame->buffer       = buffer;
+	frame->cpu          = (void*)arv_buffer_get_data (buffer, &frame->size);
+	frame->cuda         = (index < mPool.size()) ? mPool[index].cuda : NULL;
+	frame->timestamp_ns = arv_buffer_get_timestamp (buffer);
+	frame->frame_id     = arv_buffer_get_frame_id (buffer);
+}
+
+bool gvStream::Describe( const gvFrame* frame, mtsai::image::FrameDescriptor* desc )
+{
+	if (!frame || !frame->buffer || !desc)
+		return false;
+
+	uint32_t fourcc = 0;
+	switch (arv_buffer_get_image_pixel_format (frame->buffer))
+	{
+		case ARV_PIXEL_FORMAT_BAYER_GR_8 :
+			fourcc = mtsai::image::FOURCC_GRBG8;
+			break;
+		case ARV_PIXEL_FORMAT_YUV_422_PACKED :
+			fourcc = mtsai::image::FOURCC_UYVY;
+			break;
+		case ARV_PIXEL_FORMAT_RGB_8_PACKED :
+			fourcc = mtsai::image::FOURCC_RGB24;
+			break;
+		case ARV_PIXEL_FORMAT_MONO_8 :
+			fourcc = mtsai::image::FOURCC_GREY;
+			break;
+		default :
+			break;
+	}
+
+	/* GigE Vision images are sent without row padding */
+	const bool known = mtsai::image::DescribeFrame(fourcc,
+		arv_buffer_get_image_width (frame->buffer),
+		arv_buffer_get_image_height (frame->buffer), 0, desc);
+
+	desc->size        = frame->size;
+	desc->colour      = GetColourSpace();
+	desc->pts         = frame->timestamp_ns;
+	desc->captureTime = mtsai::image::FrameClockNow();
+	desc->sequence    = frame->frame_id;
+	desc->sourceId    = mDescriptor.sourceId;
+	desc->cpu         = frame->cpu;
+	desc->cuda        = frame->cuda;
+	return known;
+}
+
+void gvStream::applyStreamOptions()
+{
+	if (!ARV_IS_GV_STREAM (mStream))
+		return;
+
+	if (mConfig.auto_socket_buffer)
+		g_object_set (mStream,
+			      "socket-buffer", ARV_GV_STREAM_SOCKET_BUFFER_AUTO,
+			      "socket-buffer-size", 0,
+			      NULL);
+	else if (mConfig.socket_buffer_size > 0)
+		g_object_set (mStream,
+			      "socket-buffer", ARV_GV_STREAM_SOCKET_BUFFER_FIXED,
+			      "socket-buffer-size", mConfig.socket_buffer_size,
+			      NULL);
+
+	g_object_set (mStream,
+		      "packet-resend", mConfig.packet_resend ?
+				ARV_GV_STREAM_PACKET_RESEND_ALWAYS : ARV_GV_STREAM_PACKET_RESEND_NEVER,
+		      "packet-timeout", (unsigned) mConfig.packet_timeout * 1000,
+		      "frame-retention", (unsigned) mConfig.frame_retention * 1000,
+		      NULL);
+}
+
+void gvStream::applyPacketOptions()
+{
+	if (!arv_camera_is_gv_device (mCamera))
+		return;
+
+	arv_camera_gv_set_packet_delay (mCamera, mConfig.gv_packet_delay);
+	arv_camera_gv_set_packet_size (mCamera, mConfig.gv_packet_size);
+}
+
+bool gvStream::SetConfig( const gvStreamConfig& config )
+{
+	std::lock_guard<std::mutex> lock(mConfigMutex);
+
+	const bool packetChanged = (config.gv_packet_size != mConfig.gv_packet_size) ||
+				   (config.gv_packet_delay != mConfig.gv_packet_delay);
+
+	mConfig = config;
+	mMaxQueued = config.max_queued;
+
+	if (mStream == NULL)
+		return true;	/* picked up by Open() */
+
+	applyStreamOptions();
+
+	if (packetChanged && mCamera != NULL) {
+		applyPacketOptions();
+		printf ("gvStream -- packet size now %d bytes, delay %" G_GINT64_FORMAT " ns\n",
+			arv_camera_gv_get_packet_size (mCamera), arv_camera_gv_get_packet_delay (mCamera));
+	}
+	return true;
+}
+
+bool gvStream::GetMetrics( gvStreamMetrics* metrics )
+{
+	if (!metrics || mStream == NULL)
+		return false;
+
+	memset(metrics, 0, sizeof(gvStreamMetrics));
+
+	arv_stream_get_statistics (mStream, &metrics->completed_buffers, &metrics->failures, &metrics->underruns);
+
+	if (ARV_IS_GV_STREAM (mStream))
+		arv_gv_stream_get_statistics (ARV_GV_STREAM (mStream), &metrics->resent_packets, &metrics->missing_packets);
+
+	std::lock_guard<std::mutex> lock(mConfigMutex);
+
+	const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	const double elapsed = std::chrono::duration<double>(now - mLastMetrics).count();
+	const guint64 bytes = mBytesCompleted;
+
+	if (elapsed > 0.0) {
+		metrics->frame_rate = (metrics->completed_buffers - mLastFrames) / elapsed;
+		metrics->bandwidth  = (bytes - mLastBytes) / elapsed;
+	}
+
+	mLastFrames  = metrics->completed_buffers;
+	mLastBytes   = bytes;
+	mLastMetrics = now;
+	return true;
+}
+
+bool gvStream::Acquire( gvFrame* frame, unsigned long timeout )
+{
+	if (!frame)
+		return false;
+
+	std::unique_lock<std::mutex> lock(mQueueMutex);
+
+	if (!waitFrame(lock, timeout))
+		return false;
+
+	ArvBuffer *buffer = mReadyBuffers.front();
+	mReadyBuffers.pop_front();
+	mAcquired.push_back(buffer);
+	fillFrame(buffer, frame);
+	return true;
+}
+
+void gvStream::Release( gvFrame* frame )
+{
+	if (!frame || !frame->buffer)
+		return;
+
+	std::unique_lock<std::mutex> lock(mQueueMutex);
+
+	std::vector<ArvBuffer*>::iterator it = std::find(mAcquired.begin(), mAcquired.end(), frame->buffer);
+	if (it != mAcquired.end())
+		mAcquired.erase(it);
+
+	/* Acquired before Close(), the stream is gone: free only this buffer,
+	 * and the closed pool with the last one */
+	it = std::find(mOrphaned.begin(), mOrphaned.end(), frame->buffer);
+	if (it != mOrphaned.end()) {
+		mOrphaned.erase(it);
+		g_object_unref (frame->buffer);
+		if (mOrphaned.empty())
+			freePool(mOrphanedPool);
+	} else {
+		lock.unlock();
+		releaseBuffer (frame->buffer);
+	}
+	memset(frame, 0, sizeof(gvFrame));
+}
+
 bool gvStream::Capture( void** cpu, void** cuda, unsigned long timeout )
 {
-	// Allocate a buffer the first time we call this function
-	if (!mGpuBuffer) cudaMalloc(&mGpuBuffer, GetHeight() * GetWidth() * VIDEO_BYTES_PER_PIXEL);
-	
-	mFrameReady = false;
-	if (!cancel)
+	/* The caller is done with the frame from the previous Capture() */
+	Release(&mCurrentFrame);
+
+	ArvBuffer *buffer = NULL;
 	{
-//		printf("DEBUG: Frame %d (%d x %d = %d)\n", mFrame, GetWidth(), GetHeight(), GetWidth() * GetHeight() * 3);
-		while (!mFrameReady)
-		{
-			g_main_context_iteration(context, TRUE);
+		std::unique_lock<std::mutex> lock(mQueueMutex);
+
+		if (!waitFrame(lock, timeout))
+			return false;
+
+		/* Keep the newest frame, older ones go straight back to the stream */
+		buffer = mReadyBuffers.back();
+		mReadyBuffers.pop_back();
+		while (!mReadyBuffers.empty()) {
+			releaseBuffer (mReadyBuffers.front());
+			mReadyBuffers.pop_front();
 		}
-		mFrameReady = false;	
-		
-//		if ((mFrame % (int)VIDEO_GV_SRC_FRAMERATE) == 0) periodic_task_cb(&data);	
 	}
 
-	cudaMemcpy( mGpuBuffer, mBuffer, GetWidth() * GetHeight() * VIDEO_BYTES_PER_PIXEL, cudaMemcpyHostToDevice );
+	/* Zero copy, the buffer is mapped for both the CPU and the GPU */
+	fillFrame(buffer, &mCurrentFrame);
+	Describe(&mCurrentFrame, &mDescriptor);
 
-	*cpu = (void*)mBuffer;
-	*cuda = (void*)mGpuBuffer;
+	*cpu = mCurrentFrame.cpu;
+	*cuda = mCurrentFrame.cuda;
 	return true;
 }
 
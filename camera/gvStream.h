@@ -9,78 +9,186 @@
 
 #include <arv.h>
 #include <stdlib.h>
-#include <signal.h>
 #include <stdio.h>
 #include "camera.h"
 
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <string>
+
+/* Default number of ArvBuffers pushed to the stream */
+#define GV_STREAM_DEFAULT_BUFFERS 	16
+
 typedef struct {
-	GMainLoop *main_loop;
 	int buffer_count;
 	ArvChunkParser *chunk_parser;
 	char **chunks;
 } ApplicationData;
 
-static gboolean cancel;
-static char *arv_option_camera_name;
-static char *arv_option_debug_domains;
-static gboolean arv_option_snaphot;
-static char *arv_option_trigger;
-static double arv_option_software_trigger;
-static double arv_option_frequency;
-static int arv_option_width;
-static int arv_option_height;
-static int arv_option_horizontal_binning;
-static int arv_option_vertical_binning;
-static double arv_option_exposure_time_us;
-static int arv_option_gain;
-static gboolean arv_option_auto_socket_buffer;
-static gboolean arv_option_no_packet_resend;
-static unsigned int arv_option_packet_timeout;
-static unsigned int arv_option_frame_retention;
-static int arv_option_gv_stream_channel;
-static int arv_option_gv_packet_delay;
-static int arv_option_gv_packet_size;
-static gboolean arv_option_realtime;
-static gboolean arv_option_high_priority;
-static gboolean arv_option_no_packet_socket;
-static char *arv_option_chunks;
-static unsigned int arv_option_bandwidth_limit;
-		
-static unsigned int mFrame;
-static bool mFrameReady;
-static GMainContext *context;
-static const void *mBuffer;
+/**
+ * Per camera Aravis settings, -1 (or an empty string) keeps the camera default.
+ * Times are in milliseconds.
+ */
+struct gvStreamConfig
+{
+	std::string camera_name;			/* Aravis device id, empty for the first camera */
+	std::string debug_domains;
+	std::string trigger;
+	std::string chunks;
+	double software_trigger = -1;		/* Hz */
+	int horizontal_binning = -1;
+	int vertical_binning = -1;
+	double exposure_time_us = -1;
+	int gain = -1;
+	unsigned int bandwidth_limit = -1;	/* USB3 Vision only */
+
+	/* GigE Vision stream */
+	int gv_stream_channel = -1;
+	int gv_packet_delay = -1;			/* ns */
+	int gv_packet_size = -1;			/* bytes */
+	bool auto_socket_buffer = false;
+	int socket_buffer_size = 0;			/* bytes, fixed size when auto_socket_buffer is off, 0 keeps the default */
+	bool packet_resend = true;
+	unsigned int packet_timeout = 20;
+	unsigned int frame_retention = 100;
+	bool packet_socket = true;
+	bool realtime = false;
+	bool high_priority = false;
+
+	/* Buffer pool */
+	unsigned int buffer_count = GV_STREAM_DEFAULT_BUFFERS;
+	unsigned int max_queued = 4;
+};
+
+/**
+ * Live stream statistics, see gvStream::GetMetrics()
+ */
+typedef struct {
+	guint64 completed_buffers;
+	guint64 failures;
+	guint64 underruns;
+	guint64 resent_packets;		/* GigE Vision only */
+	guint64 missing_packets;	/* GigE Vision only */
+	double frame_rate;			/* frames per second since the previous GetMetrics() */
+	double bandwidth;			/* completed payload in bytes per second, same interval */
+} gvStreamMetrics;
+
+/**
+ * Frame handle returned by gvStream::Acquire(). The pixels are read in place
+ * from the ArvBuffer, which is only given back to Aravis by Release().
+ */
+typedef struct {
+	ArvBuffer *buffer;
+	void *cpu;
+	void *cuda;
+	size_t size;
+	guint64 timestamp_ns;
+	guint32 frame_id;
+} gvFrame;
 
 /**
  * gvStream ethernet video data (Aravis)
+ *
+ * All state is per instance so several GigE cameras can stream in one
+ * process. Aravis delivers buffers on its own stream thread, Capture() blocks
+ * on a condition variable until one is queued.
+ *
+ * The stream fills a pool of mapped (zero copy) buffers. Frames are handed
+ * out with Acquire() and pushed back to the stream with Release(), so the
+ * pool size bounds how many frames a consumer may hold at once.
  */
 class gvStream : public camera
 {
 public:
     gvStream(int height, int width);
+    gvStream(int height, int width, const gvStreamConfig& config);
     ~gvStream();
     int Transmit(char* rgbframe, bool gpuAddr) {return -1;}; /* Not supported */
     bool Open();
+	/* Frames still held from Acquire() stay valid, their memory is freed
+	 * when the last of them is released */
 	void Close();
     bool Capture( void** cpu, void** cuda, unsigned long timeout=ULONG_MAX );
-    
+
+	/* Take the oldest queued frame, it stays valid until Release() */
+	bool Acquire( gvFrame* frame, unsigned long timeout=ULONG_MAX );
+	void Release( gvFrame* frame );
+
+	/* Layout of an acquired frame from the buffer geometry and pixel format,
+	 * false for formats without a fourcc (the descriptor still has the
+	 * pointers and timing) */
+	bool Describe( const gvFrame* frame, mtsai::image::FrameDescriptor* desc );
+
+	/* Settings are used by Open(). While streaming, the stream (packet
+	 * timeout/resend, frame retention, socket buffer) and GigE packet
+	 * size/delay settings are applied live, the rest waits for a reopen. */
+	bool SetConfig( const gvStreamConfig& config );
+	inline const gvStreamConfig& GetConfig() const { return mConfig; }
+
+	/* Statistics of the running stream, rates cover the time since the last call */
+	bool GetMetrics( gvStreamMetrics* metrics );
+
 	/* GigE Vision functions */
-	static void new_buffer_cb (ArvStream *stream, ApplicationData *data);
+	static void new_buffer_cb (ArvStream *stream, gvStream *self);
 	static void stream_cb (void *user_data, ArvStreamCallbackType type, ArvBuffer *buffer);
-	static gboolean periodic_task_cb (void *abstract_data);
-	static gboolean emit_software_trigger (void *abstract_data);
-	static void control_lost_cb (ArvGvDevice *gv_device);
-	static void set_cancel (int signal);
+	static void control_lost_cb (ArvGvDevice *gv_device, gvStream *self);
 private:
+	/* Mapped memory backing each ArvBuffer, indexed by the buffer user data */
+	struct poolEntry {
+		void *cpu;
+		void *cuda;
+	};
+
 	ArvPixelFormat videoType(int type);
     char *str_format(ArvPixelFormat format);
+	void softwareTriggerThread();
+	void releaseBuffer( ArvBuffer* buffer );
+	bool allocPool( size_t payload );
+	void freePool( std::vector<poolEntry>& pool );
+	bool waitFrame( std::unique_lock<std::mutex>& lock, unsigned long timeout );
+	void fillFrame( ArvBuffer* buffer, gvFrame* frame );
+	void applyStreamOptions();
+	void applyPacketOptions();
+
 	ApplicationData data;
 	ArvCamera *mCamera;
 	ArvStream *mStream;
-	guint software_trigger_source;
-	void (*old_sigint_handler)(int);
-	char *mGpuBuffer;
 	char tmp_str[200];
+
+	std::vector<poolEntry> mPool;
+
+	/* Frames popped from the stream, waiting for Acquire() */
+	std::deque<ArvBuffer*> mReadyBuffers;
+	/* Frame handed out by the last Capture(), released on the next one */
+	gvFrame mCurrentFrame;
+	/* Buffers handed out by Acquire() and not yet released */
+	std::vector<ArvBuffer*> mAcquired;
+	/* Acquired buffers that outlived Close(), and the pools backing them,
+	 * freed by the Release() of the last one */
+	std::vector<ArvBuffer*> mOrphaned;
+	std::vector<poolEntry> mOrphanedPool;
+	std::mutex mQueueMutex;
+	std::condition_variable mFrameEvent;
+	std::atomic<bool> mCancel;
+	unsigned int mFrame;
+
+	std::thread mTriggerThread;
+
+	gvStreamConfig mConfig;
+	std::mutex mConfigMutex;
+	/* mConfig.max_queued for the stream thread, which does not take mConfigMutex */
+	std::atomic<unsigned int> mMaxQueued;
+
+	/* Payload of completed frames, and the counters at the last GetMetrics() */
+	std::atomic<guint64> mBytesCompleted;
+	guint64 mLastBytes;
+	guint64 mLastFrames;
+	std::chrono::steady_clock::time_point mLastMetrics;
 };
 
 #endif
@@ -39,35 +39,12 @@ void error(char *msg) {
     exit(0);
 }
 
+// one line of RGB (PITCH bytes per pixel) to the YCbCr-4:2:2 pgroups of RFC 4175
 void rgbtoyuv(int y, int x, char* yuv, char* rgb)
 {
-  int c,cc,R,G,B,Y,U,V;
-  int size;
-
-  cc=0;
-  size = x*PITCH;
-  for (c=0;c<size;c+=PITCH)
-  {
-    R=rgb[c];
-    G=rgb[c+1];
-    B=rgb[c+2];
-    /* sample luma for every pixel */
-    Y  =      (0.257 * R) + (0.504 * G) + (0.098 * B) + 16;
-
-    yuv[cc+1]=Y;
-    if (c % 2 != 0)
+  static const mtsai::image::RgbToYuvCoeffs& k = mtsai::image::GetRgbToYuvCoeffs(mtsai::image::ColourSpace());
 
-    {
-        V =  (0.439 * R) - (0.368 * G) - (0.071 * B) + 128;
-        yuv[cc]=V;
-    }
-    else
-    {
-        U = -(0.148 * R) - (0.291 * G) + (0.439 * B) + 128;
-        yuv[cc]=U;
-    }
-    cc+=2;
-  }
+  mtsai::image::RGBtoUYVYRow((const uint8_t*)rgb, PITCH, (uint8_t*)yuv, x, k);
 }
 
 rtpStream::rtpStream(int height, int width) :
@@ -406,6 +383,14 @@ bool rtpStream::Capture( void** cpu, void** cuda, unsigned long timeout )
 #endif
 	*cpu = (void*)bufferIn;
 	*cuda = (void*)gpuBuffer;
+
+	// one UYVY line per RTP packet, reassembled without padding
+	mtsai::image::DescribeFrame(mtsai::image::FOURCC_UYVY, mWidth, mHeight, mWidth * 2, &mDescriptor);
+	mDescriptor.colour = GetColourSpace();
+	mDescriptor.captureTime = mtsai::image::FrameClockNow();
+	mDescriptor.sequence++;
+	mDescriptor.cpu = *cpu;
+	mDescriptor.cuda = *cuda;
 	return true;
 }
 
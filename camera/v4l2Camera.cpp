@@ -49,6 +49,8 @@ v4l2Camera::v4l2Camera( const char* device_path ) : mDevicePath(device_path)
 	mHeight     = 0;
 	mPitch      = 0;
 	mPixelDepth = 0;
+	mFourcc     = 0;
+	mSourceId   = mtsai::image::NewFrameSourceId();
 }
 
 
@@ -67,6 +69,21 @@ v4l2Camera::~v4l2Camera()
 // ProcessEmit
 void* v4l2Camera::Capture( size_t timeout )
 {
+	mtsai::image::FrameDescriptor frame;
+
+	if( !CaptureFrame(&frame, timeout) )
+		return NULL;
+
+	return frame.cpu;
+}
+
+
+// CaptureFrame
+bool v4l2Camera::CaptureFrame( mtsai::image::FrameDescriptor* frame, size_t timeout )
+{
+	if( !frame )
+		return false;
+
 	fd_set fds;
 	FD_ZERO(&fds);
 	FD_SET(mFD, &fds);
@@ -92,13 +109,13 @@ void* v4l2Camera::Capture( size_t timeout )
 	{
 		//if (EINTR == errno)
 		printf("v4l2 -- select() failed (errno=%i) (%s)\n", errno, strerror(errno));
-		return NULL;
+		return false;
 	}
 	else if( result == 0 )
 	{
 		if( timeout > 0 )
 			printf("v4l2 -- select() timed out...\n");
-		return NULL;	// timeout, not necessarily an error (TRY_AGAIN)
+		return false;	// timeout, not necessarily an error (TRY_AGAIN)
 	}
 
 	// dequeue input buffer from V4L2
@@ -111,25 +128,43 @@ void* v4l2Camera::Capture( size_t timeout )
 	if( xioctl(mFD, VIDIOC_DQBUF, &buf) < 0 )
 	{
 		printf("v4l2 -- ioctl(VIDIOC_DQBUF) failed (errno=%i) (%s)\n", errno, strerror(errno));
-		return NULL;
+		return false;
 	}
 	
 	if( buf.index >= mBufferCountMMap )
 	{
 		printf("v4l2 -- invalid mmap buffer index (%u)\n", buf.index);
-		return NULL;
+		return false;
 	}
 	
 	// emit ringbuffer entry
 	//printf("v4l2 -- recieved %ux%u video frame (index=%u)\n", mWidth, mHeight, (uint32_t)buf.index);
 
-	void* image_ptr = mBuffersMMap[buf.index].ptr;
+	// rows are bytesperline apart, not width * bpp
+	*frame = mtsai::image::FrameDescriptor();
+
+	if( !mtsai::image::DescribeFrame(mFourcc, mWidth, mHeight, mPitch, frame) )
+	{
+		// format without a known layout, still hand out the buffer
+		frame->fourcc           = mFourcc;
+		frame->width            = mWidth;
+		frame->height           = mHeight;
+		frame->planeCount       = 1;
+		frame->planes[0].stride = mPitch;
+	}
+
+	frame->size        = buf.bytesused;
+	frame->pts         = (uint64_t)buf.timestamp.tv_sec * 1000000000ull + (uint64_t)buf.timestamp.tv_usec * 1000ull;
+	frame->captureTime = mtsai::image::FrameClockNow();
+	frame->sequence    = buf.sequence;
+	frame->sourceId    = mSourceId;
+	frame->cpu         = mBuffersMMap[buf.index].ptr;
 
 	// re-queue buffer to V4L2
 	if( xioctl(mFD, VIDIOC_QBUF, &buf) < 0 )
 		printf("v4l2 -- ioctl(VIDIOC_QBUF) failed (errno=%i) (%s)\n", errno, strerror(errno));
 
-	return image_ptr;
+	return true;
 }
 
 
@@ -319,6 +354,7 @@ bool v4l2Camera::initStream()
 	mHeight     = fmt.fmt.pix.height;
 	mPitch      = fmt.fmt.pix.bytesperline;
 	mPixelDepth = (mPitch * 8) / mWidth;
+	mFourcc     = fmt.fmt.pix.pixelformat;
 
 	// initMMap
 	if( !initMMap() )		// initUserPtr()
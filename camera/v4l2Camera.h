@@ -12,6 +12,8 @@
 #include <string>
 #include <vector>
 
+#include "image/frame.h"
+
 
 
 struct v4l2_mmap
@@ -53,6 +55,13 @@ public:
 	 */
 	void* Capture( size_t timeout=0 );
 
+	/**
+	 * Return the next image with its layout (pitch from the driver), device
+	 * timestamp and sequence number. The mmap buffer is requeued right away,
+	 * same as Capture().
+	 */
+	bool CaptureFrame( mtsai::image::FrameDescriptor* frame, size_t timeout=0 );
+
 	/**
 	 * Get width, in pixels, of camera image.
 	 */
@@ -73,6 +82,11 @@ public:
 	 */
 	inline uint32_t GetPixelDepth() const				{ return mPixelDepth; }
 
+	/**
+	 * Return the V4L2 pixel format (fourcc) the device was configured with.
+	 */
+	inline uint32_t GetFourcc() const					{ return mFourcc; }
+
 private:
 
 	v4l2Camera( const char* device_path );
@@ -93,6 +107,8 @@ private:
 	uint32_t mHeight;
 	uint32_t mPitch;
 	uint32_t mPixelDepth;
+	uint32_t mFourcc;
+	uint32_t mSourceId;
 
 	v4l2_mmap* mBuffersMMap;
 	size_t mBufferCountMMap;
@@ -4,6 +4,7 @@
 
 #include "cudaFont.h"
 #include "cudaMappedMemory.h"
+#include "cudaPixel.h"
 
 #include "loadImage.h"
 
@@ -73,7 +74,7 @@ inline __host__ __device__ float4 operator*(float4 a, float4 b)
 }
 
 template<typename T>
-__global__ void gpuOverlayText( T* font, int fontWidth, short4* text,
+__global__ void gpuOverlayText( float4* font, int fontWidth, short4* text,
 						        T* output, int width, int height, float4 color ) 
 {
 	const short4 t = text[blockIdx.x];
@@ -91,23 +92,16 @@ __global__ void gpuOverlayText( T* font, int fontWidth, short4* text,
 
 	//printf("%i %i %i %i %i\n", blockIdx.x, x, y, u, v);
 	
-	const T px_font = font[v * fontWidth + u] * color;
-	      T px_out  = output[y * width + x];	// fixme:  add proper input support
+	const float4 px_font = font[v * fontWidth + u] * color;
+	const T      px_out  = output[y * width + x];	// fixme:  add proper input support
 
-	const float alpha = px_font.w / 255.0f;
-	const float ialph = 1.0f - alpha;
-	
-	px_out.x = alpha * px_font.x + ialph * px_out.x;
-	px_out.y = alpha * px_font.y + ialph * px_out.y;
-	px_out.z = alpha * px_font.z + ialph * px_out.z; 
-
-	output[y * width + x] = px_out;	 
+	output[y * width + x] = blend_pixel(px_out, px_font, px_font.w / 255.0f);
 }
 
 
 // processCUDA
 template<typename T>
-cudaError_t cudaOverlayText( T* font, const int2& fontCellSize, size_t fontMapWidth,
+cudaError_t cudaOverlayText( float4* font, const int2& fontCellSize, size_t fontMapWidth,
 					    const float4& fontColor, short4* text, size_t length,
 					    T* output, size_t width, size_t height)	
 {
@@ -120,14 +114,15 @@ cudaError_t cudaOverlayText( T* font, const int2& fontCellSize, size_t fontMapWi
 	const dim3 block(fontCellSize.x, fontCellSize.y);
 	const dim3 grid(length);
 
-	gpuOverlayText<<<grid, block>>>(font, fontMapWidth, text, output, width, height, color_scale); 
+	gpuOverlayText<T><<<grid, block>>>(font, fontMapWidth, text, output, width, height, color_scale); 
 
 	return cudaGetLastError();
 }
 
 
-// RenderOverlay
-bool cudaFont::RenderOverlay( float4* input, float4* output, uint32_t width, uint32_t height, const std::vector< std::pair< std::string, int2 > >& text, const float4& color )
+// renderOverlay
+template<typename T>
+bool cudaFont::renderOverlay( T* input, T* output, uint32_t width, uint32_t height, const std::vector< std::pair< std::string, int2 > >& text, const float4& color )
 {
 	if( !input || !output || width == 0 || height == 0 || text.size() == 0 )
 		return false;
@@ -161,7 +156,7 @@ bool cudaFont::RenderOverlay( float4* input, float4* output, uint32_t width, uin
 		}
 	}
 
-	CUDA(cudaOverlayText<float4>( mFontMapGPU, mFontCellSize, mFontMapWidth, color,
+	CUDA(cudaOverlayText<T>( mFontMapGPU, mFontCellSize, mFontMapWidth, color,
 				        mCommandGPU, mCmdEntries, 
 				       output, width, height));
 					   
@@ -170,6 +165,18 @@ bool cudaFont::RenderOverlay( float4* input, float4* output, uint32_t width, uin
 }
 
 
+// RenderOverlay
+bool cudaFont::RenderOverlay( float4* input, float4* output, uint32_t width, uint32_t height, const std::vector< std::pair< std::string, int2 > >& text, const float4& color )
+{
+	return renderOverlay(input, output, width, height, text, color);
+}
+
+bool cudaFont::RenderOverlay( uchar4* input, uchar4* output, uint32_t width, uint32_t height, const std::vector< std::pair< std::string, int2 > >& text, const float4& color )
+{
+	return renderOverlay(input, output, width, height, text, color);
+}
+
+
 bool cudaFont::RenderOverlay( float4* input, float4* output, uint32_t width, uint32_t height, 
 							  const char* str, int x, int y, const float4& color )
 {
@@ -182,5 +189,18 @@ bool cudaFont::RenderOverlay( float4* input, float4* output, uint32_t width, uin
 	
 	return RenderOverlay(input, output, width, height, list, color);
 }
+
+bool cudaFont::RenderOverlay( uchar4* input, uchar4* output, uint32_t width, uint32_t height, 
+							  const char* str, int x, int y, const float4& color )
+{
+	if( !str )
+		return false;
+		
+	std::vector< std::pair< std::string, int2 > > list;
+	
+	list.push_back( std::pair< std::string, int2 >( str, make_int2(x,y) ));
+	
+	return RenderOverlay(input, output, width, height, list, color);
+}
 						
 	
@@ -39,8 +39,22 @@ public:
 	bool RenderOverlay( float4* input, float4* output, uint32_t width, uint32_t height, 
 						const std::vector< std::pair< std::string, int2 > >& text,
 						const float4& color=make_float4(0.0f, 0.0f, 0.0f, 255.0f));
+
+	/**
+	 * Draw font overlay onto an 8 bit image (the working format)
+	 */
+	bool RenderOverlay( uchar4* input, uchar4* output, uint32_t width, uint32_t height, 
+						const char* str, int x, int y, const float4& color=make_float4(0, 0, 0, 255));
+
+	bool RenderOverlay( uchar4* input, uchar4* output, uint32_t width, uint32_t height, 
+						const std::vector< std::pair< std::string, int2 > >& text,
+						const float4& color=make_float4(0.0f, 0.0f, 0.0f, 255.0f));
 	
 protected:
+	template<typename T>
+	bool renderOverlay( T* input, T* output, uint32_t width, uint32_t height,
+						const std::vector< std::pair< std::string, int2 > >& text, const float4& color );
+
 	cudaFont();
 	bool init( const char* bitmap_path );
 
@@ -3,12 +3,13 @@
  */
 
 #include "cudaNormalize.h"
+#include "cudaPixel.h"
 
 
 
 // gpuNormalize
-template <typename T>
-__global__ void gpuNormalize( T* input, T* output, int width, int height, float scaling_factor )
+template <typename T, typename O>
+__global__ void gpuNormalize( T* input, O* output, int width, int height, float scaling_factor )
 {
 	const int x = blockIdx.x * blockDim.x + threadIdx.x;
 	const int y = blockIdx.y * blockDim.y + threadIdx.y;
@@ -16,18 +17,19 @@ __global__ void gpuNormalize( T* input, T* output, int width, int height, float
 	if( x >= width || y >= height )
 		return;
 
-	const T px = input[ y * width + x ];
+	const float4 px = pixel_to_float4(input[ y * width + x ]);
 
-	output[y*width+x] = make_float4(px.x * scaling_factor,
+	output[y*width+x] = make_pixel<O>(px.x * scaling_factor,
 							  px.y * scaling_factor,
 							  px.z * scaling_factor,
 							  px.w * scaling_factor);
 }
 
 
-// cudaNormalizeRGBA
-cudaError_t cudaNormalizeRGBA( float4* input, const float2& input_range,
-						 float4* output, const float2& output_range,
+// launchNormalize
+template <typename T, typename O>
+static cudaError_t launchNormalize( T* input, const float2& input_range,
+						 O* output, const float2& output_range,
 						 size_t  width,  size_t height )
 {
 	if( !input || !output )
@@ -42,12 +44,30 @@ cudaError_t cudaNormalizeRGBA( float4* input, const float2& input_range,
 	const dim3 blockDim(8, 8);
 	const dim3 gridDim(iDivUp(width,blockDim.x), iDivUp(height,blockDim.y));
 
-	gpuNormalize<float4><<<gridDim, blockDim>>>(input, output, width, height, multiplier);
+	gpuNormalize<T, O><<<gridDim, blockDim>>>(input, output, width, height, multiplier);
 
 	return CUDA(cudaGetLastError());
 }
 
 
+// cudaNormalizeRGBA
+cudaError_t cudaNormalizeRGBA( float4* input, const float2& input_range,
+						 float4* output, const float2& output_range,
+						 size_t  width,  size_t height )
+{
+	return launchNormalize(input, input_range, output, output_range, width, height);
+}
 
+cudaError_t cudaNormalizeRGBA( uchar4* input, const float2& input_range,
+						 float4* output, const float2& output_range,
+						 size_t  width,  size_t height )
+{
+	return launchNormalize(input, input_range, output, output_range, width, height);
+}
 
-
+cudaError_t cudaNormalizeRGBA( uchar4* input, const float2& input_range,
+						 uchar4* output, const float2& output_range,
+						 size_t  width,  size_t height )
+{
+	return launchNormalize(input, input_range, output, output_range, width, height);
+}
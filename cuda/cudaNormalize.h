@@ -17,5 +17,17 @@ cudaError_t cudaNormalizeRGBA( float4* input,  const float2& input_range,
 						 float4* output, const float2& output_range,
 						 size_t  width,  size_t height );
 
+/**
+ * 8 bit input, either widened to float4 for inference or rescaled
+ * in place of the working uchar4 image (alpha is kept opaque).
+ */
+cudaError_t cudaNormalizeRGBA( uchar4* input,  const float2& input_range,
+						 float4* output, const float2& output_range,
+						 size_t  width,  size_t height );
+
+cudaError_t cudaNormalizeRGBA( uchar4* input,  const float2& input_range,
+						 uchar4* output, const float2& output_range,
+						 size_t  width,  size_t height );
+
 #endif
 
@@ -3,6 +3,7 @@
  */
 
 #include "cudaOverlay.h"
+#include "cudaPixel.h"
 
 
 static inline __device__ __host__ bool eq_less( float a, float b, float epsilon )
@@ -28,7 +29,6 @@ __global__ void gpuRectOutlines( T* input, T* output, int width, int height,
 	
 	const float thick = 10.0f;
 	const float alpha = color.w / 255.0f;
-	const float ialph = 1.0f - alpha;
 	
 	for( int nr=0; nr < numRects; nr++ )
 	{
@@ -42,9 +42,7 @@ __global__ void gpuRectOutlines( T* input, T* output, int width, int height,
 			{
 				//printf("cuda rect %i %i\n", x, y);
 
-				px_out.x = alpha * color.x + ialph * px_out.x;
-				px_out.y = alpha * color.y + ialph * px_out.y;
-				px_out.z = alpha * color.z + ialph * px_out.z;
+				px_out = blend_pixel(px_out, color, alpha);
 			}
 		}
 	}
@@ -53,7 +51,8 @@ __global__ void gpuRectOutlines( T* input, T* output, int width, int height,
 }
 
 
-cudaError_t cudaRectOutlineOverlay( float4* input, float4* output, uint32_t width, uint32_t height, float4* boundingBoxes, int numBoxes, const float4& color )
+template<typename T>
+static cudaError_t launchRectOutlines( T* input, T* output, uint32_t width, uint32_t height, float4* boundingBoxes, int numBoxes, const float4& color )
 {
 	if( !input || !output || width == 0 || height == 0 || !boundingBoxes || numBoxes == 0 )
 		return cudaErrorInvalidValue;
@@ -62,7 +61,17 @@ cudaError_t cudaRectOutlineOverlay( float4* input, float4* output, uint32_t widt
 	const dim3 blockDim(8, 8);
 	const dim3 gridDim(iDivUp(width,blockDim.x), iDivUp(height,blockDim.y));
 
-	gpuRectOutlines<float4><<<gridDim, blockDim>>>(input, output, width, height, boundingBoxes, numBoxes, color); 
+	gpuRectOutlines<T><<<gridDim, blockDim>>>(input, output, width, height, boundingBoxes, numBoxes, color); 
 
 	return cudaGetLastError();
 }
+
+cudaError_t cudaRectOutlineOverlay( float4* input, float4* output, uint32_t width, uint32_t height, float4* boundingBoxes, int numBoxes, const float4& color )
+{
+	return launchRectOutlines(input, output, width, height, boundingBoxes, numBoxes, color);
+}
+
+cudaError_t cudaRectOutlineOverlay( uchar4* input, uchar4* output, uint32_t width, uint32_t height, float4* boundingBoxes, int numBoxes, const float4& color )
+{
+	return launchRectOutlines(input, output, width, height, boundingBoxes, numBoxes, color);
+}
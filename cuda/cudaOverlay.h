@@ -10,8 +10,12 @@
 
 /**
  * cudaRectOutlineOverlay
+ * boxes are (left, top, right, bottom), color is 0-255 with the blend alpha in w
+ * fills the boxes and tests every box per pixel, mtsai::image::RectOverlay
+ * (image/overlay.h) draws outlines and only visits the tiles a box touches
  */
 cudaError_t cudaRectOutlineOverlay( float4* input, float4* output, uint32_t width, uint32_t height, float4* boundingBoxes, int numBoxes, const float4& color );
+cudaError_t cudaRectOutlineOverlay( uchar4* input, uchar4* output, uint32_t width, uint32_t height, float4* boundingBoxes, int numBoxes, const float4& color );
 
 
 /**
@@ -0,0 +1,58 @@
+/*
+ * Pixel type helpers for kernels templated on uchar4 / float4
+ */
+
+#ifndef __CUDA_PIXEL_H__
+#define __CUDA_PIXEL_H__
+
+#include "cudaUtility.h"
+
+
+/**
+ * Build a pixel from float components (intensity 0-255).
+ * uchar4 is rounded and saturated, its alpha is always opaque.
+ */
+template<typename T>
+inline __device__ T make_pixel( float r, float g, float b, float a );
+
+template<>
+inline __device__ float4 make_pixel<float4>( float r, float g, float b, float a )
+{
+	return make_float4(r, g, b, a);
+}
+
+template<>
+inline __device__ uchar4 make_pixel<uchar4>( float r, float g, float b, float a )
+{
+	return make_uchar4(__float2uint_rn(fminf(fmaxf(r, 0.0f), 255.0f)),
+					   __float2uint_rn(fminf(fmaxf(g, 0.0f), 255.0f)),
+					   __float2uint_rn(fminf(fmaxf(b, 0.0f), 255.0f)),
+					   255);
+}
+
+
+/**
+ * Read a pixel as float components
+ */
+inline __device__ float4 pixel_to_float4( const float4& px )	{ return px; }
+inline __device__ float4 pixel_to_float4( const uchar4& px )	{ return make_float4(px.x, px.y, px.z, px.w); }
+
+
+/**
+ * Blend color over px by alpha (0-1), keeps the alpha of px
+ */
+template<typename T>
+inline __device__ T blend_pixel( const T& px, const float4& color, float alpha )
+{
+	const float4 in = pixel_to_float4(px);
+	const float ialph = 1.0f - alpha;
+
+	T out = make_pixel<T>(alpha * color.x + ialph * in.x,
+						  alpha * color.y + ialph * in.y,
+						  alpha * color.z + ialph * in.z,
+						  in.w);
+	out.w = px.w;
+	return out;
+}
+
+#endif
@@ -4,11 +4,13 @@
 
 #include <math_functions.h>
 #include "cudaRGB.h"
+#include "cudaPixel.h"
 
 //-------------------------------------------------------------------------------------------------------------------------
 
+template<typename T>
 __global__ void RGBToRGBAf(uint8_t* srcImage,
-                           float4* dstImage,
+                           T* dstImage,
                            uint32_t width,       uint32_t height)
 {
     int x, y, pixel;
@@ -26,10 +28,11 @@ __global__ void RGBToRGBAf(uint8_t* srcImage,
 //	printf("cuda thread %i %i  %i %i pixel %i \n", x, y, width, height, pixel);
 
 	const float s = 1;
-	dstImage[pixel]     = make_float4(srcImage[pixel*3] * s, srcImage[ pixel*3 + 1] * s, srcImage[ pixel*3 + 2] * s, 0.0f);
+	dstImage[pixel]     = make_pixel<T>(srcImage[pixel*3] * s, srcImage[ pixel*3 + 1] * s, srcImage[ pixel*3 + 2] * s, 0.0f);
 }
 
-cudaError_t cudaRGBToRGBAf( uint8_t* srcDev, float4* destDev, size_t width, size_t height )
+template<typename T>
+static cudaError_t launchRGBToRGBA( uint8_t* srcDev, T* destDev, size_t width, size_t height )
 {
 	if( !srcDev || !destDev )
 		return cudaErrorInvalidDevicePointer;
@@ -37,16 +40,27 @@ cudaError_t cudaRGBToRGBAf( uint8_t* srcDev, float4* destDev, size_t width, size
 	const dim3 blockDim(128,1,1);
 	const dim3 gridDim(width/blockDim.x, height/blockDim.y, 1);
 
-	RGBToRGBAf<<<gridDim, blockDim>>>( (uint8_t*)srcDev, destDev, width, height );
+	RGBToRGBAf<T><<<gridDim, blockDim>>>( (uint8_t*)srcDev, destDev, width, height );
 
 	return CUDA(cudaGetLastError());
 }
 
+cudaError_t cudaRGBToRGBAf( uint8_t* srcDev, float4* destDev, size_t width, size_t height )
+{
+	return launchRGBToRGBA(srcDev, destDev, width, height);
+}
+
+cudaError_t cudaRGBToRGBA8( uint8_t* srcDev, uchar4* destDev, size_t width, size_t height )
+{
+	return launchRGBToRGBA(srcDev, destDev, width, height);
+}
+
 
 //-------------------------------------------------------------------------------------------------------------------------
 
+template<typename T>
 __global__ void BAYER_GR8toRGBA(uint8_t* srcImage,
-                           float4* dstImage,
+                           T* dstImage,
                            uint32_t width,       uint32_t height)
 {
     int x, y, pixel;
@@ -83,13 +97,13 @@ __global__ void BAYER_GR8toRGBA(uint8_t* srcImage,
 	{
 		int r = srcImage[pixel-1] + srcImage[pixel+1] /2;
 		int b = srcImage[pixel+width]; // + srcImage[pixel-width+1] + srcImage[pixel-width-1] / 4;
-		dstImage[pixel] = make_float4(r, srcImage[pixel], b, 0.0f); // Green Info
+		dstImage[pixel] = make_pixel<T>(r, srcImage[pixel], b, 0.0f); // Green Info
 	}
 	else if ((lineOdd) && (!pixelOdd))   
 	{
 		int g = srcImage[pixel-1] + srcImage[pixel+1] /2;
 		int b = srcImage[pixel+width-1] + srcImage[pixel+width+1] / 2;
-		dstImage[pixel] = make_float4(srcImage[pixel], g, b, 0.0f); // Red Info
+		dstImage[pixel] = make_pixel<T>(srcImage[pixel], g, b, 0.0f); // Red Info
 	}
 
 	// Even lines
@@ -97,22 +111,23 @@ __global__ void BAYER_GR8toRGBA(uint8_t* srcImage,
 	{
 		int g = srcImage[pixel+1] + srcImage[pixel-1] / 2;
 		int r = srcImage[pixel+width-1] + srcImage[pixel+width+1] / 2;
-		dstImage[pixel] = make_float4(r, g, srcImage[pixel], 0.0f); // Blue Info
+		dstImage[pixel] = make_pixel<T>(r, g, srcImage[pixel], 0.0f); // Blue Info
 	}
 	else if ((!lineOdd) && (!pixelOdd)) 
 	{
 		int b = srcImage[pixel+1] + srcImage[pixel-1] / 2;
 		int r = srcImage[pixel+width] + srcImage[pixel+width] / 2;
-		dstImage[pixel] = make_float4(r, srcImage[pixel], b, 0.0f); // Green Info
+		dstImage[pixel] = make_pixel<T>(r, srcImage[pixel], b, 0.0f); // Green Info
 	}
 
 #else
 	// Monochrome output
-	dstImage[pixel]     = make_float4(srcImage[pixel], srcImage[ pixel], srcImage[ pixel], 0.0f);
+	dstImage[pixel]     = make_pixel<T>(srcImage[pixel], srcImage[ pixel], srcImage[ pixel], 0.0f);
 #endif
 }
 
-cudaError_t cudaBAYER_GR8toRGBA( uint8_t* srcDev, float4* destDev, size_t width, size_t height )
+template<typename T>
+static cudaError_t launchBAYER_GR8toRGBA( uint8_t* srcDev, T* destDev, size_t width, size_t height )
 {
 	if( !srcDev || !destDev )
 		return cudaErrorInvalidDevicePointer;
@@ -120,9 +135,19 @@ cudaError_t cudaBAYER_GR8toRGBA( uint8_t* srcDev, float4* destDev, size_t width,
 	const dim3 blockDim(128,1,1);
 	const dim3 gridDim(width/blockDim.x, height/blockDim.y, 1);
 
-	BAYER_GR8toRGBA<<<gridDim, blockDim>>>( (uint8_t*)srcDev, destDev, width, height );
+	BAYER_GR8toRGBA<T><<<gridDim, blockDim>>>( (uint8_t*)srcDev, destDev, width, height );
 
 	return CUDA(cudaGetLastError());
 }
 
+cudaError_t cudaBAYER_GR8toRGBA( uint8_t* srcDev, float4* destDev, size_t width, size_t height )
+{
+	return launchBAYER_GR8toRGBA(srcDev, destDev, width, height);
+}
+
+cudaError_t cudaBAYER_GR8toRGBA8( uint8_t* srcDev, uchar4* destDev, size_t width, size_t height )
+{
+	return launchBAYER_GR8toRGBA(srcDev, destDev, width, height);
+}
+
 
@@ -17,6 +17,10 @@
 cudaError_t cudaRGBToRGBAf( uint8_t* input, float4* output, size_t width, size_t height );
 cudaError_t cudaBAYER_GR8toRGBA( uint8_t* input, float4* output, size_t width, size_t height );
 
+// 8 bit RGBA (rounded, saturated, alpha 255), the working format
+cudaError_t cudaRGBToRGBA8( uint8_t* input, uchar4* output, size_t width, size_t height );
+cudaError_t cudaBAYER_GR8toRGBA8( uint8_t* input, uchar4* output, size_t width, size_t height );
+
 
 #endif
 
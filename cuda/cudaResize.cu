@@ -6,9 +6,21 @@
 
 
 
-// gpuResample
+// lerp
+inline __device__ float lerp( float a, float b, float w )
+{
+	return a + (b - a) * w;
+}
+
+inline __device__ float4 lerp( float4 a, float4 b, float w )
+{
+	return make_float4(lerp(a.x, b.x, w), lerp(a.y, b.y, w), lerp(a.z, b.z, w), lerp(a.w, b.w, w));
+}
+
+
+// gpuResize (bilinear, centre aligned like mtsai::image::Resizer)
 template <typename T>
-__global__ void gpuResize( float2 scale, T* input, int iWidth, T* output, int oWidth, int oHeight )
+__global__ void gpuResize( float2 scale, T* input, int iWidth, int iHeight, T* output, int oWidth, int oHeight )
 {
 	const int x = blockIdx.x * blockDim.x + threadIdx.x;
 	const int y = blockIdx.y * blockDim.y + threadIdx.y;
@@ -16,12 +28,18 @@ __global__ void gpuResize( float2 scale, T* input, int iWidth, T* output, int oW
 	if( x >= oWidth || y >= oHeight )
 		return;
 
-	const int dx = ((float)x * scale.x);
-	const int dy = ((float)y * scale.y);
+	const float px = fminf(fmaxf((x + 0.5f) * scale.x - 0.5f, 0.0f), (float)(iWidth - 1));
+	const float py = fminf(fmaxf((y + 0.5f) * scale.y - 0.5f, 0.0f), (float)(iHeight - 1));
+
+	const int x0 = (int)px;
+	const int y0 = (int)py;
+	const int x1 = min(x0 + 1, iWidth - 1);
+	const int y1 = min(y0 + 1, iHeight - 1);
 
-	const T px = input[ dy * iWidth + dx ];
+	const T top    = lerp(input[y0 * iWidth + x0], input[y0 * iWidth + x1], px - x0);
+	const T bottom = lerp(input[y1 * iWidth + x0], input[y1 * iWidth + x1], px - x0);
 
-	output[y*oWidth+x] = px;
+	output[y*oWidth+x] = lerp(top, bottom, py - y0);
 }
 
 
@@ -42,7 +60,7 @@ cudaError_t cudaResize( float* input, size_t inputWidth, size_t inputHeight,
 	const dim3 blockDim(8, 8);
 	const dim3 gridDim(iDivUp(outputWidth,blockDim.x), iDivUp(outputHeight,blockDim.y));
 
-	gpuResize<float><<<gridDim, blockDim>>>(scale, input, inputWidth, output, outputWidth, outputHeight);
+	gpuResize<float><<<gridDim, blockDim>>>(scale, input, inputWidth, inputHeight, output, outputWidth, outputHeight);
 
 	return CUDA(cudaGetLastError());
 }
@@ -65,7 +83,7 @@ cudaError_t cudaResizeRGBA( float4* input,  size_t inputWidth, size_t inputHeigh
 	const dim3 blockDim(8, 8);
 	const dim3 gridDim(iDivUp(outputWidth,blockDim.x), iDivUp(outputHeight,blockDim.y));
 
-	gpuResize<float4><<<gridDim, blockDim>>>(scale, input, inputWidth, output, outputWidth, outputHeight);
+	gpuResize<float4><<<gridDim, blockDim>>>(scale, input, inputWidth, inputHeight, output, outputWidth, outputHeight);
 
 	return CUDA(cudaGetLastError());
 }
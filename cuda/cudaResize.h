@@ -10,14 +10,16 @@
 
 
 /**
- * Function for increasing or decreasing the size of an image on the GPU.
+ * Function for increasing or decreasing the size of an image on the GPU,
+ * bilinear sampling. See mtsai::image::Resizer for area averaging on the CPU.
  */
 cudaError_t cudaResize( float* input,  size_t inputWidth,  size_t inputHeight,
 				    float* output, size_t outputWidth, size_t outputHeight );
 
 
 /**
- * Function for increasing or decreasing the size of an image on the GPU.
+ * Function for increasing or decreasing the size of an image on the GPU,
+ * bilinear sampling.
  */
 cudaError_t cudaResizeRGBA( float4* input,  size_t inputWidth,  size_t inputHeight,
 				        float4* output, size_t outputWidth, size_t outputHeight );
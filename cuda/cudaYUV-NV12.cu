@@ -3,6 +3,9 @@
  */
 
 #include "cudaYUV.h"
+#include "cudaPixel.h"
+
+using mtsai::image::YuvToRgbCoeffs;
 
 
 #define COLOR_COMPONENT_MASK            0x3FF
@@ -21,71 +24,26 @@ __constant__ float  constHueColorSpaceMat[9];
 
 #define LIMIT_RGB(x)    (((x)<0)?0:((x)>255)?255:(x))
 
-__device__ void YUV2RGB(uint32_t *yuvi, float *red, float *green, float *blue)
+// 10 bit packed components (8 bit values << 2) through the shared fixed point core
+__device__ void YUV2RGB(const YuvToRgbCoeffs& k, uint32_t *yuvi, float *red, float *green, float *blue)
 {
-   
-
-    // Prepare for hue adjustment
-    /*
-	 float luma, chromaCb, chromaCr;
-
-	luma     = (float)yuvi[0];
-    chromaCb = (float)((int)yuvi[1] - 512.0f);
-    chromaCr = (float)((int)yuvi[2] - 512.0f);
-
-    // Convert YUV To RGB with hue adjustment
-    *red  = MUL(luma,     constHueColorSpaceMat[0]) +
-            MUL(chromaCb, constHueColorSpaceMat[1]) +
-            MUL(chromaCr, constHueColorSpaceMat[2]);
-    *green= MUL(luma,     constHueColorSpaceMat[3]) +
-            MUL(chromaCb, constHueColorSpaceMat[4]) +
-            MUL(chromaCr, constHueColorSpaceMat[5]);
-    *blue = MUL(luma,     constHueColorSpaceMat[6]) +
-            MUL(chromaCb, constHueColorSpaceMat[7]) +
-            MUL(chromaCr, constHueColorSpaceMat[8]);*/
-
-	const float luma = float(yuvi[0]);
-	const float u    = float(yuvi[1]) - 512.0f;
-	const float v    = float(yuvi[2]) - 512.0f;
-
-//printf("YUV luma=%f, u=%f, v=%f\n", luma, u, v);
-
-   /*R = Y + 1.140V
-   G = Y - 0.395U - 0.581V
-   B = Y + 2.032U*/
-
-	/**green = luma + 1.140f * v;
-	*blue  = luma - 0.395f * u - 0.581f * v;
-	*red   = luma + 2.032f * u;*/
-
-	*red    = luma + 1.140f * v;
-	*green  = luma - 0.395f * u - 0.581f * v;
-	*blue   = luma + 2.032f * u;
-//printf("RGB luma=%f, u=%f, v=%f\n", *red , *green, *blue);
+	uint8_t r, g, b;
+	mtsai::image::YuvToRgb(k, yuvi[0] >> 2, yuvi[1] >> 2, yuvi[2] >> 2, &r, &g, &b);
+
+	*red   = (float)r;
+	*green = (float)g;
+	*blue  = (float)b;
 }
 
 
-__device__ void YUV82RGB(uint8_t *yuvi, float *red, float *green, float *blue)
+__device__ void YUV82RGB(const YuvToRgbCoeffs& k, uint8_t *yuvi, float *red, float *green, float *blue)
 {
-	const float y0 = float(yuvi[0]);
-	const float cb0    = float(yuvi[1]);
-	const float cr0    = float(yuvi[2]);
-
-//printf("YUV luma=%f, u=%f, v=%f\n", y0, cb0, cr0);
-
-	unsigned char r0(LIMIT_RGB(round((298.082 * y0) / 256.0 + (408.583 * cr0) / 256.0 - 222.921)));
-
-
-	unsigned char g0(LIMIT_RGB(round((298.082 * y0) / 256.0 - (100.291 * cb0) / 256.0
-			- (208.120 * cr0) / 256.0 + 135.576)));
-
+	uint8_t r, g, b;
+	mtsai::image::YuvToRgb(k, yuvi[0], yuvi[1], yuvi[2], &r, &g, &b);
 
-	unsigned char b0(LIMIT_RGB(round((298.082 * y0) / 256.0 + (516.412 * cb0) / 256.0 - 276.836)));
-
-	*red    = (float)r0;
-	*green  = (float)g0;
-	*blue   = (float)b0;
-//printf("RGB red=%f, green=%f, blue=%f\n", *red , *green, *blue);
+	*red   = (float)r;
+	*green = (float)g;
+	*blue  = (float)b;
 }
 
 __device__ uint32_t RGBAPACK_8bit(float red, float green, float blue, uint32_t alpha)
@@ -169,7 +127,8 @@ __global__ void Passthru(uint32_t *srcImage,   size_t nSourcePitch,
 /*extern "C"*/
 __global__ void NV12ToARGB(uint32_t *srcImage,     size_t nSourcePitch,
                            uint32_t *dstImage,     size_t nDestPitch,
-                           uint32_t width,         uint32_t height)
+                           uint32_t width,         uint32_t height,
+                           YuvToRgbCoeffs k)
 {
     int x, y;
     uint32_t yuv101010Pel[2];
@@ -239,12 +198,12 @@ __global__ void NV12ToARGB(uint32_t *srcImage,     size_t nSourcePitch,
     yuvi[5] = ((yuv101010Pel[1] >> (COLOR_COMPONENT_BIT_SIZE << 1)) & COLOR_COMPONENT_MASK);
 
     // YUV to RGB Transformation conversion
-    YUV2RGB(&yuvi[0], &red[0], &green[0], &blue[0]);
-    YUV2RGB(&yuvi[3], &red[1], &green[1], &blue[1]);
+    YUV2RGB(k, &yuvi[0], &red[0], &green[0], &blue[0]);
+    YUV2RGB(k, &yuvi[3], &red[1], &green[1], &blue[1]);
 
     // Clamp the results to RGBA
-    dstImage[y * dstImagePitch + x     ] = RGBAPACK_10bit(red[0], green[0], blue[0], constAlpha);
-    dstImage[y * dstImagePitch + x + 1 ] = RGBAPACK_10bit(red[1], green[1], blue[1], constAlpha);
+    dstImage[y * dstImagePitch + x     ] = RGBAPACK_8bit(red[0], green[0], blue[0], constAlpha);
+    dstImage[y * dstImagePitch + x + 1 ] = RGBAPACK_8bit(red[1], green[1], blue[1], constAlpha);
 }
 
 
@@ -252,7 +211,7 @@ bool nv12ColorspaceSetup = false;
 
 
 // cudaNV12ToARGB32
-cudaError_t cudaNV12ToRGBA( uint8_t* srcDev, size_t srcPitch, uchar4* destDev, size_t destPitch, size_t width, size_t height )
+cudaError_t cudaNV12ToRGBA( uint8_t* srcDev, size_t srcPitch, uchar4* destDev, size_t destPitch, size_t width, size_t height, const mtsai::image::ColourSpace& colour )
 {
 	if( !srcDev || !destDev )
 		return cudaErrorInvalidDevicePointer;
@@ -266,22 +225,25 @@ cudaError_t cudaNV12ToRGBA( uint8_t* srcDev, size_t srcPitch, uchar4* destDev, s
 	const dim3 blockDim(32,16,1);
 	const dim3 gridDim((width+(2*blockDim.x-1))/(2*blockDim.x), (height+(blockDim.y-1))/blockDim.y, 1);
 
-	NV12ToARGB<<<gridDim, blockDim>>>( (uint32_t*)srcDev, srcPitch, (uint32_t*)destDev, destPitch, width, height );
+	NV12ToARGB<<<gridDim, blockDim>>>( (uint32_t*)srcDev, srcPitch, (uint32_t*)destDev, destPitch, width, height,
+	                                   mtsai::image::GetYuvToRgbCoeffs(colour) );
 	
 	return CUDA(cudaGetLastError());
 }
 
-cudaError_t cudaNV12ToRGBA( uint8_t* srcDev, uchar4* destDev, size_t width, size_t height )
+cudaError_t cudaNV12ToRGBA( uint8_t* srcDev, uchar4* destDev, size_t width, size_t height, const mtsai::image::ColourSpace& colour )
 {
-	return cudaNV12ToRGBA(srcDev, width * sizeof(uint8_t), destDev, width * sizeof(uchar4), width, height);
+	return cudaNV12ToRGBA(srcDev, width * sizeof(uint8_t), destDev, width * sizeof(uchar4), width, height, colour);
 }
 
 
 //-------------------------------------------------------------------------------------------------------------------------
 
+template<typename T>
 __global__ void NV12ToRGBAf(uint32_t* srcImage,  size_t nSourcePitch,
-                           float4* dstImage,     size_t nDestPitch,
-                           uint32_t width,       uint32_t height)
+                           T* dstImage,          size_t nDestPitch,
+                           uint32_t width,       uint32_t height,
+                           YuvToRgbCoeffs k)
 {
     int x, y;
     uint32_t yuv101010Pel[2];
@@ -351,28 +313,28 @@ __global__ void NV12ToRGBAf(uint32_t* srcImage,  size_t nSourcePitch,
     yuvi[5] = ((yuv101010Pel[1] >> (COLOR_COMPONENT_BIT_SIZE << 1)) & COLOR_COMPONENT_MASK);
 
     // YUV to RGB Transformation conversion
-    YUV2RGB(&yuvi[0], &red[0], &green[0], &blue[0]);
-    YUV2RGB(&yuvi[3], &red[1], &green[1], &blue[1]);
+    YUV2RGB(k, &yuvi[0], &red[0], &green[0], &blue[0]);
+    YUV2RGB(k, &yuvi[3], &red[1], &green[1], &blue[1]);
 
     // Clamp the results to RGBA
 	//printf("cuda thread %i %i  %f %f %f\n", x, y, red[0], green[0], blue[0]);
 
-	const float s = 1.0f / 1024.0f * 255.0f;
-
-	dstImage[y * width + x]     = make_float4(red[0] * s, green[0] * s, blue[0] * s, 1.0f);
-	dstImage[y * width + x + 1] = make_float4(red[1] * s, green[1] * s, blue[1] * s, 1.0f);
+	dstImage[y * width + x]     = make_pixel<T>(red[0], green[0], blue[0], 1.0f);
+	dstImage[y * width + x + 1] = make_pixel<T>(red[1], green[1], blue[1], 1.0f);
 #else
 	//printf("cuda thread %i %i  %i %i \n", x, y, width, height);
 		
-	dstImage[y * width + x]     = make_float4(1.0f, 0.0f, 0.0f, 1.0f);
-	dstImage[y * width + x + 1] = make_float4(1.0f, 0.0f, 0.0f, 1.0f);
+	dstImage[y * width + x]     = make_pixel<T>(1.0f, 0.0f, 0.0f, 1.0f);
+	dstImage[y * width + x + 1] = make_pixel<T>(1.0f, 0.0f, 0.0f, 1.0f);
 #endif
 }
 
 
 
-// cudaNV12ToRGBA
-cudaError_t cudaNV12ToRGBAf( uint8_t* srcDev, size_t srcPitch, float4* destDev, size_t destPitch, size_t width, size_t height )
+// launchNV12ToRGBA
+template<typename T>
+static cudaError_t launchNV12ToRGBA( uint8_t* srcDev, size_t srcPitch, T* destDev, size_t destPitch, size_t width, size_t height,
+                                    const mtsai::image::ColourSpace& colour )
 {
 	if( !srcDev || !destDev )
 		return cudaErrorInvalidDevicePointer;
@@ -387,23 +349,43 @@ cudaError_t cudaNV12ToRGBAf( uint8_t* srcDev, size_t srcPitch, float4* destDev,
 	//const dim3 gridDim((width+(2*blockDim.x-1))/(2*blockDim.x), (height+(blockDim.y-1))/blockDim.y, 1);
 	const dim3 gridDim(iDivUp(width,blockDim.x), iDivUp(height, blockDim.y), 1);
 
-	NV12ToRGBAf<<<gridDim, blockDim>>>( (uint32_t*)srcDev, srcPitch, destDev, destPitch, width, height );
+	NV12ToRGBAf<T><<<gridDim, blockDim>>>( (uint32_t*)srcDev, srcPitch, destDev, destPitch, width, height,
+	                                       mtsai::image::GetYuvToRgbCoeffs(colour) );
 	
 	return CUDA(cudaGetLastError());
 }
 
-cudaError_t cudaNV12ToRGBAf( uint8_t* srcDev, float4* destDev, size_t width, size_t height )
+// cudaNV12ToRGBAf
+cudaError_t cudaNV12ToRGBAf( uint8_t* srcDev, size_t srcPitch, float4* destDev, size_t destPitch, size_t width, size_t height, const mtsai::image::ColourSpace& colour )
 {
-	return cudaNV12ToRGBAf(srcDev, width * sizeof(uint8_t), destDev, width * sizeof(float4), width, height);
+	return launchNV12ToRGBA(srcDev, srcPitch, destDev, destPitch, width, height, colour);
+}
+
+cudaError_t cudaNV12ToRGBAf( uint8_t* srcDev, float4* destDev, size_t width, size_t height, const mtsai::image::ColourSpace& colour )
+{
+	return cudaNV12ToRGBAf(srcDev, width * sizeof(uint8_t), destDev, width * sizeof(float4), width, height, colour);
+}
+
+// cudaNV12ToRGBA8
+cudaError_t cudaNV12ToRGBA8( uint8_t* srcDev, size_t srcPitch, uchar4* destDev, size_t destPitch, size_t width, size_t height, const mtsai::image::ColourSpace& colour )
+{
+	return launchNV12ToRGBA(srcDev, srcPitch, destDev, destPitch, width, height, colour);
+}
+
+cudaError_t cudaNV12ToRGBA8( uint8_t* srcDev, uchar4* destDev, size_t width, size_t height, const mtsai::image::ColourSpace& colour )
+{
+	return cudaNV12ToRGBA8(srcDev, width * sizeof(uint8_t), destDev, width * sizeof(uchar4), width, height, colour);
 }
 
 
 //-------------------------------------------------------------------------------------------------------------------------
 // RTP YUV color space conversion
 
+template<typename T>
 __global__ void YUVToRGBAf(uint32_t* srcImage,  size_t nSourcePitch,
-                           float4* dstImage,     size_t nDestPitch,
-                           uint32_t width,       uint32_t height)
+                           T* dstImage,          size_t nDestPitch,
+                           uint32_t width,       uint32_t height,
+                           YuvToRgbCoeffs k)
 {
     int x, y;
     uint32_t processingPitch = ((width) + 63) & ~63;
@@ -436,17 +418,19 @@ __global__ void YUVToRGBAf(uint32_t* srcImage,  size_t nSourcePitch,
     yuvi[5] = srcImageU8[y * processingPitch + x*2 + 2];//Cr
 
     // YUV to RGB Transformation conversion
-    YUV82RGB(&yuvi[0], &red[0], &green[0], &blue[0]);
-    YUV82RGB(&yuvi[3], &red[1], &green[1], &blue[1]);
+    YUV82RGB(k, &yuvi[0], &red[0], &green[0], &blue[0]);
+    YUV82RGB(k, &yuvi[3], &red[1], &green[1], &blue[1]);
 
-	dstImage[y * width + x]     = make_float4(red[0], green[0], blue[0], 1.0f);
-	dstImage[y * width + x + 1] = make_float4(red[1], green[1], blue[1], 1.0f);
+	dstImage[y * width + x]     = make_pixel<T>(red[0], green[0], blue[0], 1.0f);
+	dstImage[y * width + x + 1] = make_pixel<T>(red[1], green[1], blue[1], 1.0f);
 }
 
 
 
-// cudaNV12ToRGBA
-cudaError_t cudaYUVToRGBAf( uint8_t* srcDev, size_t srcPitch, float4* destDev, size_t destPitch, size_t width, size_t height )
+// launchYUVToRGBA
+template<typename T>
+static cudaError_t launchYUVToRGBA( uint8_t* srcDev, size_t srcPitch, T* destDev, size_t destPitch, size_t width, size_t height,
+                                   const mtsai::image::ColourSpace& colour )
 {
 	if( !srcDev || !destDev )
 		return cudaErrorInvalidDevicePointer;
@@ -461,14 +445,32 @@ cudaError_t cudaYUVToRGBAf( uint8_t* srcDev, size_t srcPitch, float4* destDev, s
 	//const dim3 gridDim((width+(2*blockDim.x-1))/(2*blockDim.x), (height+(blockDim.y-1))/blockDim.y, 1);
 	const dim3 gridDim(iDivUp(width,blockDim.x), iDivUp(height, blockDim.y), 1);
 
-	YUVToRGBAf<<<gridDim, blockDim>>>( (uint32_t*)srcDev, srcPitch, destDev, destPitch, width, height );
+	YUVToRGBAf<T><<<gridDim, blockDim>>>( (uint32_t*)srcDev, srcPitch, destDev, destPitch, width, height,
+	                                      mtsai::image::GetYuvToRgbCoeffs(colour) );
 	
 	return CUDA(cudaGetLastError());
 }
 
-cudaError_t cudaYUVToRGBAf( uint8_t* srcDev, float4* destDev, size_t width, size_t height )
+// cudaYUVToRGBAf
+cudaError_t cudaYUVToRGBAf( uint8_t* srcDev, size_t srcPitch, float4* destDev, size_t destPitch, size_t width, size_t height, const mtsai::image::ColourSpace& colour )
+{
+	return launchYUVToRGBA(srcDev, srcPitch, destDev, destPitch, width, height, colour);
+}
+
+cudaError_t cudaYUVToRGBAf( uint8_t* srcDev, float4* destDev, size_t width, size_t height, const mtsai::image::ColourSpace& colour )
+{
+	return cudaYUVToRGBAf(srcDev, width * sizeof(uint8_t), destDev, width * sizeof(float4), width, height, colour);
+}
+
+// cudaYUVToRGBA8
+cudaError_t cudaYUVToRGBA8( uint8_t* srcDev, size_t srcPitch, uchar4* destDev, size_t destPitch, size_t width, size_t height, const mtsai::image::ColourSpace& colour )
+{
+	return launchYUVToRGBA(srcDev, srcPitch, destDev, destPitch, width, height, colour);
+}
+
+cudaError_t cudaYUVToRGBA8( uint8_t* srcDev, uchar4* destDev, size_t width, size_t height, const mtsai::image::ColourSpace& colour )
 {
-	return cudaYUVToRGBAf(srcDev, width * sizeof(uint8_t), destDev, width * sizeof(float4), width, height);
+	return cudaYUVToRGBA8(srcDev, width * sizeof(uint8_t), destDev, width * sizeof(uchar4), width, height, colour);
 }
 
 
@@ -89,28 +89,12 @@ bool ConvertYUVtoRGBA( void* input, void** outputCPU, void** outputGPU, size_t w
 __constant__ uint32_t constAlpha;
 __constant__ float  constHueColorSpaceMat[9];
 
-#define LIMIT_RGB(x)    (((x)<0)?0:((x)>255)?255:(x))
+using mtsai::image::YuvToRgbCoeffs;
+using mtsai::image::RgbToYuvCoeffs;
 
-__device__ void YUV82RGB(uint8_t *yuvi, uint8_t *red, uint8_t *green, uint8_t *blue)
+__device__ void YUV82RGB(const YuvToRgbCoeffs& k, uint8_t *yuvi, uint8_t *red, uint8_t *green, uint8_t *blue)
 {
-	const float y0 = float(yuvi[0]);
-	const float cb0    = float(yuvi[1]);
-	const float cr0    = float(yuvi[2]);
-
-//printf("YUV luma=%f, u=%f, v=%f\n", y0, cb0, cr0);
-
-	unsigned char r0(LIMIT_RGB(round((298.082 * y0) / 256.0 + (408.583 * cr0) / 256.0 - 222.921)));
-
-
-	unsigned char g0(LIMIT_RGB(round((298.082 * y0) / 256.0 - (100.291 * cb0) / 256.0
-			- (208.120 * cr0) / 256.0 + 135.576)));
-
-
-	unsigned char b0(LIMIT_RGB(round((298.082 * y0) / 256.0 + (516.412 * cb0) / 256.0 - 276.836)));
-
-	*red    = (uint8_t)r0;
-	*green  = (uint8_t)g0;
-	*blue   = (uint8_t)b0;
+	mtsai::image::YuvToRgb(k, yuvi[0], yuvi[1], yuvi[2], red, green, blue);
 }
 
 //-------------------------------------------------------------------------------------------------------------------------
@@ -118,7 +102,8 @@ __device__ void YUV82RGB(uint8_t *yuvi, uint8_t *red, uint8_t *green, uint8_t *b
 
 __global__ void YUVToRGBA(uint8_t* srcImage,  size_t nSourcePitch,
                            uint8_t* dstImage,     size_t nDestPitch,
-                           uint32_t width,       uint32_t height)
+                           uint32_t width,       uint32_t height,
+                           YuvToRgbCoeffs k)
 {
     int x, y;
     uint32_t processingPitch = ((width) + 63) & ~63;
@@ -152,8 +137,8 @@ __global__ void YUVToRGBA(uint8_t* srcImage,  size_t nSourcePitch,
 	}
 
     // YUV to RGB Transformation conversion
-    YUV82RGB(&yuvi[0], &red[0], &green[0], &blue[0]);
-    YUV82RGB(&yuvi[3], &red[1], &green[1], &blue[1]);
+    YUV82RGB(k, &yuvi[0], &red[0], &green[0], &blue[0]);
+    YUV82RGB(k, &yuvi[3], &red[1], &green[1], &blue[1]);
 
 
 	dstImage[y * (width *4) + x*4]      = red[0];
@@ -167,7 +152,8 @@ __global__ void YUVToRGBA(uint8_t* srcImage,  size_t nSourcePitch,
 }
 
 // cudaYUVToRGBA
-cudaError_t cudaYUVToRGBA( uint8_t* srcDev, size_t srcPitch, uint8_t* destDev, size_t destPitch, size_t width, size_t height )
+cudaError_t cudaYUVToRGBA( uint8_t* srcDev, size_t srcPitch, uint8_t* destDev, size_t destPitch, size_t width, size_t height,
+                           const mtsai::image::ColourSpace& colour )
 {
 	if( !srcDev || !destDev )
 		return cudaErrorInvalidDevicePointer;
@@ -179,49 +165,36 @@ cudaError_t cudaYUVToRGBA( uint8_t* srcDev, size_t srcPitch, uint8_t* destDev, s
 
 	const dim3 gridDim(iDivUp(width,blockDim.x), iDivUp(height, blockDim.y), 1);
 
-	YUVToRGBA<<<gridDim, blockDim>>>( (uint8_t*)srcDev, srcPitch, destDev, destPitch, width, height );
+	YUVToRGBA<<<gridDim, blockDim>>>( (uint8_t*)srcDev, srcPitch, destDev, destPitch, width, height,
+	                                  mtsai::image::GetYuvToRgbCoeffs(colour) );
 
 	return CUDA(cudaGetLastError());
 }
 
-cudaError_t cudaYUVToRGBA( uint8_t* srcDev, uint8_t* destDev, size_t width, size_t height )
+cudaError_t cudaYUVToRGBA( uint8_t* srcDev, uint8_t* destDev, size_t width, size_t height, const mtsai::image::ColourSpace& colour )
 {
-	cudaYUVToRGBA(srcDev, width * sizeof(uint8_t), destDev, width * sizeof(uint8_t) * 4, width, height);
+	cudaYUVToRGBA(srcDev, width * sizeof(uint8_t), destDev, width * sizeof(uint8_t) * 4, width, height, colour);
 	return cudaSuccess;
 }
 
 //-------------------------------------------------------------------------------------------------------------------------
 // RTP YUV color space conversion
 
-__device__ void RGBToYUV(bool even, uint8_t *rgb, uint8_t *Y, uint8_t *U, uint8_t *V)
+// BGR(X) pixel pair to Cr Y0 Cb Y1, the chroma is taken from the average of both
+__device__ void RGBToYUV(const RgbToYuvCoeffs& k, const uint8_t *p0, const uint8_t *p1, uint8_t *dst)
 {
-	int R,G,B;
-
-	// Set inital values to zero
-    *Y=0;
-    *U=0;
-    *V=0;
-
-    // Get the RGB Values
-	B=rgb[0];
-	G=rgb[1];
-	R=rgb[2];
-	/* sample luma for every pixel */
-	*Y  = LIMIT_RGB((0.257 * R) + (0.504 * G) + (0.098 * B) + 16);
+	uint8_t unused;
 
-	if (even == true)
-	{
-		*V =  LIMIT_RGB((0.439 * R) - (0.368 * G) - (0.071 * B) + 128);
-	}
-	else
-	{
-		*U = LIMIT_RGB(-(0.148 * R) - (0.291 * G) + (0.439 * B) + 128);
-	}
+	mtsai::image::RgbToYuv(k, p0[2], p0[1], p0[0], &dst[1], &unused, &unused);
+	mtsai::image::RgbToYuv(k, p1[2], p1[1], p1[0], &dst[3], &unused, &unused);
+	mtsai::image::RgbToYuv(k, (p0[2] + p1[2] + 1) >> 1, (p0[1] + p1[1] + 1) >> 1, (p0[0] + p1[0] + 1) >> 1,
+	                       &unused, &dst[2], &dst[0]);
 }
 
 __global__ void RGBAToYUV(uint8_t* srcImage,  size_t nSourcePitch,
                            uint8_t* dstImage,     size_t nDestPitch,
-                           uint32_t width,       uint32_t height)
+                           uint32_t width,       uint32_t height,
+                           RgbToYuvCoeffs k)
 {
     int x, y;
     uint32_t processingPitch = ((width) + 63) & ~63;
@@ -246,26 +219,15 @@ __global__ void RGBAToYUV(uint8_t* srcImage,  size_t nSourcePitch,
 
     // Pitch is four as data is RGBX
     rgb = &srcImageU8[y * (width * 4) + x*4];
-    uint8_t Y[2], u[2], v[2];
 
-    // Process u and v for odd/even pixels
-    RGBToYUV(true, &rgb[0], &Y[0], &u[0], &v[0]);
-    RGBToYUV(false, &rgb[4], &Y[1], &u[1], &v[1]);
-
-    // Check these values have not been set
-    if (u[0] != 0) return;
-    if (v[1] != 0) return;
-
-    // Pack the converted data into the destination buffer
-	dstImage[y * processingPitch + x*2 ]     = v[0];
-	dstImage[y * processingPitch + x*2 + 1]  = Y[0];
-	dstImage[y * processingPitch + x*2 + 2]  = u[1];
-	dstImage[y * processingPitch + x*2 + 3]  = Y[1];
+    // Convert the pair and pack it into the destination buffer
+    RGBToYUV(k, &rgb[0], &rgb[4], &dstImage[y * processingPitch + x*2]);
 
 }
 
 // cudaRGBAToYUV
-cudaError_t cudaRGBAToYUV( uint8_t* srcDev, size_t srcPitch, uint8_t* destDev, size_t destPitch, size_t width, size_t height )
+cudaError_t cudaRGBAToYUV( uint8_t* srcDev, size_t srcPitch, uint8_t* destDev, size_t destPitch, size_t width, size_t height,
+                           const mtsai::image::ColourSpace& colour )
 {
 	if( !srcDev || !destDev )
 		return cudaErrorInvalidDevicePointer;
@@ -276,21 +238,23 @@ cudaError_t cudaRGBAToYUV( uint8_t* srcDev, size_t srcPitch, uint8_t* destDev, s
 	const dim3 blockDim(8,8,1);
 	const dim3 gridDim(iDivUp(width,blockDim.x), iDivUp(height, blockDim.y), 1);
 //printf("########### srcDev 0x%x, srcPitch %d, destDev 0x%x, destPitch %d, width %d, height %d\n", srcDev, srcPitch, destDev, destPitch, width, height);
-	RGBAToYUV<<<gridDim, blockDim>>>( (uint8_t*)srcDev, srcPitch, destDev, destPitch, width, height );
+	RGBAToYUV<<<gridDim, blockDim>>>( (uint8_t*)srcDev, srcPitch, destDev, destPitch, width, height,
+	                               mtsai::image::GetRgbToYuvCoeffs(colour) );
 
 	return CUDA(cudaGetLastError());
 }
 
 
-cudaError_t cudaRGBAToYUV( uint8_t* srcDev, uint8_t* destDev, size_t width, size_t height )
+cudaError_t cudaRGBAToYUV( uint8_t* srcDev, uint8_t* destDev, size_t width, size_t height, const mtsai::image::ColourSpace& colour )
 {
-	cudaRGBAToYUV(srcDev, width * sizeof(uint8_t) * 4, destDev, width * sizeof(uint8_t) * 2, width, height);
+	cudaRGBAToYUV(srcDev, width * sizeof(uint8_t) * 4, destDev, width * sizeof(uint8_t) * 2, width, height, colour);
 	return cudaSuccess;
 }
 
 __global__ void RGBToYUV(uint8_t* srcImage,  size_t nSourcePitch,
                            uint8_t* dstImage,     size_t nDestPitch,
-                           uint32_t width,       uint32_t height)
+                           uint32_t width,       uint32_t height,
+                           RgbToYuvCoeffs k)
 {
     int x, y;
     uint32_t processingPitch = ((width) + 63) & ~63;
@@ -313,25 +277,14 @@ __global__ void RGBToYUV(uint8_t* srcImage,  size_t nSourcePitch,
     // this steps performs the color conversion
     uint8_t *rgb;
     rgb = &srcImageU8[(y * (width * 3) + x*3)];
-    uint8_t Y[2], u[2], v[2];
-
-    // Process u and v for odd/even pixels
-    RGBToYUV(true, &rgb[0], &Y[0], &u[0], &v[0]);
-    RGBToYUV(false, &rgb[3], &Y[1], &u[1], &v[1]);
-
-    // Check these values have not been set
-    if (u[0] != 0) return;
-    if (v[1] != 0) return;
 
-    // Pack the converted data into the destination buffer
-	dstImage[y * processingPitch + x*2 ]     = v[0];
-	dstImage[y * processingPitch + x*2 + 1]  = Y[0];
-	dstImage[y * processingPitch + x*2 + 2]  = u[1];
-	dstImage[y * processingPitch + x*2 + 3]  = Y[1];
+    // Convert the pair and pack it into the destination buffer
+    RGBToYUV(k, &rgb[0], &rgb[3], &dstImage[y * processingPitch + x*2]);
 }
 
 // cudaRGBToYUV
-cudaError_t cudaRGBToYUV( uint8_t* srcDev, size_t srcPitch, uint8_t* destDev, size_t destPitch, size_t width, size_t height )
+cudaError_t cudaRGBToYUV( uint8_t* srcDev, size_t srcPitch, uint8_t* destDev, size_t destPitch, size_t width, size_t height,
+                          const mtsai::image::ColourSpace& colour )
 {
 	if( !srcDev || !destDev )
 		return cudaErrorInvalidDevicePointer;
@@ -342,14 +295,15 @@ cudaError_t cudaRGBToYUV( uint8_t* srcDev, size_t srcPitch, uint8_t* destDev, si
 	const dim3 blockDim(8,8,1);
 	const dim3 gridDim(iDivUp(width,blockDim.x), iDivUp(height, blockDim.y), 1);
 
-	RGBToYUV<<<gridDim, blockDim>>>( (uint8_t*)srcDev, srcPitch, destDev, destPitch, width, height );
+	RGBToYUV<<<gridDim, blockDim>>>( (uint8_t*)srcDev, srcPitch, destDev, destPitch, width, height,
+	                              mtsai::image::GetRgbToYuvCoeffs(colour) );
 
 	return CUDA(cudaGetLastError());
 }
 
-cudaError_t cudaRGBToYUV( uint8_t* srcDev, uint8_t* destDev, size_t width, size_t height )
+cudaError_t cudaRGBToYUV( uint8_t* srcDev, uint8_t* destDev, size_t width, size_t height, const mtsai::image::ColourSpace& colour )
 {
-	cudaRGBToYUV(srcDev, width * sizeof(uint8_t) * 3, destDev, width * sizeof(uint8_t) * 2, width, height);
+	cudaRGBToYUV(srcDev, width * sizeof(uint8_t) * 3, destDev, width * sizeof(uint8_t) * 2, width, height, colour);
 	return cudaSuccess;
 }
 
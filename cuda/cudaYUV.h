@@ -9,33 +9,40 @@
 #include <NVX/nvx.h>
 #include <VX/vx_types.h>
 #include "cudaUtility.h"
+#include "image/colour.h"
 
 //////////////////////////////////////////////////////////////////////////////////
 /// @name YUV to RGBf
 //////////////////////////////////////////////////////////////////////////////////
 bool ConvertYUVtoRGBA( void* input, void** outputCPU, void** outputGPU, size_t width, size_t height );
 
-cudaError_t cudaYUVToRGBA( uint8_t* input, size_t inputPitch, uint8_t* output, size_t outputPitch, size_t width, size_t height );
-cudaError_t cudaYUVToRGBA( uint8_t* input, uint8_t* output, size_t width, size_t height );
+cudaError_t cudaYUVToRGBA( uint8_t* input, size_t inputPitch, uint8_t* output, size_t outputPitch, size_t width, size_t height, const mtsai::image::ColourSpace& colour=mtsai::image::ColourSpace() );
+cudaError_t cudaYUVToRGBA( uint8_t* input, uint8_t* output, size_t width, size_t height, const mtsai::image::ColourSpace& colour=mtsai::image::ColourSpace() );
 
 bool ConvertRGBtoYUV( void* input, bool gpuAddr, void** output, size_t width, size_t height );
 
-cudaError_t cudaRGBAToYUV( uint8_t* input, size_t inputPitch, uint8_t* output, size_t outputPitch, size_t width, size_t height );
-cudaError_t cudaRGBAToYUV( uint8_t* input, uint8_t* output, size_t width, size_t height );
+cudaError_t cudaRGBAToYUV( uint8_t* input, size_t inputPitch, uint8_t* output, size_t outputPitch, size_t width, size_t height, const mtsai::image::ColourSpace& colour=mtsai::image::ColourSpace() );
+cudaError_t cudaRGBAToYUV( uint8_t* input, uint8_t* output, size_t width, size_t height, const mtsai::image::ColourSpace& colour=mtsai::image::ColourSpace() );
 
-cudaError_t cudaRGBToYUV( uint8_t* input, size_t inputPitch, uint8_t* output, size_t outputPitch, size_t width, size_t height );
-cudaError_t cudaRGBToYUV( uint8_t* input, uint8_t* output, size_t width, size_t height );
+cudaError_t cudaRGBToYUV( uint8_t* input, size_t inputPitch, uint8_t* output, size_t outputPitch, size_t width, size_t height, const mtsai::image::ColourSpace& colour=mtsai::image::ColourSpace() );
+cudaError_t cudaRGBToYUV( uint8_t* input, uint8_t* output, size_t width, size_t height, const mtsai::image::ColourSpace& colour=mtsai::image::ColourSpace() );
 
+// image::MotionFieldRenderer draws the same arrows on the CPU
 cudaError_t cudaMotionFields( uint8_t* image, vx_float32* motionfeilds, size_t width, size_t height);
 
-cudaError_t cudaNV12ToRGBAf( uint8_t* srcDev, size_t srcPitch, float4* destDev, size_t destPitch, size_t width, size_t height );
-cudaError_t cudaNV12ToRGBAf( uint8_t* srcDev, float4* destDev, size_t width, size_t height );
+cudaError_t cudaNV12ToRGBAf( uint8_t* srcDev, size_t srcPitch, float4* destDev, size_t destPitch, size_t width, size_t height, const mtsai::image::ColourSpace& colour=mtsai::image::ColourSpace() );
+cudaError_t cudaNV12ToRGBAf( uint8_t* srcDev, float4* destDev, size_t width, size_t height, const mtsai::image::ColourSpace& colour=mtsai::image::ColourSpace() );
 
-cudaError_t cudaNV12ToRGBAf( uint8_t* srcDev, size_t srcPitch, float4* destDev, size_t destPitch, size_t width, size_t height );
-cudaError_t cudaNV12ToRGBAf( uint8_t* srcDev, float4* destDev, size_t width, size_t height );
+cudaError_t cudaYUVToRGBAf( uint8_t* srcDev, size_t srcPitch, float4* destDev, size_t destPitch, size_t width, size_t height, const mtsai::image::ColourSpace& colour=mtsai::image::ColourSpace() );
+cudaError_t cudaYUVToRGBAf( uint8_t* srcDev, float4* destDev, size_t width, size_t height, const mtsai::image::ColourSpace& colour=mtsai::image::ColourSpace() );
 
-cudaError_t cudaYUVToRGBAf( uint8_t* srcDev, size_t srcPitch, float4* destDev, size_t destPitch, size_t width, size_t height );
-cudaError_t cudaYUVToRGBAf( uint8_t* srcDev, float4* destDev, size_t width, size_t height );
+// 8 bit RGBA (rounded, saturated, alpha 255), the working format
+// YUV input is decoded with the colour matrix and range of colour (BT.601 limited by default)
+cudaError_t cudaNV12ToRGBA8( uint8_t* srcDev, size_t srcPitch, uchar4* destDev, size_t destPitch, size_t width, size_t height, const mtsai::image::ColourSpace& colour=mtsai::image::ColourSpace() );
+cudaError_t cudaNV12ToRGBA8( uint8_t* srcDev, uchar4* destDev, size_t width, size_t height, const mtsai::image::ColourSpace& colour=mtsai::image::ColourSpace() );
+
+cudaError_t cudaYUVToRGBA8( uint8_t* srcDev, size_t srcPitch, uchar4* destDev, size_t destPitch, size_t width, size_t height, const mtsai::image::ColourSpace& colour=mtsai::image::ColourSpace() );
+cudaError_t cudaYUVToRGBA8( uint8_t* srcDev, uchar4* destDev, size_t width, size_t height, const mtsai::image::ColourSpace& colour=mtsai::image::ColourSpace() );
 
 ///@}
 
@@ -23,9 +23,11 @@
 #include <stdio.h>
 #include <signal.h>
 #include <unistd.h>
+#include <vector>
 
 #include "cudaMappedMemory.h"
-#include "cudaNormalize.h"
+#include "image/overlay.h"
+#include "image/motion_gate.h"
 
 #include "detectNet.h"
 
@@ -41,35 +43,39 @@ void sig_handler(int signo)
 	}
 }
 
-void convertColour(camera *camera, void* imgCUDA, void** imgRGBA)
+// luma layout of the captured frame for the motion gate, RGB and Bayer sources are not gated
+static bool gateLayout(const mtsai::image::FrameDescriptor& frame, mtsai::image::LumaLayout* layout)
 {
-#if VIDEO_SRC==VIDEO_GST_RTP_SRC
-	if ( !camera->ConvertYUVtoRGBA(imgCUDA, imgRGBA) )
-		printf("imagenet-camera:  failed to convert from YUV to RGBAf\n");
-#endif
-
-#if VIDEO_SRC==VIDEO_RTP_STREAM_SOURCE
-	if ( !camera->ConvertYUVtoRGBf(imgCUDA, imgRGBA ) )
-		printf("imagenet-camera:  failed to convert from YUV to RGBAf\n");
-#endif
+	switch( frame.fourcc )
+	{
+	case mtsai::image::FOURCC_NV12:
+	case mtsai::image::FOURCC_GREY:
+		*layout = mtsai::image::LUMA_PLANAR;
+		return true;
+	case mtsai::image::FOURCC_UYVY:
+		*layout = mtsai::image::LUMA_UYVY;
+		return true;
+	case mtsai::image::FOURCC_YUYV:
+		*layout = mtsai::image::LUMA_YUYV;
+		return true;
+	default:
+		return false;
+	}
+}
 
-#if VIDEO_SRC==VIDEO_GST_V4L_SRC
-	if ( !camera->ConvertRGBtoRGBA(imgCUDA, imgRGBA) )
-		printf("imagenet-camera:  failed to convert from RGB to RGBAf\n");
-#endif 
-
-#if  VIDEO_GV_STREAM_SOURCE
-#if VIDEO_GV_PIXEL_FORMAT == VIDEO_GV_RGB8
-	if ( !camera->ConvertRGBtoRGBA(imgCUDA, imgRGBA) )
-		printf("imagenet-camera:  failed to convert from RGB to RGBAf\n");
-#elif VIDEO_GV_PIXEL_FORMAT == VIDEO_GV_YUV422
-	if ( !camera->ConvertYUVtoRGBf(imgCUDA, imgRGBA) )
-		printf("imagenet-camera:  failed to convert from YUV to RGBAf\n");
-#elif VIDEO_GV_PIXEL_FORMAT == VIDEO_GV_BAYER_GR8
-	if ( !camera->ConvertBAYER_GR8toRGBA(imgCUDA, imgRGBA) )
-		printf("imagenet-camera:  failed to convert from BAYER_GR8 to RGBAf\n");
-#endif
-#endif
+// box colour of a detection class, classes beyond the palette wrap around
+static mtsai::image::PixelRGBA8 classColor( int classIndex )
+{
+	static const mtsai::image::PixelRGBA8 palette[] = {
+		{   0, 255, 175, 255 },
+		{   0, 200, 255, 255 },
+		{ 255, 120,   0, 255 },
+		{ 255,   0, 200, 255 },
+		{ 255, 230,   0, 255 },
+		{ 120,  80, 255, 255 }
+	};
+	const int count = sizeof(palette) / sizeof(palette[0]);
+	return palette[(classIndex < 0 ? 0 : classIndex) % count];
 }
 
 int main( int argc, char** argv )
@@ -180,7 +186,7 @@ int main( int argc, char** argv )
 	}
 	else
 	{
-		texture = glTexture::Create(camera->GetWidth(), camera->GetHeight(), GL_RGBA32F_ARB/*GL_RGBA8*/);
+		texture = glTexture::Create(camera->GetWidth(), camera->GetHeight(), GL_RGBA8);
 
 		if( !texture )
 			printf("detectnet-camera:  failed to create openGL texture\n");
@@ -209,50 +215,82 @@ int main( int argc, char** argv )
 	 * processing loop
 	 */
 	float confidence = 0.0f;
+	mtsai::image::RectOverlay overlay;
+	mtsai::image::MotionGate gate;
+	std::vector<mtsai::image::OverlayBox> boxes;
 	
 	while( !display->Quit() && !signal_recieved )
 	{
-		void* imgCPU  = NULL;
-		void* imgCUDA = NULL;
+		mtsai::image::FrameDescriptor capture;
 		void* imgRGBA = NULL;
 		
 		// get the latest frame
-		if( !camera->Capture(&imgCPU, &imgCUDA, 1000) )
+		if( !camera->CaptureFrame(&capture, 1000) )
+		{
 			printf("\ndetectnet-camera:  failed to capture frame\n");
+			continue;
+		}
 		
 		/*
-		 *  Convert capture colorspace to the required RGBA
+		 *  Convert capture colorspace to the required RGBA, the descriptor
+		 *  carries the source format and row pitch. Without it there is
+		 *  nothing to draw the kept boxes on or to show.
 		 */
-		convertColour(camera, imgCUDA, &imgRGBA);
+		if( !camera->ConvertFrame(capture, &imgRGBA) )
+		{
+			printf("detectnet-camera:  failed to convert the captured frame to RGBA\n");
+			continue;
+		}
+
+		// static scene, keep the last detections and skip the network
+		bool detect = true;
+		mtsai::image::LumaLayout layout;
+
+		if( capture.cpu != NULL && gateLayout(capture, &layout) )
+		{
+			mtsai::image::ImageView luma;
+			luma.data   = (void*)mtsai::image::FramePlaneData(capture, capture.cpu, 0);
+			luma.width  = capture.width;
+			luma.height = capture.height;
+			luma.pitch  = capture.planes[0].stride;
+
+			detect = (gate.Update(luma, layout) == mtsai::image::GATE_PROCESS);
+		}
+
+		// the network takes float4, widen the uchar4 frame only for it
+		void* imgRGBAf = NULL;
+
+		if( detect && !camera->ConvertRGBAtoRGBAf(imgRGBA, &imgRGBAf) )
+			printf("detectnet-camera:  failed to convert RGBA8 to float RGBA\n");
+
+		mtsai::image::ImageView frame;
+		frame.data   = imgRGBA;
+		frame.width  = camera->GetWidth();
+		frame.height = camera->GetHeight();
 
 		// classify image with detectNet
 		int numBoundingBoxes = maxBoxes;
 	
-		if( net->Detect((float*)imgRGBA, camera->GetWidth(), camera->GetHeight(), bbCPU, &numBoundingBoxes, confCPU))
+		if( imgRGBAf != NULL && net->Detect((float*)imgRGBAf, camera->GetWidth(), camera->GetHeight(), bbCPU, &numBoundingBoxes, confCPU))
 		{
 			printf("%i bounding boxes detected\n", numBoundingBoxes);
 		
-			int lastClass = 0;
-			int lastStart = 0;
-			
+			boxes.resize(numBoundingBoxes);
+
 			for( int n=0; n < numBoundingBoxes; n++ )
 			{
-				const int nc = confCPU[n*2+1];
 				float* bb = bbCPU + (n * 4);
 				
 				printf("bounding box %i   (%f, %f)  (%f, %f)  w=%f  h=%f\n", n, bb[0], bb[1], bb[2], bb[3], bb[2] - bb[0], bb[3] - bb[1]); 
-				
-				if( nc != lastClass || n == (numBoundingBoxes - 1) )
-				{
-					if( !net->DrawBoxes((float*)imgRGBA, (float*)imgRGBA, camera->GetWidth(), camera->GetHeight(), 
-						                        bbCUDA + (lastStart * 4), (n - lastStart) + 1, lastClass) )
-						printf("detectnet-console:  failed to draw boxes\n");
-						
-					lastClass = nc;
-					lastStart = n;
-				}
+
+				boxes[n].left   = bb[0];
+				boxes[n].top    = bb[1];
+				boxes[n].right  = bb[2];
+				boxes[n].bottom = bb[3];
+				boxes[n].color  = classColor((int)confCPU[n*2+1]);
+				boxes[n].thickness = 3;
 			}
-			
+
 			if( display != NULL )
 			{
 				char str[256];
@@ -261,6 +299,14 @@ int main( int argc, char** argv )
 				display->SetTitle(str);	
 			}	
 		}	
+		else if( detect )
+		{
+			boxes.clear();
+		}
+
+		// all boxes in one tile binned pass, skipped frames show the last detections
+		if( !boxes.empty() && !overlay.DrawCUDA(frame, camera->GetPixelType(), boxes.data(), boxes.size()) )
+			printf("detectnet-console:  failed to draw boxes\n");
 
 
 		// update display
@@ -276,11 +322,7 @@ int main( int argc, char** argv )
 
 			if( texture != NULL )
 			{
-				// rescale image pixel intensities for display
-				CUDA(cudaNormalizeRGBA((float4*)imgRGBA, make_float2(0.0f, 255.0f), 
-								   (float4*)imgRGBA, make_float2(0.0f, 1.0f), 
-		 						   camera->GetWidth(), camera->GetHeight()));
-
+				// uchar4 goes to the GL_RGBA8 texture as is, no rescale needed
 				// map from CUDA to openGL using GL interop
 				void* tex_map = texture->MapCUDA();
 
@@ -6,6 +6,8 @@
 #define __CUDA_MAPPED_MEMORY_H_
 
 
+#ifdef HAVE_CUDA
+
 #include "cudaUtility.h"
 
 
@@ -30,5 +32,49 @@ inline bool cudaAllocMapped( void** cpuPtr, void** gpuPtr, size_t size )
 	return true;
 }
 
+/**
+ * Release memory from cudaAllocMapped(), null is ignored.
+ */
+inline void cudaFreeMapped( void* cpuPtr )
+{
+	if( cpuPtr != NULL )
+		CUDA(cudaFreeHost(cpuPtr));
+}
+
+#else
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef LOG_CUDA
+#define LOG_CUDA "[cuda]   "
+#endif
+
+/**
+ * CPU-only build: plain aligned host memory, there is no device pointer.
+ */
+inline bool cudaAllocMapped( void** cpuPtr, void** gpuPtr, size_t size )
+{
+	if( !cpuPtr || !gpuPtr || size == 0 )
+		return false;
+
+	if( posix_memalign(cpuPtr, 64, size) != 0 )
+		return false;
+
+	*gpuPtr = NULL;
+
+	memset(*cpuPtr, 0, size);
+	printf("[cpu]   cudaAllocMapped %zu bytes, CPU %p (no CUDA)\n", size, *cpuPtr);
+	return true;
+}
+
+inline void cudaFreeMapped( void* cpuPtr )
+{
+	free(cpuPtr);
+}
+
+#endif
+
 
 #endif
@@ -2,33 +2,94 @@
 #ifndef _GST_CAMERA_
 #define _GST_CAMERA_
 
+#include <atomic>
+#include <climits>
 #include <mutex>
 #include <condition_variable>
+#include <memory>
+#include <vector>
 
 #include <gst/gst.h>
 #include <gst/app/gstappsink.h>
 
 #include "gst_camera_param.h"
 #include "mt_utils.h"
+#include "image/frame.h"
+#include "image/frame_pool.h"
+#include "gst_state.h"
+#include "gst_frame_pool.h"
+#include "gst_caps.h"
+#include "gst_record.h"
+#include "gst_clip.h"
 
 static const int GST_CAMERA_RING_BUFFER_SIZE = 16;
+// buffers of the proposed upstream pool beyond the ring (decoder references, queues)
+static const int GST_CAMERA_POOL_EXTRA = 8;
+// default wait for a pipeline state change, milliseconds
+static const unsigned long GST_CAMERA_STATE_TIMEOUT = 5000;
 
 class GstCamera
 {
 public:
     GstCamera();
     GstCamera(GstCameraParam params);
+    // stops the pipeline, then frees the ring
     ~GstCamera();
 
     bool Init(GstCameraParam params);
-    bool Open();
-    void Capture();
+
+    // Go to PLAYING and wait for ASYNC_DONE or ERROR, timeout in milliseconds.
+    // On failure or timeout the pipeline is set back to NULL.
+    mtsai::gst::StateChange Open(unsigned long timeout=GST_CAMERA_STATE_TIMEOUT);
+    mtsai::gst::StateChange Open(mtsai::gst::Deadline deadline);
+    // Go to NULL. Allocated ring memory stays for the next Open(), gstreamer
+    // owned slots are given back to the pipeline
+    mtsai::gst::StateChange Close(unsigned long timeout=GST_CAMERA_STATE_TIMEOUT);
+
+    // NULL -> READY only: opens the device / sockets without starting data flow
+    mtsai::gst::StateChange Prepare(mtsai::gst::Deadline deadline);
+
+    // Open every camera in parallel against one deadline, all to READY first
+    // and then to PLAYING, results in camera order
+    static std::vector<mtsai::gst::StateChange> OpenAll(const std::vector<GstCamera*>& cameras,
+                                                        unsigned long timeout=GST_CAMERA_STATE_TIMEOUT);
+
+    // Wait for the latest frame in the ring buffer, timeout in milliseconds
+    bool Capture(void** cpu, void** cuda, unsigned long timeout=ULONG_MAX);
+    // Same, with the plane layout and timing of the frame, frame->cpu / cuda set
+    bool Capture(mtsai::image::FrameDescriptor* frame, unsigned long timeout=ULONG_MAX);
+
+    // recording cameras only: feed the decoder or not, it restarts at the
+    // next keyframe. Without recording the camera always decodes.
+    void SetDecoding(bool decoding);
+    // segments recorded so far, empty without recording
+    std::vector<mtsai::gst::RecordSegment> Segments();
+
+    // clip_.preSeconds_ before now to clip_.postSeconds_ after into location,
+    // encoded as received; a trigger while a clip is open extends it.
+    // False without the pre-event ring or before its first keyframe.
+    bool TriggerClip(const std::string& location);
+    // clips triggered so far, oldest first
+    std::vector<mtsai::gst::ClipInfo> Clips();
+
+    inline int GetWidth() const      { return width_; }
+    inline int GetHeight() const     { return height_; }
+    inline int GetPixelDepth() const { return depth_; }
+    inline int GetSize() const       { return frameSize_; }
 
 private:
     bool initGstCheck();
     std::string searchAppsinkName(std::string launchStr);
     void checkBusMsg();
+    static void printBusMsg(GstMessage* msg, void* user_data);
     void checkFrameBuffer();
+    // slots of at least size bytes (ringMutex_ not held)
+    bool reserveRing(size_t size);
+    // gives the samples held by the ring back to the pipeline (renegotiation),
+    // the one Capture() handed out last stays until the next Capture()
+    static void returnHeldSamples(void* user_data);
+    // all of them, the consumer is done (ringMutex_ held)
+    void releaseHeld();
 
     // Callback function
     static void onEOS(GstAppSink* sink, void* user_data);
@@ -45,8 +106,15 @@ private:
     int depth_;
     int frameSize_;
     
-    void* ringBufferCPU_[GST_CAMERA_RING_BUFFER_SIZE];
-    void* ringBufferGPU_[GST_CAMERA_RING_BUFFER_SIZE];
+    std::unique_ptr<mtsai::image::FramePool> ringPool_;    // copies, null for FRAME_MEMORY_EXTERNAL
+    std::unique_ptr<mtsai::image::FramePool> heldPool_;    // samples kept without a copy
+    GstBufferPool* upstreamPool_;
+    std::unique_ptr<mtsai::gst::Recorder> recorder_;
+    std::unique_ptr<mtsai::gst::ClipRing> clipRing_;
+    mtsai::image::FrameDescriptor ringFrames_[GST_CAMERA_RING_BUFFER_SIZE];
+    mtsai::gst::CapsLayout capsLayout_;
+    uint32_t sourceId_;
+    uint64_t sequence_;
 
     std::condition_variable waitEvent_;
     std::mutex waitMutex_;
@@ -54,6 +122,12 @@ private:
 
     u_int32_t latestRingBuffer_;
     bool latestRetrived_;
+    // slot of the last Capture(), its held sample outlives a renegotiation
+    int32_t handedOut_;
+    bool handedStale_;
+
+    // set while Open()/Close() read the bus, the streaming thread leaves it alone
+    std::atomic<bool> stateWait_;
 
     // test count
     unsigned long frame_count;
@@ -2,12 +2,40 @@
 #ifndef _GST_CAMER_PARAM_
 #define _GST_CAMER_PARAM_
 
+#include <map>
 #include <string>
 
+#include "image/frame_pool.h"
+#include "gst_record_param.h"
+#include "gst_clip_param.h"
+
 struct GstCameraParam
 {
+    // launch description, may hold "${name}" placeholders
     std::string launchStr_;
-    
+
+    // values of the placeholders, cameras that only differ here share
+    // one cached pipeline template
+    std::map<std::string, std::string> values_;
+
+    // memory behind the capture ring: mapped (CUDA when built with it), huge
+    // page CPU memory, or the GStreamer buffers themselves (no copy, the ring
+    // then holds up to GST_CAMERA_RING_BUFFER_SIZE samples of the pipeline)
+    mtsai::image::FrameMemory memory_ = mtsai::image::FRAME_MEMORY_MAPPED;
+
+    // offer a pool of memory_ slots to the element before the appsink, so
+    // it decodes / converts straight into the memory Capture() hands out
+    bool proposePool_ = true;
+
+    // encoded passthrough recording after the launch's h264parse / h265parse
+    GstRecordParam record_;
+
+    // decode for Capture() from the start; a recording camera can start
+    // without and turn it on with SetDecoding() once a consumer attaches
+    bool decode_ = true;
+
+    // pre-event ring of the parsed access units for TriggerClip()
+    GstClipParam clip_;
 };
 
 
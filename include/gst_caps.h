@@ -0,0 +1,70 @@
+#ifndef _GST_CAPS_
+#define _GST_CAPS_
+
+#include <stdint.h>
+
+#include <gst/gst.h>
+
+#include "image/frame.h"
+
+namespace mtsai
+{
+namespace gst
+{
+
+    enum CapsUpdate
+    {
+        CAPS_SAME = 0,      // same caps as last time, cached layout is valid
+        CAPS_CHANGED,       // new layout parsed (first caps or renegotiation)
+        CAPS_INVALID        // no usable width / height, layout cleared
+    };
+
+    /*
+     * Frame layout of the negotiated caps, parsed once per negotiation
+     *
+     * Samples from one negotiation share a GstCaps object, so the per frame
+     * check is a pointer compare; caps that are a new object but equal to
+     * the cached ones (a reconfigure with the same result) are not parsed
+     * again either. A reference to the caps is held so a freed pointer can
+     * not come back as "the same caps".
+     */
+    class CapsLayout
+    {
+    public:
+        CapsLayout();
+        ~CapsLayout();
+
+        CapsUpdate Update(GstCaps* caps);
+        void Reset();
+
+        inline bool Valid() const { return valid_; }
+
+        // fourcc, size, planes, stride and colour; timing fields and pointers unset.
+        // fourcc is 0 and planes empty for formats without a fourcc
+        inline const mtsai::image::FrameDescriptor& Layout() const { return layout_; }
+
+        // times the caps were actually parsed
+        inline uint64_t Parses() const { return parses_; }
+
+    private:
+        CapsLayout(const CapsLayout&) = delete;
+        CapsLayout& operator=(const CapsLayout&) = delete;
+
+        bool parse(GstCaps* caps);
+
+        GstCaps* caps_;
+        bool valid_;
+        mtsai::image::FrameDescriptor layout_;
+        uint64_t parses_;
+    };
+
+    /*
+     * Per buffer plane offsets / strides from GstVideoMeta (upstream padded
+     * rows), applied over the caps layout. False when the buffer has none.
+     */
+    bool ApplyVideoMeta(GstBuffer* buffer, mtsai::image::FrameDescriptor* frame);
+
+} // gst
+} // mtsai
+
+#endif // _GST_CAPS_
@@ -0,0 +1,149 @@
+#ifndef _GST_CLIP_
+#define _GST_CLIP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gst/gst.h>
+#include <gst/app/gstappsrc.h>
+
+#include "gst_clip_param.h"
+
+namespace mtsai
+{
+namespace gst
+{
+
+    enum ClipState
+    {
+        CLIP_WRITING = 0,   // pre-roll written, live units still going in
+        CLIP_DONE,          // file finished
+        CLIP_FAILED         // writer pipeline error, nothing useful on disk
+    };
+
+    struct ClipInfo
+    {
+        std::string location;
+        ClipState state;
+        uint64_t duration;      // ns of stream written so far
+        uint64_t preroll;       // ns of it from before the first trigger
+        uint32_t units;         // access units written
+        uint64_t bytes;
+    };
+
+    struct ClipRingStats
+    {
+        size_t bytes;           // encoded bytes held
+        size_t units;
+        size_t keyframes;
+        uint64_t span;          // ns from the oldest to the newest unit
+        uint64_t evicted;       // units dropped from the front so far
+    };
+
+    /*
+     * Pre-event ring of encoded access units, for "the 10 seconds before
+     * the alarm" clips
+     *
+     * Attach() puts a probe on the parser of a camera pipeline (after the
+     * depayloader), the ring keeps refs to the parsed buffers, no copy and
+     * no decode. It always starts at a keyframe and drops whole GOPs from
+     * the front once it spans more than preSeconds_ or holds more than
+     * budgetBytes_, so a camera costs a few MB instead of hundreds of
+     * decoded frames.
+     *
+     * Trigger() writes the ring from the newest keyframe at least
+     * preSeconds_ old into a file (parser ! muxer ! filesink, timestamps
+     * rebased to 0), then keeps appending live units until postSeconds_
+     * after the trigger; a trigger while a clip is open extends it. The
+     * files are muxed on a thread per clip, the streaming thread only
+     * hands over buffers.
+     */
+    class ClipRing
+    {
+    public:
+        ClipRing();
+        // ends the open clips and waits for their files
+        ~ClipRing();
+
+        // pipeline with an h264parse / h265parse
+        bool Attach(GstElement* pipeline, const GstClipParam& params);
+
+        // false when the ring has no keyframe yet
+        bool Trigger(const std::string& location);
+
+        // ends the open clips now (pipeline stopping), their files are finished
+        void Finish();
+
+        // until no clip is being written, timeout in milliseconds
+        bool Wait(unsigned long timeout);
+
+        // open clips and the last history_ finished ones, oldest first
+        std::vector<ClipInfo> Clips();
+        ClipRingStats Stats();
+
+    private:
+        struct Unit
+        {
+            GstBuffer* buffer;
+            GstClockTime time;      // DTS, PTS without one
+            bool keyframe;
+        };
+
+        struct Clip
+        {
+            ClipInfo info;
+            GstElement* pipeline = nullptr;
+            GstAppSrc* src = nullptr;
+            GstClockTime base = 0;      // stream time written as 0
+            GstClockTime trigger = 0;   // stream time of the first trigger
+            GstClockTime end = 0;       // live units are appended until here
+            bool live = false;
+            std::thread writer;
+        };
+
+        ClipRing(const ClipRing&) = delete;
+        ClipRing& operator=(const ClipRing&) = delete;
+
+        // all with mutex_ held
+        void add(GstBuffer* buffer);
+        void clear();
+        void write(Clip* clip, const Unit& unit);
+        void end(Clip* clip);
+        // joins finished writers, drops clips beyond history_
+        void reap();
+
+        void writeFile(Clip* clip);
+        static GstPadProbeReturn onData(GstPad* pad, GstPadProbeInfo* info, gpointer user_data);
+
+        GstPad* pad_;
+        gulong probe_;
+        GstCaps* caps_;
+        std::string parser_;
+
+        GstClockTime pre_;
+        GstClockTime post_;
+        size_t budget_;
+        std::string muxer_;
+        uint32_t history_;
+
+        std::mutex mutex_;
+        std::condition_variable writtenEvent_;
+        std::deque<Unit> units_;
+        size_t keyframes_;
+        size_t bytes_;
+        uint64_t evicted_;
+        std::vector<std::unique_ptr<Clip>> clips_;
+    };
+
+} // gst
+} // mtsai
+
+#endif // _GST_CLIP_
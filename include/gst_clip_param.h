@@ -0,0 +1,28 @@
+#ifndef _GST_CLIP_PARAM_
+#define _GST_CLIP_PARAM_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+struct GstClipParam
+{
+    // seconds kept before a trigger, 0: no pre-event ring
+    uint32_t preSeconds_ = 0;
+
+    // seconds written after the last trigger of a clip
+    uint32_t postSeconds_ = 10;
+
+    // encoded bytes the ring may hold, whole GOPs are dropped from the front
+    // beyond it (a 4 Mbit/s camera needs ~5 MB for 10 s)
+    size_t budgetBytes_ = 8 * 1024 * 1024;
+
+    // "mp4mux" or "matroskamux"
+    std::string muxer_ = "mp4mux";
+
+    // finished clips Clips() still reports, older ones are forgotten
+    uint32_t history_ = 16;
+};
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef _GST_FRAME_POOL_
+#define _GST_FRAME_POOL_
+
+#include <stdint.h>
+
+#include <gst/gst.h>
+
+#include "image/frame_pool.h"
+
+namespace mtsai
+{
+namespace gst
+{
+
+    /*
+     * GstBufferPool whose buffers are the slots of a FramePool
+     *
+     * Proposed upstream of an appsink, the element in front of it (decoder,
+     * videoconvert, the source) writes its output straight into our aligned /
+     * CUDA mapped memory, and the sample pulled from the appsink is already
+     * where the consumers read it. Slots are sized by the configured caps
+     * when the pool is activated and kept over deactivation, so a pipeline
+     * restarting with the same caps reuses them; buffers carry a GstVideoMeta
+     * with the strides when upstream asked for it.
+     *
+     * At most count buffers exist, held of them may sit with the consumer
+     * (a capture ring): upstream asking for more than count - held buffers
+     * is refused and keeps its own pool instead of stalling on ours. The
+     * pool is returned with a ref the caller owns.
+     */
+    GstBufferPool* NewFrameBufferPool(mtsai::image::FrameMemory memory, uint32_t count, uint32_t held = 0);
+
+    /*
+     * Start of the slot behind a buffer of pool, or of a pool renewed from it
+     * by the allocation probe (plane offsets are relative to it), cuda null
+     * without a device mapping. False when the buffer is not one of those.
+     */
+    bool FrameBufferSlot(GstBuffer* buffer, GstBufferPool* pool, void** cpu, void** cuda);
+
+    // buffers pool allocated so far, a bounded pool stops at its count
+    uint64_t FrameBufferAllocations(GstBufferPool* pool);
+
+    // gives back the pool buffers the owner still holds
+    typedef void (*ReturnBuffersFn)(void* user);
+
+    /*
+     * Answers the ALLOCATION query reaching sink (an appsink) with pool and
+     * the video meta API. Upstream may still decide to use its own pool,
+     * FrameBufferSlot() tells per buffer. A pool with buffers out can not be
+     * reconfigured for new caps, so returnBuffers (may be null) is called
+     * first; when buffers are still out after it, a fresh pool with the same
+     * memory and counts is proposed in its place. Returns the probe id on the
+     * sink pad.
+     */
+    gulong ProposeAllocation(GstElement* sink, GstBufferPool* pool, ReturnBuffersFn returnBuffers = nullptr,
+                             void* user = nullptr);
+
+} // gst
+} // mtsai
+
+#endif // _GST_FRAME_POOL_
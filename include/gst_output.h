@@ -0,0 +1,133 @@
+#ifndef _GST_OUTPUT_
+#define _GST_OUTPUT_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <string>
+
+#include <gst/gst.h>
+#include <gst/app/gstappsrc.h>
+#include <gst/video/video.h>
+
+#include "gst_output_param.h"
+#include "image/frame.h"
+#include "gst_state.h"
+
+// default wait for a pipeline state change / the EOS on Close(), milliseconds
+static const unsigned long GST_OUTPUT_STATE_TIMEOUT = 5000;
+
+// gives the memory of a pushed frame back once GStreamer is done with it
+typedef void (*GstOutputReleaseFn)(void* user);
+
+struct GstOutputStats
+{
+    uint64_t pushed;        // frames handed to appsrc
+    uint64_t dropped;       // refused by Push(): queue full after the timeout, closed, bad layout
+    uint64_t released;      // release callbacks run, pushed + dropped once everything is back
+};
+
+/*
+ * The way back into GStreamer: processed frames pushed into an appsrc in
+ * front of an encode / mux / network or file pipeline
+ *
+ * Frames are not copied. Each one is wrapped in a GstBuffer around
+ * frame.cpu, and release(user) runs when the last element let go of it
+ * (after the encoder read it, or when the pipeline is flushed), so the
+ * caller keeps the memory, a FramePool slot or a held capture, until then.
+ * release runs exactly once per Push(), also when the frame is refused.
+ *
+ * Caps follow the frames: the first frame and every change of format or
+ * size set new caps on appsrc, padded rows travel as a GstVideoMeta.
+ * Timestamps are the frame's captureTime on the pipeline running time,
+ * so the gaps of a variable rate source survive the encoder.
+ *
+ * Backpressure: appsrc holds maxQueued_ frames, beyond that Push() waits
+ * up to its timeout for the encoder and then refuses the frame; a slow
+ * encoder makes the producer skip frames instead of buffering without
+ * bound.
+ */
+class GstOutput
+{
+public:
+    GstOutput();
+    GstOutput(GstOutputParam params);
+    // Close(), then frees the pipeline
+    ~GstOutput();
+
+    bool Init(GstOutputParam params);
+
+    // Feed an appsrc of a pipeline owned elsewhere (an RTSP media) instead of
+    // launching one; launchStr_ / values_ of params are not used. Push()
+    // works until Detach(), Open() / Close() are for launched pipelines only.
+    bool Adopt(GstElement* appsrc, GstOutputParam params);
+    // lets go of the adopted appsrc, a Push() waiting for room gives up.
+    // Frames still in the media are released when it lets go of them, also
+    // after this output is gone.
+    void Detach();
+
+    // Go to PLAYING, timeout in milliseconds
+    mtsai::gst::StateChange Open(unsigned long timeout=GST_OUTPUT_STATE_TIMEOUT);
+    // EOS first and wait for it to reach the sinks (muxers write their
+    // index), then NULL. Frames still queued are released.
+    mtsai::gst::StateChange Close(unsigned long timeout=GST_OUTPUT_STATE_TIMEOUT);
+
+    // Push one frame (frame.cpu), timeout in milliseconds to wait for room in
+    // the queue. False when the frame was refused, release has run then.
+    bool Push(const mtsai::image::FrameDescriptor& frame, GstOutputReleaseFn release, void* user,
+              unsigned long timeout=0);
+
+    GstOutputStats Stats() const;
+
+    inline GstElement* Pipeline() const { return pipeline_; }
+
+private:
+    bool configureSource(GstElement* appsrc, const GstOutputParam& params);
+    bool setCaps(const mtsai::image::FrameDescriptor& frame);
+    GstClockTime timestamp(const mtsai::image::FrameDescriptor& frame);
+    static void releaseFrame(gpointer data);
+    void checkBusMsg();
+    static void printBusMsg(GstMessage* msg, void* user_data);
+
+    // appsrc callbacks, from the streaming thread
+    static void onNeedData(GstAppSrc* src, guint length, gpointer user_data);
+    static void onEnoughData(GstAppSrc* src, gpointer user_data);
+
+    GstBus* bus_;
+    GstAppSrc* appsrc_;
+    GstElement* pipeline_;
+    std::string launchStr_;
+
+    int fpsN_;
+    int fpsD_;
+    uint32_t maxQueued_;
+
+    // layout of the current caps
+    mtsai::image::FrameDescriptor layout_;
+    GstVideoInfo info_;
+    bool hasCaps_;
+
+    // first frame of a run: captureTime and running time it maps to
+    bool started_;
+    uint64_t firstCapture_;
+    GstClockTime firstRunning_;
+    GstClockTime lastPts_;
+
+    // held by Push() around appsrc_, Detach() waits for it
+    std::mutex pushMutex_;
+    std::mutex queueMutex_;
+    std::condition_variable queueEvent_;
+    bool full_;
+    bool open_;
+
+    // set while Open()/Close() read the bus, Push() leaves it alone
+    std::atomic<bool> stateWait_;
+
+    std::atomic<uint64_t> pushed_;
+    std::atomic<uint64_t> dropped_;
+    // shared with the frames in flight, they may come back after this is gone
+    std::shared_ptr<std::atomic<uint64_t>> released_;
+};
+
+#endif // _GST_OUTPUT_
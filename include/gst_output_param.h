@@ -0,0 +1,30 @@
+#ifndef _GST_OUTPUT_PARAM_
+#define _GST_OUTPUT_PARAM_
+
+#include <stdint.h>
+
+#include <map>
+#include <string>
+
+struct GstOutputParam
+{
+    // launch description starting at "appsrc name=mysrc", the encode / mux /
+    // sink part after it, may hold "${name}" placeholders
+    std::string launchStr_;
+
+    // values of the placeholders, see GstCameraParam
+    std::map<std::string, std::string> values_;
+
+    // nominal rate, framerate of the caps and duration of every buffer
+    int fpsN_ = 30;
+    int fpsD_ = 1;
+
+    // frames appsrc queues before Push() waits for the encoder
+    uint32_t maxQueued_ = 4;
+
+    // capture to Push() delay of the processing, reported as the appsrc
+    // latency so sinks with sync=true do not drop the frames as late
+    uint32_t latencyMs_ = 0;
+};
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef _GST_RECORD_
+#define _GST_RECORD_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gst/gst.h>
+
+#include "gst_record_param.h"
+#include "gst_runtime.h"
+#include "gst_state.h"
+
+namespace mtsai
+{
+namespace gst
+{
+
+    struct RecordSegment
+    {
+        uint32_t id;
+        std::string location;
+        uint64_t wallTime;      // ns since the epoch when the segment was opened
+        uint64_t pts;           // stream time of its first keyframe, ns
+    };
+
+    /*
+     * Parser after the depayloader (h264parse / h265parse) of pipeline,
+     * with a ref, null when there is none
+     */
+    GstElement* FindStreamParser(GstElement* pipeline);
+
+    /*
+     * Encoded passthrough recording of a camera pipeline
+     *
+     * Attach() splits the launch at the parser: a tee after it feeds a
+     * splitmuxsink with the parsed access units as they came off the wire,
+     * and the rest of the launch (decoder ... appsink) becomes a second
+     * branch of the tee. Segments are cut on keyframes once the time or
+     * size limit is reached, each one listed in the index.
+     *
+     * The decode branch is gated: with decoding off nothing reaches the
+     * decoder, a recording only camera costs a depayload and a mux. When
+     * it is turned on again the gate waits for the next keyframe, the
+     * decoder never sees a GOP without its start.
+     */
+    class Recorder
+    {
+    public:
+        Recorder();
+        ~Recorder();
+
+        // pipeline in NULL with the parser linked, values for the "${name}" of location_
+        bool Attach(GstElement* pipeline, const GstRecordParam& params, const LaunchValues& values = LaunchValues());
+
+        // EOS down the recording branch only and wait for the open segment
+        // to be closed (an mp4 gets its index), before the pipeline stops
+        bool Finish(Deadline deadline);
+
+        void SetDecoding(bool decoding);
+        inline bool Decoding() const { return decoding_; }
+
+        // segments opened so far, oldest first
+        std::vector<RecordSegment> Segments();
+
+    private:
+        Recorder(const Recorder&) = delete;
+        Recorder& operator=(const Recorder&) = delete;
+
+        // streaming thread of the tee / splitmuxsink
+        static GstPadProbeReturn gateProbe(GstPad* pad, GstPadProbeInfo* info, gpointer user_data);
+        static gchar* onFormatLocation(GstElement* splitmux, guint fragment, GstSample* first, gpointer user_data);
+        static GstBusSyncReply onBusSync(GstBus* bus, GstMessage* msg, gpointer user_data);
+
+        GstElement* splitmux_;
+        GstPad* decodePad_;
+        GstPad* recordPad_;
+        gulong gateProbe_;
+        GstBus* bus_;
+
+        std::string location_;
+        std::string index_;
+
+        std::atomic<bool> decoding_;
+        std::atomic<bool> waitKeyframe_;
+
+        std::mutex mutex_;
+        std::condition_variable closedEvent_;
+        bool finishing_;
+        bool finished_;
+        std::vector<RecordSegment> segments_;
+    };
+
+} // gst
+} // mtsai
+
+#endif // _GST_RECORD_
@@ -0,0 +1,30 @@
+#ifndef _GST_RECORD_PARAM_
+#define _GST_RECORD_PARAM_
+
+#include <stdint.h>
+
+#include <string>
+
+struct GstRecordParam
+{
+    // printf pattern of the segment files with the segment number
+    // ("/data/cam01/%05d.mp4"), may hold "${name}"; exactly one integer
+    // conversion, "%%" for a literal %; empty: no recording
+    std::string location_;
+
+    // "mp4mux" or "matroskamux" (.mkv)
+    std::string muxer_ = "mp4mux";
+
+    // a segment is closed at the first keyframe past either limit, 0: no limit
+    uint32_t segmentSeconds_ = 60;
+    uint64_t segmentBytes_ = 0;
+
+    // oldest segments are deleted beyond this many files, 0 keeps all
+    uint32_t maxFiles_ = 0;
+
+    // one line per segment (number, file, wall clock and stream time of
+    // its first keyframe) appended here, empty: index in memory only
+    std::string index_;
+};
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef _GST_RTSP_SERVER_
+#define _GST_RTSP_SERVER_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gst/gst.h>
+#include <gst/rtsp-server/rtsp-server.h>
+
+#include "gst_rtsp_server_param.h"
+#include "gst_output.h"
+#include "gst_runtime.h"
+
+struct GstRtspClientStats
+{
+    std::string address;
+    std::vector<std::string> paths;     // mounts it set up
+    double connectedMs;                 // since the connection was accepted
+    bool playing;
+};
+
+struct GstRtspMountStats
+{
+    std::string path;
+    uint32_t viewers;
+    uint32_t peakViewers;
+    uint64_t medias;        // pipelines built for the mount, one per run of a shared media
+    uint64_t refused;       // SETUPs answered 503 by the viewer limit
+    GstOutputStats frames;  // frame mounts, zero otherwise
+};
+
+struct GstRtspServerStats
+{
+    uint32_t clients;
+    uint64_t connections;   // accepted since Start()
+    uint64_t refused;       // closed by the client limit
+    std::vector<GstRtspClientStats> clientStats;
+    std::vector<GstRtspMountStats> mounts;
+};
+
+/*
+ * In-process RTSP server restreaming cameras and processed output
+ *
+ * Every mount is a shared media factory: the first viewer builds the
+ * pipeline, the ones after it get their own RTP streams of the same
+ * payloader, so N viewers cost one decode / encode. The media is torn
+ * down again when the last viewer leaves.
+ *
+ * Mount() serves a launch description, e.g. a camera URL depayed and
+ * payed again without re-encoding. MountFrames() serves frames pushed
+ * from the process: its GstOutput feeds the appsrc of the running media
+ * and refuses (releases) frames while nobody watches, so an unwatched
+ * mount encodes nothing.
+ *
+ * The server runs its own main context on a thread of its own; mounts
+ * are added before Start() and live as long as the server.
+ */
+class GstRtspServer
+{
+public:
+    GstRtspServer();
+    GstRtspServer(GstRtspServerParam params);
+    // Stop(), then frees the mounts
+    ~GstRtspServer();
+
+    bool Init(GstRtspServerParam params);
+
+    // launchTemplate without the brackets, "${name}" placeholders filled from
+    // values, the payloaders named pay0, pay1, ...; maxViewers 0 takes the
+    // server default
+    bool Mount(const std::string& path, const std::string& launchTemplate,
+               const mtsai::gst::LaunchValues& values = mtsai::gst::LaunchValues(), uint32_t maxViewers = 0);
+
+    // params.launchStr_ starts at "appsrc name=mysrc" and ends in a payloader
+    // named pay0. The returned output belongs to the server, Push() frames
+    // into it from any thread.
+    GstOutput* MountFrames(const std::string& path, GstOutputParam params, uint32_t maxViewers = 0);
+
+    // listen and serve, false when the port can not be bound
+    bool Start();
+    // closes every client and session, the server can be started again
+    void Stop();
+
+    // port actually listened on, -1 before Start()
+    int BoundPort() const;
+
+    GstRtspServerStats Stats();
+
+private:
+    struct MountPoint
+    {
+        GstRtspServer* server;
+        std::string path;
+        GstRTSPMediaFactory* factory;
+        std::unique_ptr<GstOutput> output;
+        GstOutputParam outputParam;
+        GstRTSPMedia* media;            // running media of a frame mount, compared only
+        uint32_t maxViewers;
+        uint32_t viewers;
+        uint32_t peakViewers;
+        uint64_t medias;
+        uint64_t refused;
+    };
+
+    struct Client
+    {
+        std::string address;
+        uint64_t connectedAt;
+        std::vector<MountPoint*> mounts;
+        bool playing;
+    };
+
+    GstRtspServer(const GstRtspServer&) = delete;
+    GstRtspServer& operator=(const GstRtspServer&) = delete;
+
+    // frames null for a launch mount
+    MountPoint* addMount(const std::string& path, const std::string& launch, uint32_t maxViewers,
+                         const GstOutputParam* frames);
+    MountPoint* findMount(GstRTSPContext* ctx);
+
+    // server / client / factory / media signals, on the server thread
+    static void onClientConnected(GstRTSPServer* server, GstRTSPClient* client, gpointer user_data);
+    static void onClientClosed(GstRTSPClient* client, gpointer user_data);
+    static GstRTSPStatusCode onPreSetup(GstRTSPClient* client, GstRTSPContext* ctx, gpointer user_data);
+    static void onSetup(GstRTSPClient* client, GstRTSPContext* ctx, gpointer user_data);
+    static void onPlay(GstRTSPClient* client, GstRTSPContext* ctx, gpointer user_data);
+    static void onTeardown(GstRTSPClient* client, GstRTSPContext* ctx, gpointer user_data);
+    static void onMediaConfigure(GstRTSPMediaFactory* factory, GstRTSPMedia* media, gpointer user_data);
+    static void onMediaUnprepared(GstRTSPMedia* media, gpointer user_data);
+    static gboolean onCleanup(gpointer user_data);
+
+    GstRTSPServer* server_;
+    GstRTSPMountPoints* mountPoints_;
+    GMainContext* context_;
+    GMainLoop* loop_;
+    std::thread thread_;
+    guint serverSource_;
+    GSource* cleanupSource_;
+
+    uint32_t maxClients_;
+    uint32_t maxViewers_;
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<MountPoint>> mountList_;
+    std::map<GstRTSPClient*, Client> clients_;
+    uint64_t connections_;
+    uint64_t refused_;
+};
+
+#endif // _GST_RTSP_SERVER_
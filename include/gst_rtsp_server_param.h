@@ -0,0 +1,25 @@
+#ifndef _GST_RTSP_SERVER_PARAM_
+#define _GST_RTSP_SERVER_PARAM_
+
+#include <stdint.h>
+
+#include <string>
+
+struct GstRtspServerParam
+{
+    std::string address_ = "0.0.0.0";
+
+    // port to listen on, "0" takes a free one (GstRtspServer::BoundPort())
+    std::string service_ = "8554";
+
+    // open RTSP connections, more are closed right away; 0 no limit
+    uint32_t maxClients_ = 0;
+
+    // RTSP sessions over all mounts, the session pool answers 503 beyond; 0 no limit
+    uint32_t maxSessions_ = 0;
+
+    // clients watching one mount, for mounts that do not set their own; 0 no limit
+    uint32_t maxViewers_ = 0;
+};
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef _GST_RUNTIME_
+#define _GST_RUNTIME_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gst/gst.h>
+
+namespace mtsai
+{
+namespace gst
+{
+
+    /*
+     * gst_init_check() and the debug log setup, done once per process no
+     * matter how many cameras call it or from which threads. Later calls
+     * return the first result.
+     */
+    bool Init();
+
+    /*
+     * Factory names of a launch description, in order, without caps filters
+     * and pad references ("t.", "mux.sink_0")
+     */
+    std::vector<std::string> LaunchFactories(const std::string& launch);
+
+    /*
+     * Loads the plugins behind the factories up front so the first pipeline
+     * of each kind does not pay for the dlopen and type registration.
+     * Returns the number of factories found, missing ones are printed.
+     */
+    size_t WarmRegistry(const std::vector<std::string>& factories);
+
+    typedef std::map<std::string, std::string> LaunchValues;
+
+    /*
+     * Launch templates with their plugins preloaded: "${name}" placeholders
+     * stand for the per camera values (location, port, ...), so forty RTSP
+     * cameras share one template. A template is split, its factories looked
+     * up and their plugins loaded once, and the factories are held for the
+     * life of the entry. No parsed pipeline is kept: Instantiate() still runs
+     * gst_parse_launch on the expanded text, it only skips the registry
+     * lookups and plugin loads, which are the slow part of a cold start.
+     * A template with an unknown element is not kept, and past kMaxTemplates
+     * the least recently used one is dropped, so launch strings with the
+     * values written in (no placeholders) do not grow the cache without
+     * bound.
+     */
+    class LaunchTemplateCache
+    {
+    public:
+        static LaunchTemplateCache& Instance();
+
+        // new pipeline (floating ref sunk, caller owns it) or NULL with error set
+        GstElement* Instantiate(const std::string& launchTemplate, const LaunchValues& values, std::string* error = nullptr);
+
+        // description with the placeholders substituted, false when one has no value
+        bool Expand(const std::string& launchTemplate, const LaunchValues& values, std::string* launch, std::string* error = nullptr);
+
+        size_t Size();
+        void Clear();
+
+        static const size_t kMaxTemplates = 64;
+
+    private:
+        struct Template
+        {
+            // literal text and placeholder names alternate, starting with text
+            std::vector<std::string> pieces;
+            std::vector<GstElementFactory*> factories;
+            std::string error;
+            uint64_t lastUse = 0;
+
+            ~Template();
+        };
+
+        LaunchTemplateCache(): uses_{0} {}
+        std::shared_ptr<Template> lookup(const std::string& launchTemplate);
+        static bool expand(const Template& entry, const LaunchValues& values, std::string* launch, std::string* error);
+
+        std::mutex mutex_;
+        std::map<std::string, std::shared_ptr<Template>> templates_;
+        uint64_t uses_;
+    };
+
+} // gst
+} // mtsai
+
+#endif // _GST_RUNTIME_
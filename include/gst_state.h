@@ -0,0 +1,68 @@
+#ifndef _GST_STATE_
+#define _GST_STATE_
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <gst/gst.h>
+
+namespace mtsai
+{
+namespace gst
+{
+
+    enum StateResult
+    {
+        STATE_CHANGED = 0,      // target state reached
+        STATE_NO_PREROLL,       // live source, reached without prerolling (PAUSED on a live pipeline)
+        STATE_TIMEOUT,          // no ASYNC_DONE or ERROR before the deadline
+        STATE_FAILED            // set_state failed or an element posted ERROR
+    };
+
+    typedef std::chrono::steady_clock::time_point Deadline;
+
+    // now + timeout milliseconds
+    Deadline DeadlineIn(unsigned long timeout);
+
+    struct StateChange
+    {
+        StateResult result = STATE_FAILED;
+        GstState target    = GST_STATE_VOID_PENDING;
+        GstState reached   = GST_STATE_VOID_PENDING;    // state of the pipeline when the wait ended
+        double elapsedMs   = 0.0;
+        std::string error;      // "element: message" of the ERROR, empty otherwise
+
+        inline bool Ok() const { return result == STATE_CHANGED || result == STATE_NO_PREROLL; }
+        explicit operator bool() const { return Ok(); }
+    };
+
+    const char* StateResultName(StateResult result);
+
+    // bus messages that are not part of the state change, for the caller's logging
+    typedef void (*BusMessageFn)(GstMessage* msg, void* user);
+
+    /*
+     * Set the pipeline state and wait until it is reached: returns at once for
+     * SUCCESS / NO_PREROLL / FAILURE, waits on the bus for ASYNC_DONE or ERROR
+     * for ASYNC, and gives up at the deadline. Messages read from the bus on
+     * the way are handed to onMessage (may be null).
+     *
+     * Nothing else should pop the pipeline bus while this waits; the pipeline
+     * is left as it is on timeout or failure.
+     */
+    StateChange SetState(GstElement* pipeline, GstState state, Deadline deadline,
+                         BusMessageFn onMessage = nullptr, void* user = nullptr);
+
+    /*
+     * SetState() on every pipeline at once, one thread each, all against the
+     * same deadline, so the total time follows the slowest pipeline.
+     * Results are in the order of pipelines.
+     */
+    std::vector<StateChange> SetStateAll(const std::vector<GstElement*>& pipelines, GstState state, Deadline deadline,
+                                         BusMessageFn onMessage = nullptr, void* user = nullptr);
+
+} // gst
+} // mtsai
+
+#endif // _GST_STATE_
@@ -0,0 +1,129 @@
+#ifndef MTSAI_IMAGE_COLOUR_H
+#define MTSAI_IMAGE_COLOUR_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// the per pixel helpers are shared with the CUDA kernels
+#ifdef __CUDACC__
+#define MTSAI_COLOUR_FN __host__ __device__ inline
+#else
+#define MTSAI_COLOUR_FN inline
+#endif
+
+namespace mtsai
+{
+namespace image
+{
+
+    enum ColourMatrix
+    {
+        COLOUR_BT601 = 0,       // SD, also most USB and analogue cameras
+        COLOUR_BT709,           // HD
+        COLOUR_BT2020
+    };
+
+    enum ColourRange
+    {
+        COLOUR_RANGE_LIMITED = 0,   // Y 16-235, CbCr 16-240
+        COLOUR_RANGE_FULL           // 0-255 (JPEG)
+    };
+
+    struct ColourSpace
+    {
+        ColourMatrix matrix = COLOUR_BT601;
+        ColourRange range   = COLOUR_RANGE_LIMITED;
+    };
+
+    // fractional bits of the fixed point coefficients
+    const int kColourShift = 13;
+    const int kColourRound = 1 << (kColourShift - 1);
+
+    /*
+     * YCbCr -> RGB, coefficients scaled by 2^kColourShift
+     *   t = (Y - yOffset) * y + round
+     *   R = (t + crR * (Cr - 128)) >> kColourShift
+     *   G = (t - cbG * (Cb - 128) - crG * (Cr - 128)) >> kColourShift
+     *   B = (t + cbB * (Cb - 128)) >> kColourShift
+     * clamped to 0-255. All fit 16 bits so SIMD paths can use madd.
+     */
+    struct YuvToRgbCoeffs
+    {
+        int32_t y;
+        int32_t crR;
+        int32_t cbG;
+        int32_t crG;
+        int32_t cbB;
+        int32_t yOffset;
+    };
+
+    /*
+     * RGB -> YCbCr, coefficients scaled by 2^kColourShift, the chroma rows
+     * sum to zero
+     *   Y  = (yR * R + yG * G + yB * B + round) >> kColourShift + yOffset
+     *   Cb = (cbR * R + cbG * G + cbB * B + round) >> kColourShift + 128
+     *   Cr = (crR * R + crG * G + crB * B + round) >> kColourShift + 128
+     */
+    struct RgbToYuvCoeffs
+    {
+        int32_t yR, yG, yB;
+        int32_t cbR, cbG, cbB;
+        int32_t crR, crG, crB;
+        int32_t yOffset;
+    };
+
+    // precomputed for every matrix and range
+    const YuvToRgbCoeffs& GetYuvToRgbCoeffs(const ColourSpace& colour);
+    const RgbToYuvCoeffs& GetRgbToYuvCoeffs(const ColourSpace& colour);
+
+    /*
+     * Float form of the same conversion for float pipelines,
+     * rgb[j] = matrix[j * 3 + 0] * Y + matrix[j * 3 + 1] * Cb + matrix[j * 3 + 2] * Cr + offset[j]
+     * with components and results in 0-255
+     */
+    void GetYuvToRgbMatrix(const ColourSpace& colour, float matrix[9], float offset[3]);
+
+    /*
+     * GStreamer caps colorimetry ("bt601", "bt709", "bt2020", "sRGB",
+     * "jpeg" or the "range:matrix:transfer:primaries" form). Returns false
+     * and leaves colour unchanged when the string is not understood.
+     */
+    bool ParseColorimetry(const char* colorimetry, ColourSpace* colour);
+
+    const char* ColourSpaceName(const ColourSpace& colour);
+
+    MTSAI_COLOUR_FN uint8_t clampColour(int32_t v)
+    {
+        return (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v);
+    }
+
+    MTSAI_COLOUR_FN void YuvToRgb(const YuvToRgbCoeffs& k, int32_t y, int32_t cb, int32_t cr,
+                                  uint8_t* r, uint8_t* g, uint8_t* b)
+    {
+        const int32_t t = (y - k.yOffset) * k.y + kColourRound;
+        const int32_t u = cb - 128;
+        const int32_t v = cr - 128;
+
+        *r = clampColour((t + k.crR * v) >> kColourShift);
+        *g = clampColour((t - k.cbG * u - k.crG * v) >> kColourShift);
+        *b = clampColour((t + k.cbB * u) >> kColourShift);
+    }
+
+    MTSAI_COLOUR_FN void RgbToYuv(const RgbToYuvCoeffs& k, int32_t r, int32_t g, int32_t b,
+                                  uint8_t* y, uint8_t* cb, uint8_t* cr)
+    {
+        *y  = clampColour(((k.yR * r + k.yG * g + k.yB * b + kColourRound) >> kColourShift) + k.yOffset);
+        *cb = clampColour(((k.cbR * r + k.cbG * g + k.cbB * b + kColourRound) >> kColourShift) + 128);
+        *cr = clampColour(((k.crR * r + k.crG * g + k.crB * b + kColourRound) >> kColourShift) + 128);
+    }
+
+    /*
+     * Packed RGB (step 3) or RGBA (step 4) to UYVY, Cb Y0 Cr Y1, the chroma
+     * of a pixel pair is the average of both. width must be even.
+     */
+    void RGBtoUYVYRow(const uint8_t* src, size_t step, uint8_t* dst, size_t width, const RgbToYuvCoeffs& k);
+
+} // image
+} // mtsai
+
+#endif
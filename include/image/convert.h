@@ -0,0 +1,143 @@
+#ifndef MTSAI_IMAGE_CONVERT_H
+#define MTSAI_IMAGE_CONVERT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "image/colour.h"
+#include "image/frame.h"
+#include "image/pixel.h"
+
+namespace mtsai
+{
+namespace image
+{
+
+    enum ConvertBackendType
+    {
+        CONVERT_BACKEND_AUTO = 0,
+        CONVERT_BACKEND_CPU,
+        CONVERT_BACKEND_CUDA
+    };
+
+    /*
+     * Colour conversion backend used by camera::Convert*
+     *
+     * Conversions write interleaved RGBA, either 8 bit (rounded, saturated,
+     * alpha 255) or float (intensity 0-255). YCbCr sources go through the
+     * fixed point matrix of the given colour space (image/colour.h), float
+     * output holds the same values as 8 bit. Source and destination must live
+     * in memory the backend can address, allocate the destination with
+     * Alloc() of the same backend.
+     */
+    class ConvertBackend
+    {
+    public:
+        virtual ~ConvertBackend() {}
+
+        virtual const char* Name() const = 0;
+        virtual ConvertBackendType Type() const = 0;
+
+        // Usable on this machine (e.g. a CUDA device is present)
+        virtual bool Available() const = 0;
+
+        virtual void* Alloc(size_t size) = 0;
+        virtual void Free(void* ptr) = 0;
+
+        // NV12, full-height luma plane followed by interleaved CbCr
+        virtual bool NV12toRGBA(const uint8_t* src, void* dst, PixelType type, size_t width, size_t height,
+                                const ColourSpace& colour) = 0;
+
+        // Packed 4:2:2 in Cb Y0 Cr Y1 order (RTP YCbCr-4:2:2)
+        virtual bool UYVYtoRGBA(const uint8_t* src, void* dst, PixelType type, size_t width, size_t height,
+                                const ColourSpace& colour) = 0;
+
+        // Packed RGB, float alpha is written as 0
+        virtual bool RGBtoRGBA(const uint8_t* src, void* dst, PixelType type, size_t width, size_t height) = 0;
+
+        // 8 bit Bayer GRBG, float alpha is written as 0
+        virtual bool BayerGR8toRGBA(const uint8_t* src, void* dst, PixelType type, size_t width, size_t height) = 0;
+
+        // Inference boundary, 8 bit RGBA to float RGBA (0-255)
+        virtual bool RGBA8toRGBAf(const uint8_t* src, float* dst, size_t width, size_t height) = 0;
+
+        /*
+         * Any capture frame by its descriptor, src is the buffer start the
+         * plane offsets refer to and dst a tightly packed frame.width *
+         * frame.height RGBA image. Picks the conversion from frame.fourcc
+         * and decodes YUV with frame.colour. The default only takes packed
+         * frames of the formats above, backends override it to read strided
+         * rows in place.
+         */
+        virtual bool ConvertFrame(const FrameDescriptor& frame, const void* src, void* dst, PixelType type);
+
+        template<typename T>
+        inline bool NV12toRGBA(const uint8_t* src, T* dst, size_t width, size_t height,
+                               const ColourSpace& colour = ColourSpace())
+        {
+            return NV12toRGBA(src, (void*)dst, PixelTraits<T>::type, width, height, colour);
+        }
+
+        template<typename T>
+        inline bool UYVYtoRGBA(const uint8_t* src, T* dst, size_t width, size_t height,
+                               const ColourSpace& colour = ColourSpace())
+        {
+            return UYVYtoRGBA(src, (void*)dst, PixelTraits<T>::type, width, height, colour);
+        }
+
+        template<typename T>
+        inline bool RGBtoRGBA(const uint8_t* src, T* dst, size_t width, size_t height)
+        {
+            return RGBtoRGBA(src, (void*)dst, PixelTraits<T>::type, width, height);
+        }
+
+        template<typename T>
+        inline bool BayerGR8toRGBA(const uint8_t* src, T* dst, size_t width, size_t height)
+        {
+            return BayerGR8toRGBA(src, (void*)dst, PixelTraits<T>::type, width, height);
+        }
+
+        // float (4 floats per pixel) shorthands
+        inline bool NV12toRGBAf(const uint8_t* src, float* dst, size_t width, size_t height,
+                                const ColourSpace& colour = ColourSpace())
+        {
+            return NV12toRGBA(src, (void*)dst, PIXEL_TYPE_RGBAF, width, height, colour);
+        }
+
+        inline bool UYVYtoRGBAf(const uint8_t* src, float* dst, size_t width, size_t height,
+                                const ColourSpace& colour = ColourSpace())
+        {
+            return UYVYtoRGBA(src, (void*)dst, PIXEL_TYPE_RGBAF, width, height, colour);
+        }
+
+        inline bool RGBtoRGBAf(const uint8_t* src, float* dst, size_t width, size_t height)
+        {
+            return RGBtoRGBA(src, (void*)dst, PIXEL_TYPE_RGBAF, width, height);
+        }
+
+        inline bool BayerGR8toRGBAf(const uint8_t* src, float* dst, size_t width, size_t height)
+        {
+            return BayerGR8toRGBA(src, (void*)dst, PIXEL_TYPE_RGBAF, width, height);
+        }
+    };
+
+    /*
+     * Make a backend selectable, the registry does not take ownership.
+     * The CPU backend needs no registration and is always available.
+     */
+    void RegisterConvertBackend(ConvertBackend* backend);
+
+    /*
+     * Select a backend at runtime
+     * CONVERT_BACKEND_AUTO honours the GSTCAMERA_CONVERT environment variable
+     * ("cpu" or "cuda"), otherwise prefers an available CUDA backend.
+     * Falls back to the CPU backend when the requested one is unavailable.
+     */
+    ConvertBackend* GetConvertBackend(ConvertBackendType type = CONVERT_BACKEND_AUTO);
+
+    ConvertBackend* GetCpuConvertBackend();
+
+} // image
+} // mtsai
+
+#endif
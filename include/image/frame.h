@@ -0,0 +1,103 @@
+#ifndef MTSAI_IMAGE_FRAME_H
+#define MTSAI_IMAGE_FRAME_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "image/colour.h"
+
+namespace mtsai
+{
+namespace image
+{
+
+#define MTSAI_FOURCC(a, b, c, d) \
+    ((uint32_t)(uint8_t)(a) | ((uint32_t)(uint8_t)(b) << 8) | ((uint32_t)(uint8_t)(c) << 16) | ((uint32_t)(uint8_t)(d) << 24))
+
+    // same codes as V4L2 so v4l2 formats map one to one
+    const uint32_t FOURCC_NV12  = MTSAI_FOURCC('N', 'V', '1', '2');    // luma plane, interleaved CbCr plane
+    const uint32_t FOURCC_UYVY  = MTSAI_FOURCC('U', 'Y', 'V', 'Y');    // Cb Y0 Cr Y1
+    const uint32_t FOURCC_YUYV  = MTSAI_FOURCC('Y', 'U', 'Y', 'V');    // Y0 Cb Y1 Cr
+    const uint32_t FOURCC_RGB24 = MTSAI_FOURCC('R', 'G', 'B', '3');
+    const uint32_t FOURCC_BGR24 = MTSAI_FOURCC('B', 'G', 'R', '3');
+    const uint32_t FOURCC_GRBG8 = MTSAI_FOURCC('G', 'R', 'B', 'G');    // Bayer GR 8 bit
+    const uint32_t FOURCC_GREY  = MTSAI_FOURCC('G', 'R', 'E', 'Y');
+
+    const int kMaxFramePlanes = 2;
+
+    struct FramePlane
+    {
+        size_t offset = 0;      // bytes from the start of the buffer
+        size_t stride = 0;      // bytes from one row to the next
+    };
+
+    /*
+     * Geometry and timing of one captured frame
+     *
+     * Every capture backend fills one per frame, so consumers read the
+     * buffer where it is instead of assuming width * bytes per pixel rows.
+     * cpu / cuda point to the start of the buffer (plane offsets are
+     * relative to it), either may be null when the backend has no such
+     * mapping.
+     */
+    struct FrameDescriptor
+    {
+        uint32_t fourcc     = 0;
+        uint32_t width      = 0;
+        uint32_t height     = 0;
+        uint32_t planeCount = 0;
+        FramePlane planes[kMaxFramePlanes];
+        size_t size         = 0;        // bytes of the whole buffer
+
+        ColourSpace colour;             // YUV formats
+
+        uint64_t pts         = 0;       // ns, timestamp of the source (stream / device clock), 0 when unknown
+        uint64_t captureTime = 0;       // ns, FrameClockNow() when the backend received it
+        uint64_t sequence    = 0;       // frame counter of the source
+        uint32_t sourceId    = 0;       // NewFrameSourceId() of the backend instance
+
+        void* cpu  = nullptr;
+        void* cuda = nullptr;
+    };
+
+    /*
+     * Fills the plane layout for fourcc, rows stride bytes apart (0 for
+     * tightly packed), NV12 chroma right below the luma with the same stride
+     * and (height + 1) / 2 rows.
+     * Keeps the timing fields and pointers. False for an unknown fourcc or
+     * a stride shorter than a row.
+     */
+    bool DescribeFrame(uint32_t fourcc, uint32_t width, uint32_t height, size_t stride, FrameDescriptor* frame);
+
+    // bytes of one row of plane without padding, 0 for an unknown fourcc
+    size_t FrameRowBytes(uint32_t fourcc, uint32_t width, uint32_t plane);
+
+    // rows without padding and planes back to back, what the width / height
+    // only conversions expect
+    bool IsPackedFrame(const FrameDescriptor& frame);
+
+    // GStreamer video/x-raw format string ("NV12", "UYVY", "YUY2", "RGB", ...)
+    // or video/x-bayer "grbg", 0 when there is no matching fourcc
+    uint32_t FourccFromGstFormat(const char* format);
+
+    // the other way, null when fourcc has no GStreamer format
+    const char* GstFormatFromFourcc(uint32_t fourcc);
+
+    // four characters and a terminating zero
+    void FourccToString(uint32_t fourcc, char str[5]);
+
+    // steady clock in ns, the captureTime base
+    uint64_t FrameClockNow();
+
+    // unique per process, one per capture backend instance
+    uint32_t NewFrameSourceId();
+
+    inline const uint8_t* FramePlaneData(const FrameDescriptor& frame, const void* base, uint32_t plane)
+    {
+        return (const uint8_t*)base + frame.planes[plane].offset;
+    }
+
+} // image
+} // mtsai
+
+#endif
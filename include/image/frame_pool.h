@@ -0,0 +1,106 @@
+#ifndef MTSAI_IMAGE_FRAME_POOL_H
+#define MTSAI_IMAGE_FRAME_POOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <vector>
+
+namespace mtsai
+{
+namespace image
+{
+
+    enum FrameMemory
+    {
+        FRAME_MEMORY_MAPPED = 0,    // cudaAllocMapped(): pinned and device mapped, aligned host memory without CUDA
+        FRAME_MEMORY_HUGEPAGE,      // CPU only, 2 MB pages when the kernel has them
+        FRAME_MEMORY_EXTERNAL       // nothing allocated, slots hold memory owned elsewhere (a GstBuffer)
+    };
+
+    const char* FrameMemoryName(FrameMemory memory);
+
+    // gives external memory back to its owner
+    typedef void (*FrameReleaseFn)(void* handle);
+
+    struct FramePoolStats
+    {
+        size_t slotBytes;           // held by the current slots
+        size_t retiredBytes;        // slots of an old size, waiting for Recycle()
+        uint64_t allocations;
+        uint64_t frees;
+        uint32_t hugePages;         // slots on explicit huge pages (MAP_HUGETLB)
+    };
+
+    /*
+     * Fixed number of frame slots of one size, the memory behind a capture ring
+     *
+     * Reserve() sizes the slots when the caps are known. A new size retires
+     * the current slots instead of freeing them, a reader may still hold the
+     * last frame; Recycle() frees them once it let go. Sizes that still fit
+     * and use at least half of a slot keep the memory, so a reconnect with
+     * the same caps allocates nothing. Everything is freed by Release() or
+     * the destructor. External slots are attached per frame and released
+     * when the slot is attached again.
+     *
+     * Not thread safe, the owner's ring lock covers it.
+     */
+    class FramePool
+    {
+    public:
+        FramePool(FrameMemory memory, uint32_t count);
+        ~FramePool();
+
+        // slots of at least size bytes, false when an allocation failed (the
+        // pool is then empty). External pools only record the size.
+        bool Reserve(size_t size);
+
+        // external pools: slot n now holds cpu / cuda, its previous memory is released
+        bool Attach(uint32_t n, void* cpu, void* cuda, size_t size, void* handle, FrameReleaseFn release);
+
+        // frees the slots retired by Reserve()
+        void Recycle();
+
+        // frees / releases everything, Reserve() may be called again
+        void Release();
+
+        inline FrameMemory Memory() const     { return memory_; }
+        inline uint32_t Count() const         { return (uint32_t)slots_.size(); }
+        inline size_t Capacity() const        { return capacity_; }
+        inline bool Ready() const             { return capacity_ > 0; }
+        inline void* CPU(uint32_t n) const    { return slots_[n].cpu; }
+        inline void* CUDA(uint32_t n) const   { return slots_[n].cuda; }
+
+        FramePoolStats Stats() const;
+
+    private:
+        struct Block
+        {
+            void* cpu = nullptr;
+            void* cuda = nullptr;
+            size_t bytes = 0;
+            size_t mapped = 0;              // mmap length, 0 when not mmapped
+            bool huge = false;              // MAP_HUGETLB
+            void* handle = nullptr;         // external owner
+            FrameReleaseFn release = nullptr;
+        };
+
+        FramePool(const FramePool&) = delete;
+        FramePool& operator=(const FramePool&) = delete;
+
+        bool allocBlock(Block* block, size_t size);
+        void freeBlock(Block* block);
+
+        FrameMemory memory_;
+        size_t capacity_;
+        std::vector<Block> slots_;
+        std::vector<Block> retired_;
+
+        uint64_t allocations_;
+        uint64_t frees_;
+    };
+
+} // image
+} // mtsai
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef MTSAI_IMAGE_MOTION_ESTIMATE_H
+#define MTSAI_IMAGE_MOTION_ESTIMATE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+#include "image/resize.h"
+
+namespace mtsai
+{
+namespace image
+{
+
+    // where the luma samples of a capture frame are
+    enum LumaLayout
+    {
+        LUMA_PLANAR = 0,        // GRAY8, NV12, I420, the Y plane comes first
+        LUMA_YUYV,              // packed 4:2:2, Y0 Cb Y1 Cr
+        LUMA_UYVY               // packed 4:2:2, Cb Y0 Cr Y1 (RTP YCbCr-4:2:2)
+    };
+
+    /*
+     * Block matching motion estimation on the CPU
+     *
+     * Luma is averaged down 2x2 and every 8x8 block of the half resolution
+     * image (16x16 pixels, one arrow cell of MotionFieldRenderer) is matched
+     * against the previous frame by SAD, full search within +-searchRange
+     * half resolution pixels. A small cost per step of displacement keeps
+     * flat and noisy areas at zero, blocks whose zero displacement SAD is
+     * under the noise threshold are not searched at all.
+     *
+     * The output is the cudaMotionFields layout, (width / 2) x (height / 2)
+     * interleaved vx, vy floats in full resolution pixels, every vector of a
+     * block holds the block's motion. Vectors outside whole blocks are 0.
+     * Block rows are split over worker threads.
+     */
+    class MotionEstimator
+    {
+    public:
+        // threads 0 picks the hardware concurrency, at most 8
+        explicit MotionEstimator(int searchRange = 8, int threads = 0);
+        ~MotionEstimator();
+
+        // frame.pitch is the luma row pitch in bytes, the first frame and
+        // the first after a size change give an all zero field
+        bool Estimate(const ImageView& frame, LumaLayout layout, float* field);
+
+        // forget the previous frame
+        void Reset();
+
+        // mean absolute luma difference per pixel tolerated as still
+        inline void SetNoiseThreshold(int threshold) { noise_ = threshold < 0 ? 0 : threshold; }
+        inline int GetNoiseThreshold() const { return noise_; }
+
+        inline int GetSearchRange() const { return range_; }
+        inline int GetThreads() const { return threads_; }
+
+        // blocks with a non zero vector in the last Estimate()
+        inline size_t GetMovingBlocks() const { return moving_; }
+
+        // floats of the field of a width x height frame
+        static size_t FieldSize(size_t width, size_t height);
+
+        static const int kBlockSize = 8;
+
+    private:
+        // block rows [row0, row1) of the half resolution frame
+        size_t estimateRows(const ImageView& frame, LumaLayout layout, float* field,
+                            size_t row0, size_t row1);
+
+        int range_;
+        int threads_;
+        int noise_;
+
+        size_t width_;          // half resolution size
+        size_t height_;
+        bool primed_;
+        size_t moving_;
+
+        std::vector<uint8_t> prev_;
+        std::vector<uint8_t> cur_;
+    };
+
+} // image
+} // mtsai
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef MTSAI_IMAGE_MOTION_FIELD_H
+#define MTSAI_IMAGE_MOTION_FIELD_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+#include "image/pixel.h"
+#include "image/resize.h"
+
+namespace mtsai
+{
+namespace image
+{
+
+    enum MotionDirection
+    {
+        MOTION_N = 0,
+        MOTION_NE,
+        MOTION_E,
+        MOTION_SE,
+        MOTION_S,
+        MOTION_SW,
+        MOTION_W,
+        MOTION_NW,
+        MOTION_NONE
+    };
+
+    // one arrow per grid cell
+    struct MotionArrow
+    {
+        int32_t x;                  // top left of the cell in pixels
+        int32_t y;
+        MotionDirection direction;
+        int speed;                  // (|vx| + |vy|) / 2, truncated
+    };
+
+    /*
+     * Motion vector visualisation on the CPU
+     *
+     * Reads the field layout of cudaMotionFields, (width / 2) x (height / 2)
+     * interleaved vx, vy floats, one vector per 2x2 pixels. Analyse() samples
+     * it at the top left of every 16x16 cell and quantises the direction
+     * with slope comparisons and a sign lookup table, no trigonometry.
+     * Draw() stamps pre-rotated arrow sprites at the cells that moved,
+     * coloured green / amber / red by speed. Nothing outside the arrows is
+     * touched.
+     */
+    class MotionFieldRenderer
+    {
+    public:
+        MotionFieldRenderer();
+        ~MotionFieldRenderer();
+
+        // width and height of the image the field was computed on
+        size_t Analyse(const float* field, size_t width, size_t height);
+
+        // arrows of the last Analyse() over image
+        bool Draw(const ImageView& image, PixelType type) const;
+
+        // Analyse() then Draw()
+        bool Render(const ImageView& image, PixelType type, const float* field);
+
+        inline const std::vector<MotionArrow>& GetArrows() const { return arrows_; }
+
+        // sector of (vx, vy), y pointing down, MOTION_NONE for a zero vector
+        MotionDirection Quantise(float vx, float vy) const;
+
+        static const int kCellSize = 16;
+
+    private:
+        // sign of vx, sign of vy and dominant axis -> direction
+        MotionDirection directionLut_[16];
+
+        // sprite pixels of every direction, dy * kCellSize + dx
+        std::vector<uint16_t> sprites_[8];
+
+        std::vector<MotionArrow> arrows_;
+    };
+
+} // image
+} // mtsai
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef MTSAI_IMAGE_MOTION_GATE_H
+#define MTSAI_IMAGE_MOTION_GATE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+#include "image/motion_estimate.h"
+#include "image/resize.h"
+
+namespace mtsai
+{
+namespace image
+{
+
+    enum GateDecision
+    {
+        GATE_SKIP = 0,          // nothing changed, reuse the last results
+        GATE_PROCESS
+    };
+
+    struct MotionGateParams
+    {
+        int tileSize      = 32;     // pixels, even
+        int threshold     = 12;     // luma difference a pixel must exceed to count as changed
+        float activity    = 0.04f;  // share of changed pixels that makes a tile active
+        int minTiles      = 1;      // active tiles that make the frame active
+        int onFrames      = 2;      // consecutive active frames before processing starts
+        int offFrames     = 15;     // quiet frames before it stops, also how long a tile stays dirty
+        int refreshFrames = 0;      // process at least every n frames, 0 never forces
+        int margin        = 16;     // pixels added around every dirty region
+    };
+
+    /*
+     * Frame difference change detection between Capture and the consumer
+     *
+     * Luma is averaged down 2x2 and compared with the previous frame, the
+     * pixels over the threshold are counted per tile (SSE2). Active frames
+     * switch the gate to GATE_PROCESS after onFrames in a row, it falls back
+     * to GATE_SKIP after offFrames without activity, so single noisy frames
+     * and short pauses in the motion do not toggle it. Tiles active within
+     * the last offFrames are dirty, 8-connected dirty tiles are merged into
+     * the bounding boxes of GetDirtyRegions() for region detectors.
+     */
+    class MotionGate
+    {
+    public:
+        explicit MotionGate(const MotionGateParams& params = MotionGateParams());
+        ~MotionGate();
+
+        // frame.pitch is the luma row pitch in bytes, the first frame and
+        // the first after a size change are processed
+        GateDecision Update(const ImageView& frame, LumaLayout layout);
+
+        // forget the previous frame and the hysteresis state
+        void Reset();
+
+        inline GateDecision GetDecision() const { return decision_; }
+        inline bool IsActive() const { return active_; }
+
+        // full resolution, clipped to the frame, valid until the next Update()
+        inline const std::vector<Rect>& GetDirtyRegions() const { return regions_; }
+
+        // per tile changed pixels of the last Update(), row major
+        inline const std::vector<uint32_t>& GetTileCounts() const { return counts_; }
+        inline size_t GetTilesX() const { return tilesX_; }
+        inline size_t GetTilesY() const { return tilesY_; }
+        inline size_t GetActiveTiles() const { return activeTiles_; }
+
+        inline uint64_t GetFramesSkipped() const { return skipped_; }
+        inline uint64_t GetFramesProcessed() const { return processed_; }
+
+        inline const MotionGateParams& GetParams() const { return params_; }
+
+    private:
+        void countTiles();
+        void buildRegions();
+
+        MotionGateParams params_;
+
+        size_t width_;          // full resolution size
+        size_t height_;
+        size_t halfWidth_;
+        size_t halfHeight_;
+        size_t tilesX_;
+        size_t tilesY_;
+
+        bool primed_;
+        bool active_;
+        int onCount_;
+        int offCount_;
+        int sinceProcess_;
+        GateDecision decision_;
+        size_t activeTiles_;
+        uint64_t skipped_;
+        uint64_t processed_;
+
+        std::vector<uint8_t> prev_;
+        std::vector<uint8_t> cur_;
+        std::vector<uint32_t> counts_;
+        std::vector<uint16_t> age_;         // frames since the tile was last active
+        std::vector<int32_t> labels_;
+        std::vector<Rect> regions_;
+    };
+
+} // image
+} // mtsai
+
+#endif
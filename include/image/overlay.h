@@ -0,0 +1,110 @@
+#ifndef MTSAI_IMAGE_OVERLAY_H
+#define MTSAI_IMAGE_OVERLAY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+#ifdef HAVE_CUDA
+#include <cuda_runtime.h>
+#endif
+
+#include "image/pixel.h"
+#include "image/resize.h"
+
+namespace mtsai
+{
+namespace image
+{
+
+    enum OverlayStyle
+    {
+        OVERLAY_FILL = 0,
+        OVERLAY_OUTLINE         // border of thickness pixels, drawn inside the box
+    };
+
+    struct OverlayBox
+    {
+        // inclusive bounds in pixels, same convention as the detectNet boxes
+        float left   = 0.0f;
+        float top    = 0.0f;
+        float right  = 0.0f;
+        float bottom = 0.0f;
+
+        PixelRGBA8 color   = {255, 255, 255, 255};  // a is the blend alpha
+        OverlayStyle style = OVERLAY_OUTLINE;
+        int thickness      = 2;
+    };
+
+    /*
+     * Rectangle overlay for detection results
+     *
+     * Boxes are blended in order over an interleaved RGBA image (8 bit or
+     * float), the alpha channel of the image is left alone. The CPU path
+     * decomposes every box into row spans and only visits covered pixels.
+     * The CUDA path bins the boxes into screen tiles first, so each thread
+     * only tests the few boxes touching its tile and empty tiles exit early.
+     */
+    class RectOverlay
+    {
+    public:
+        explicit RectOverlay(int tileSize = 32);
+        ~RectOverlay();
+
+        // CPU path, image in host memory
+        bool Draw(const ImageView& image, PixelType type, const OverlayBox* boxes, size_t count);
+        bool Draw(const ImageView& image, PixelType type, const std::vector<OverlayBox>& boxes);
+
+#ifdef HAVE_CUDA
+        // CUDA path, image in device (or mapped) memory, boxes in host memory
+        bool DrawCUDA(const ImageView& image, PixelType type, const OverlayBox* boxes, size_t count,
+                      cudaStream_t stream = 0);
+#endif
+
+        /*
+         * Bin boxes into tiles, box indices of tile t are
+         * GetTileIndex()[GetTileStart()[t] .. GetTileStart()[t + 1]) in draw order.
+         * Tiles lying inside the hollow part of an outline are not listed.
+         * Returns the number of (tile, box) pairs.
+         */
+        size_t Bin(const OverlayBox* boxes, size_t count, size_t width, size_t height);
+
+        inline int GetTileSize() const { return tileSize_; }
+        inline const std::vector<uint32_t>& GetTileStart() const { return tileStart_; }
+        inline const std::vector<uint32_t>& GetTileIndex() const { return tileIndex_; }
+
+        // box in whole pixels as drawn by both paths, the hollow part of an outline is excluded
+        struct Geometry
+        {
+            int32_t x0, y0, x1, y1;         // covered pixels, inclusive, not clipped
+            int32_t ix0, iy0, ix1, iy1;     // hollow part, empty for fills
+            PixelRGBA8 color;
+        };
+
+    private:
+        // one entry per box, boxes covering no pixel get x0 > x1
+        void buildGeometry(const OverlayBox* boxes, size_t count);
+
+        int tileSize_;
+
+        std::vector<Geometry> geometry_;
+
+        std::vector<uint32_t> tileStart_;
+        std::vector<uint32_t> tileIndex_;
+
+#ifdef HAVE_CUDA
+        bool reserveDevice(size_t boxes, size_t tiles, size_t pairs);
+
+        void* devGeometry_;
+        void* devStart_;
+        void* devIndex_;
+        size_t devGeometryCapacity_;
+        size_t devTileCapacity_;
+        size_t devPairCapacity_;
+#endif
+    };
+
+} // image
+} // mtsai
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef MTSAI_IMAGE_PIXEL_H
+#define MTSAI_IMAGE_PIXEL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef HAVE_CUDA
+#include <vector_types.h>
+#endif
+
+namespace mtsai
+{
+namespace image
+{
+
+    /*
+     * Interleaved RGBA pixel types, layout compatible with CUDA uchar4/float4.
+     * 8 bit is the working format, float is only materialised for inference.
+     */
+    enum PixelType
+    {
+        PIXEL_TYPE_RGBA8 = 0,
+        PIXEL_TYPE_RGBAF
+    };
+
+    struct PixelRGBA8
+    {
+        uint8_t r, g, b, a;
+    };
+
+    struct PixelRGBAf
+    {
+        float r, g, b, a;
+    };
+
+    template<typename T> struct PixelTraits;
+
+    template<> struct PixelTraits<PixelRGBA8>
+    {
+        static const PixelType type = PIXEL_TYPE_RGBA8;
+    };
+
+    template<> struct PixelTraits<PixelRGBAf>
+    {
+        static const PixelType type = PIXEL_TYPE_RGBAF;
+    };
+
+#ifdef HAVE_CUDA
+    template<> struct PixelTraits<uchar4>
+    {
+        static const PixelType type = PIXEL_TYPE_RGBA8;
+    };
+
+    template<> struct PixelTraits<float4>
+    {
+        static const PixelType type = PIXEL_TYPE_RGBAF;
+    };
+#endif
+
+    inline size_t PixelSize(PixelType type)
+    {
+        return (type == PIXEL_TYPE_RGBA8) ? sizeof(PixelRGBA8) : sizeof(PixelRGBAf);
+    }
+
+} // image
+} // mtsai
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef MTSAI_IMAGE_PREPROCESS_H
+#define MTSAI_IMAGE_PREPROCESS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+#include "image/colour.h"
+
+#ifdef HAVE_CUDA
+#include <cuda_runtime.h>
+#endif
+
+namespace mtsai
+{
+namespace image
+{
+
+    enum PixelFormat
+    {
+        PIXEL_NV12 = 0,
+        PIXEL_UYVY,     // Cb Y0 Cr Y1 (RTP YCbCr-4:2:2)
+        PIXEL_YUYV,     // Y0 Cb Y1 Cr
+        PIXEL_RGB,
+        PIXEL_BGR
+    };
+
+    enum TensorType
+    {
+        TENSOR_FLOAT32 = 0,
+        TENSOR_INT8
+    };
+
+    struct PreprocessParams
+    {
+        PixelFormat format = PIXEL_NV12;
+        size_t srcWidth    = 0;
+        size_t srcHeight   = 0;
+
+        // YUV formats only, matrix and range of the source
+        ColourSpace colour;
+
+        // network input size
+        size_t dstWidth    = 0;
+        size_t dstHeight   = 0;
+
+        // out = (pixel - mean[c]) * scale[c], pixel in 0-255, c in output plane order
+        float mean[3]      = {0.0f, 0.0f, 0.0f};
+        float scale[3]     = {1.0f, 1.0f, 1.0f};
+
+        // write planes as B, G, R instead of R, G, B
+        bool bgr           = false;
+
+        // TENSOR_INT8 stores round(out / int8Scale) clamped to [-128, 127]
+        TensorType output  = TENSOR_FLOAT32;
+        float int8Scale    = 1.0f;
+    };
+
+    /*
+     * Fused colour conversion + bilinear resize + normalization
+     *
+     * Reads the camera frame once and writes the planar CHW network input
+     * directly, instead of converting to a full size float4 image, resizing
+     * and normalizing it in separate passes. Sampling tables are built by
+     * Init() and reused for every frame.
+     */
+    class Preprocessor
+    {
+    public:
+        Preprocessor();
+        explicit Preprocessor(const PreprocessParams& params);
+        ~Preprocessor();
+
+        bool Init(const PreprocessParams& params);
+
+        // CPU path, src and dst in host memory
+        bool Process(const uint8_t* src, void* dst);
+
+#ifdef HAVE_CUDA
+        // CUDA path, src and dst in device (or mapped) memory
+        bool ProcessCUDA(const uint8_t* src, void* dst, cudaStream_t stream = 0);
+#endif
+
+        inline const PreprocessParams& GetParams() const { return params_; }
+
+        // bytes written per frame
+        size_t GetOutputSize() const;
+
+    private:
+        // source sample position for one output column or row
+        struct Tap
+        {
+            int32_t i0;     // first sample index
+            int32_t i1;     // second sample index
+            float w;        // weight of the second sample
+        };
+
+        // where one colour component lives in the source frame
+        struct Plane
+        {
+            size_t offset;  // bytes to the first sample
+            size_t step;    // bytes between horizontal samples
+            size_t pitch;   // bytes between rows
+            bool chroma;    // sampled through the chroma taps
+        };
+
+        void processRow(const uint8_t* src, void* dst, size_t y);
+
+        PreprocessParams params_;
+        bool initialized_;
+
+        Plane planes_[3];
+
+        // components -> RGB, clamped to 0-255 when clampRGB_ is set
+        float matrix_[9];
+        float offset_[3];
+        bool clampRGB_;
+
+        std::vector<Tap> lumaX_;
+        std::vector<Tap> lumaY_;
+        std::vector<Tap> chromaX_;
+        std::vector<Tap> chromaY_;
+    };
+
+} // image
+} // mtsai
+
+#endif
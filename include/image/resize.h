@@ -0,0 +1,100 @@
+#ifndef MTSAI_IMAGE_RESIZE_H
+#define MTSAI_IMAGE_RESIZE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace mtsai
+{
+namespace image
+{
+
+    enum ResizeMode
+    {
+        RESIZE_BILINEAR = 0,
+        RESIZE_AREA             // box filter when shrinking, bilinear when enlarging
+    };
+
+    enum ResizeFormat
+    {
+        RESIZE_GRAY8 = 0,
+        RESIZE_RGB8,            // also BGR, channels are not interpreted
+        RESIZE_RGBA8,
+        RESIZE_NV12,            // luma plane followed by CbCr, both with the view pitch
+        RESIZE_GRAYF,
+        RESIZE_RGBAF
+    };
+
+    struct ImageView
+    {
+        void* data    = nullptr;
+        size_t width  = 0;
+        size_t height = 0;
+        size_t pitch  = 0;      // bytes per row, 0 means tightly packed
+    };
+
+    struct Rect
+    {
+        int x      = 0;
+        int y      = 0;
+        int width  = 0;
+        int height = 0;
+    };
+
+    /*
+     * Separable resize on the CPU
+     *
+     * Coefficient tables are built once per (source size, destination size,
+     * mode) and cached, so resizing a stream or a batch of same sized crops
+     * only pays for the filtering. Rows are filtered horizontally into a small
+     * float ring and then vertically, the source is read once.
+     */
+    class Resizer
+    {
+    public:
+        Resizer();
+        ~Resizer();
+
+        bool Resize(const ImageView& src, const ImageView& dst, ResizeFormat format,
+                    ResizeMode mode = RESIZE_BILINEAR);
+
+        // Crop roi out of src and resize it into dst
+        bool ResizeROI(const ImageView& src, const Rect& roi, const ImageView& dst,
+                       ResizeFormat format, ResizeMode mode = RESIZE_BILINEAR);
+
+        // One crop per detection, rois[i] goes to dst[i]
+        bool ResizeBatch(const ImageView& src, const std::vector<Rect>& rois,
+                         const std::vector<ImageView>& dst, ResizeFormat format,
+                         ResizeMode mode = RESIZE_BILINEAR);
+
+        // Number of cached coefficient tables
+        size_t GetCacheSize();
+        void ClearCache();
+
+    private:
+        // Filter taps of one axis, taps weights per output index
+        struct Axis
+        {
+            int taps;
+            std::vector<int32_t> start;
+            std::vector<float> weights;
+        };
+
+        std::shared_ptr<const Axis> getAxis(size_t srcSize, size_t dstSize, ResizeMode mode);
+
+        bool resizePlane(const uint8_t* src, size_t srcPitch, const Rect& roi,
+                         uint8_t* dst, size_t dstPitch, size_t dstWidth, size_t dstHeight,
+                         int channels, bool isFloat, ResizeMode mode);
+
+        std::mutex cacheMutex_;
+        std::map<uint64_t, std::shared_ptr<const Axis>> cache_;
+    };
+
+} // image
+} // mtsai
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef MTSAI_IMAGE_TEXT_H
+#define MTSAI_IMAGE_TEXT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "image/pixel.h"
+#include "image/resize.h"
+
+namespace mtsai
+{
+namespace image
+{
+
+    /*
+     * Text overlay on the CPU, e.g. camera names and timestamps
+     *
+     * Glyphs come from an embedded 8x16 coverage atlas (printable ASCII), no
+     * font file is loaded. Strings are queued with Add() and blended in one
+     * Render() call per frame. The rasterised coverage of every string is
+     * cached by its position, a string that changes keeps its mask and only
+     * the glyph cells that differ are rasterised again (the digits of a
+     * clock). Cache entries not drawn for kCacheFrames renders are dropped.
+     */
+    class TextOverlay
+    {
+    public:
+        // glyphs are magnified scale times (nearest)
+        explicit TextOverlay(int scale = 1);
+        ~TextOverlay();
+
+        // queue a string, (x, y) is its top left corner, color.a is the opacity
+        void Add(const std::string& text, int x, int y, const PixelRGBA8& color);
+
+        // blend the queued strings into image, then empty the queue
+        bool Render(const ImageView& image, PixelType type);
+
+        // Add() and Render() for a single string
+        bool Draw(const ImageView& image, PixelType type, const std::string& text,
+                  int x, int y, const PixelRGBA8& color);
+
+        inline int GetScale() const { return scale_; }
+        int GetGlyphWidth() const;
+        int GetGlyphHeight() const;
+        size_t GetTextWidth(const std::string& text) const;
+
+        // 8x16 atlas coverage of c, NULL outside printable ASCII
+        static const uint8_t* GetGlyph(char c);
+
+        inline size_t GetCacheSize() const { return cache_.size(); }
+        inline void ClearCache() { cache_.clear(); }
+
+        // glyph cells rasterised since construction, cache hits add none
+        inline size_t GetGlyphsRasterised() const { return glyphsRasterised_; }
+
+        static const int kCacheFrames = 30;
+
+    private:
+        struct Command
+        {
+            std::string text;
+            int x;
+            int y;
+            PixelRGBA8 color;
+        };
+
+        // coverage of one string, GetTextWidth() x GetGlyphHeight() bytes
+        struct Entry
+        {
+            std::string text;
+            std::vector<uint8_t> mask;
+            uint64_t lastFrame;
+        };
+
+        void rasterise(Entry& entry, const std::string& text);
+        void rasteriseGlyph(uint8_t* dst, size_t pitch, char c);
+
+        int scale_;
+        uint64_t frame_;
+        size_t glyphsRasterised_;
+
+        std::vector<Command> commands_;
+        std::map<std::pair<int, int>, Entry> cache_;
+    };
+
+} // image
+} // mtsai
+
+#endif
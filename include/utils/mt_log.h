@@ -0,0 +1,116 @@
+#ifndef MTSAI_UTILS_LOG_H
+#define MTSAI_UTILS_LOG_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace mtsai
+{
+namespace utils
+{
+
+    enum LogLevel
+    {
+        LOG_LEVEL_ERROR = 0,
+        LOG_LEVEL_WARNING,
+        LOG_LEVEL_INFO,
+        LOG_LEVEL_DEBUG,
+        LOG_LEVEL_TRACE         // per frame detail
+    };
+
+    const char* LogLevelName(LogLevel level);
+
+    /*
+     * Named source of log lines (one per module, a static object). Holds a
+     * runtime level that overrides the global one, and a rate limit of lines
+     * per second; lines over the limit are counted and reported as one
+     * "suppressed" line when the next second starts.
+     */
+    class LogCategory
+    {
+    public:
+        // ratePerSecond 0 means unlimited
+        explicit LogCategory(const char* name, uint32_t ratePerSecond = 0);
+
+        inline const char* Name() const { return name_; }
+
+        // -1 follows SetLogLevel()
+        inline void SetLevel(int level) { level_ = level; }
+        inline void SetRate(uint32_t ratePerSecond) { rate_ = ratePerSecond; }
+
+        bool Enabled(LogLevel level) const;
+
+        // rate limit, true when the line may be written. *suppressed gets the
+        // lines dropped in the previous window when a new one starts
+        bool Admit(uint64_t now, uint64_t* suppressed);
+
+    private:
+        const char* name_;
+        std::atomic<int> level_;
+        std::atomic<uint32_t> rate_;
+        std::atomic<uint64_t> window_;      // second of the current window
+        std::atomic<uint32_t> count_;       // lines admitted in it
+        std::atomic<uint64_t> dropped_;     // lines over the rate in it
+    };
+
+    struct LogRecord
+    {
+        LogLevel level;
+        const char* category;
+        uint64_t time;          // ns, steady clock
+        const char* text;
+    };
+
+    typedef void (*LogSink)(const LogRecord& record, void* user);
+
+    struct LogStats
+    {
+        uint64_t written;       // lines handed to the sink
+        uint64_t dropped;       // ring full, the line was lost
+        uint64_t suppressed;    // over a category rate limit
+    };
+
+    // global runtime level, LOG_LEVEL_INFO unless MT_LOG_LEVEL (0-4) is set
+    void SetLogLevel(LogLevel level);
+    LogLevel GetLogLevel();
+
+    /*
+     * Formats into a slot of a lock-free ring and returns, a background
+     * thread writes the slot to the sink. Never blocks and never touches
+     * stdout on the calling thread; when the ring is full the line is
+     * dropped and counted. Use the MT_LOG macros, they skip the formatting
+     * when the level is off.
+     */
+    void LogWrite(LogCategory& category, LogLevel level, const char* format, ...)
+        __attribute__((format(printf, 3, 4)));
+
+    // replaces the stderr sink, null restores it
+    void SetLogSink(LogSink sink, void* user);
+
+    // waits until everything logged so far reached the sink
+    void LogFlush();
+
+    LogStats GetLogStats();
+
+} // utils
+} // mtsai
+
+// levels above this are compiled out
+#ifndef MT_LOG_COMPILE_LEVEL
+#define MT_LOG_COMPILE_LEVEL 4
+#endif
+
+#define MT_LOG(category, level, ...)                                                        \
+    do {                                                                                    \
+        if((int)(level) <= MT_LOG_COMPILE_LEVEL && (category).Enabled(level))               \
+            mtsai::utils::LogWrite((category), (level), __VA_ARGS__);                       \
+    } while(0)
+
+#define MT_LOG_ERROR(category, ...)   MT_LOG(category, mtsai::utils::LOG_LEVEL_ERROR, __VA_ARGS__)
+#define MT_LOG_WARNING(category, ...) MT_LOG(category, mtsai::utils::LOG_LEVEL_WARNING, __VA_ARGS__)
+#define MT_LOG_INFO(category, ...)    MT_LOG(category, mtsai::utils::LOG_LEVEL_INFO, __VA_ARGS__)
+#define MT_LOG_DEBUG(category, ...)   MT_LOG(category, mtsai::utils::LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define MT_LOG_TRACE(category, ...)   MT_LOG(category, mtsai::utils::LOG_LEVEL_TRACE, __VA_ARGS__)
+
+#endif
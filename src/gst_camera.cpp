@@ -3,63 +3,78 @@
 
 #include <cstring> // memset
 #include <algorithm>
+#include <chrono>
+#include <thread>
 
+#include <gst/video/video.h>
+
+#include "gst_runtime.h"
 #include "cudaMappedMemory.h"
+#include "utils/mt_log.h"
 
-GstCamera::GstCamera(): width_{0}, height_{0}, depth_{0}
-{
+// per frame lines are TRACE, the rate limit keeps a stuck stream from flooding
+static mtsai::utils::LogCategory logCamera("gstcamera", 50);
 
-}
-GstCamera::GstCamera(GstCameraParam params): width_{0}, height_{0}, depth_{0}
+namespace
 {
-    Init(params);
+    // a sample kept mapped while a ring slot points into it
+    struct HeldSample
+    {
+        GstSample* sample;
+        GstBuffer* buffer;
+        GstMapInfo map;
+    };
+
+    void releaseSample(void* handle)
+    {
+        HeldSample* held = (HeldSample*)handle;
+        gst_buffer_unmap(held->buffer, &held->map);
+        gst_sample_unref(held->sample);
+        delete held;
+    }
 }
 
-GstCamera::~GstCamera()
+GstCamera::GstCamera(): bus_{nullptr}, appsink_{nullptr}, pipeline_{nullptr}, width_{0}, height_{0}, depth_{0}, upstreamPool_{nullptr}, sourceId_{mtsai::image::NewFrameSourceId()}, sequence_{0}, handedOut_{-1}, handedStale_{false}, stateWait_{false}
 {
 
 }
-
-inline bool launchGstreamer(GstElement** pipeline, std::string launchStr)
+GstCamera::GstCamera(GstCameraParam params): bus_{nullptr}, appsink_{nullptr}, pipeline_{nullptr}, width_{0}, height_{0}, depth_{0}, upstreamPool_{nullptr}, sourceId_{mtsai::image::NewFrameSourceId()}, sequence_{0}, handedOut_{-1}, handedStale_{false}, stateWait_{false}
 {
+    Init(params);
+}
 
-    GError* err = NULL;
-    *pipeline = gst_parse_launch(launchStr.c_str(), &err);
-    if( !(*pipeline) ) {
-
-		g_print ("Error for launch: %s\n", err->message);
-		g_error_free (err);
-        
-		gst_object_unref (*pipeline);
-        return false;
+GstCamera::~GstCamera()
+{
+    // the streaming thread must be gone before the ring and this are
+    if(pipeline_) {
+        Close();
+        {
+            std::lock_guard<std::mutex> lock(ringMutex_);
+            releaseHeld();
+        }
+        if(appsink_) {
+            gst_object_unref(appsink_);
+        }
+        if(bus_) {
+            gst_object_unref(bus_);
+        }
+        gst_object_unref(pipeline_);
+    }
+    if(upstreamPool_) {
+        gst_object_unref(upstreamPool_);
     }
-    return true;
-}
 
+    std::lock_guard<std::mutex> lock(ringMutex_);
+    ringPool_.reset();
+    heldPool_.reset();
+}
 
 bool GstCamera::initGstCheck()
 {
     frame_count = 0; // For test
 
-    GError* err;
-    if( !gst_init_check(0, NULL, &err) ) {
-        g_print ("failed to initialize gstreamer library with gst_init(): %s\n", err->message);
-		g_error_free (err);
-        return false;
-    }
-    uint32_t ver[] = {0, 0, 0, 0};
-    gst_version(&ver[0], &ver[1], &ver[2], &ver[3]);
-    printf("Initialized gstreamer, Ver %u.%u.%u.%u\n", ver[0], ver[1], ver[2], ver[3]);
-
-    gst_debug_remove_log_function(gst_debug_log_default);
-	
-	if( true )
-	{
-		// gst_debug_add_log_function(rilog_debug_function, NULL, NULL);
-		gst_debug_set_active(true);
-		gst_debug_set_colored(false);
-	}
-    return true;
+    // once per process, every camera after the first gets the cached result
+    return mtsai::gst::Init();
 }
 
 std::string GstCamera::searchAppsinkName(std::string launchStr)
@@ -88,25 +103,34 @@ bool GstCamera::Init(GstCameraParam params)
         return false;
     }
 
-    for(uint32_t i=0; i<GST_CAMERA_RING_BUFFER_SIZE; ++i) {
-        ringBufferCPU_[i] = nullptr;
-        ringBufferGPU_[i] = nullptr;
-
+    // slots are sized when the first caps arrive
+    if(params.memory_ != mtsai::image::FRAME_MEMORY_EXTERNAL) {
+        ringPool_.reset(new mtsai::image::FramePool(params.memory_, GST_CAMERA_RING_BUFFER_SIZE));
     }
-
-    launchStr_ = params.launchStr_;
-    printf("launch string: %s\n", launchStr_.c_str());
+    heldPool_.reset(new mtsai::image::FramePool(mtsai::image::FRAME_MEMORY_EXTERNAL, GST_CAMERA_RING_BUFFER_SIZE));
+    latestRingBuffer_ = 0;
+    latestRetrived_ = true;
+    handedOut_ = -1;
+    handedStale_ = false;
+
+    std::string error;
+    if(!mtsai::gst::LaunchTemplateCache::Instance().Expand(params.launchStr_, params.values_, &launchStr_, &error)) {
+        MT_LOG_ERROR(logCamera, "failed to expand launch string: %s", error.c_str());
+        return false;
+    }
+    MT_LOG_INFO(logCamera, "launch string: %s", launchStr_.c_str());
 
     // Search appsink name and must be "mysink"
     std::string appsink_name= searchAppsinkName(launchStr_);
-    printf("appsink_name: %s\n", appsink_name.c_str());
     if(appsink_name != "mysink") {
-        printf("app sink name is not mysink\n");
+        MT_LOG_ERROR(logCamera, "app sink name is %s, not mysink", appsink_name.c_str());
         return false;
     }
     
-    // Launch Gstreamer with command string
-    if( !launchGstreamer(&pipeline_, launchStr_) ) {
+    // Build from the cached template, the factories are already loaded
+    pipeline_ = mtsai::gst::LaunchTemplateCache::Instance().Instantiate(params.launchStr_, params.values_, &error);
+    if(!pipeline_) {
+        MT_LOG_ERROR(logCamera, "Error for launch: %s", error.c_str());
         return false;
     }
 
@@ -122,43 +146,212 @@ bool GstCamera::Init(GstCameraParam params)
 	cb.new_preroll = onPreroll;
 	cb.new_sample  = onBuffer;
     gst_app_sink_set_callbacks(appsink_, &cb, (void*)this, NULL);
+
+    // tee the parsed stream into the recorder before anything is negotiated
+    if(!params.record_.location_.empty()) {
+        recorder_.reset(new mtsai::gst::Recorder());
+        if(!recorder_->Attach(pipeline_, params.record_, params.values_)) {
+            return false;
+        }
+        recorder_->SetDecoding(params.decode_);
+
+        // the appsink gets nothing while decoding is off, it must not hold up PLAYING
+        g_object_set(appsinkElement, "async", FALSE, NULL);
+    }
+
+    if(params.clip_.preSeconds_ > 0) {
+        clipRing_.reset(new mtsai::gst::ClipRing());
+        if(!clipRing_->Attach(pipeline_, params.clip_)) {
+            return false;
+        }
+    }
+
+    // the ring may hold all its slots, upstream gets the extra buffers
+    if(params.proposePool_ && ringPool_) {
+        upstreamPool_ = mtsai::gst::NewFrameBufferPool(params.memory_, GST_CAMERA_RING_BUFFER_SIZE + GST_CAMERA_POOL_EXTRA,
+                                                       GST_CAMERA_RING_BUFFER_SIZE);
+        mtsai::gst::ProposeAllocation(appsinkElement, upstreamPool_, returnHeldSamples, this);
+    }
+
+    return true;
+}
+
+mtsai::gst::StateChange GstCamera::Open(unsigned long timeout)
+{
+    return Open(mtsai::gst::DeadlineIn(timeout));
 }
 
-bool GstCamera::Open()
+mtsai::gst::StateChange GstCamera::Open(mtsai::gst::Deadline deadline)
 {
-    const GstStateChangeReturn result = gst_element_set_state(pipeline_, GST_STATE_PLAYING);
+    stateWait_ = true;
+    mtsai::gst::StateChange change = mtsai::gst::SetState(pipeline_, GST_STATE_PLAYING, deadline, printBusMsg, this);
+    stateWait_ = false;
+
+    if(!change) {
+        MT_LOG_ERROR(logCamera, "failed to set pipeline state to PLAYING (%s after %.1f ms) %s",
+                     mtsai::gst::StateResultName(change.result), change.elapsedMs, change.error.c_str());
 
-    if(result == GST_STATE_CHANGE_ASYNC) {
-        // no idea how to handle
+        // do not leave a half started pipeline holding the source
+        gst_element_set_state(pipeline_, GST_STATE_NULL);
+        return change;
     }
-    else if(result != GST_STATE_CHANGE_SUCCESS) {
-        printf("gstreamer failed to set pipeline state to PLAYING (error %u)\n", result);
-		return false;
+
+    MT_LOG_INFO(logCamera, "pipeline PLAYING in %.1f ms", change.elapsedMs);
+    return change;
+}
+
+mtsai::gst::StateChange GstCamera::Close(unsigned long timeout)
+{
+    // the open segment is finished first, an mp4 without its index is lost
+    const mtsai::gst::Deadline deadline = mtsai::gst::DeadlineIn(timeout);
+    if(recorder_) {
+        recorder_->Finish(deadline);
+    }
+    // open clips are ended here, their files finish on their own threads
+    if(clipRing_) {
+        clipRing_->Finish();
     }
 
-    return true;
+    stateWait_ = true;
+    mtsai::gst::StateChange change = mtsai::gst::SetState(pipeline_, GST_STATE_NULL, deadline, printBusMsg, this);
+    stateWait_ = false;
+
+    if(!change) {
+        MT_LOG_ERROR(logCamera, "failed to set pipeline state to NULL (%s) %s",
+                     mtsai::gst::StateResultName(change.result), change.error.c_str());
+        return change;
+    }
+
+    // samples held by the ring belong to the stopped pipeline
+    std::lock_guard<std::mutex> lock(ringMutex_);
+    releaseHeld();
+    return change;
+}
+
+mtsai::gst::StateChange GstCamera::Prepare(mtsai::gst::Deadline deadline)
+{
+    stateWait_ = true;
+    mtsai::gst::StateChange change = mtsai::gst::SetState(pipeline_, GST_STATE_READY, deadline, printBusMsg, this);
+    stateWait_ = false;
+
+    if(!change) {
+        MT_LOG_ERROR(logCamera, "failed to set pipeline state to READY (%s after %.1f ms) %s",
+                     mtsai::gst::StateResultName(change.result), change.elapsedMs, change.error.c_str());
+        gst_element_set_state(pipeline_, GST_STATE_NULL);
+    }
+    return change;
+}
+
+std::vector<mtsai::gst::StateChange> GstCamera::OpenAll(const std::vector<GstCamera*>& cameras, unsigned long timeout)
+{
+    const mtsai::gst::Deadline deadline = mtsai::gst::DeadlineIn(timeout);
+    std::vector<mtsai::gst::StateChange> changes(cameras.size());
+
+    // READY first, devices and sockets of the whole rack open side by side,
+    // then PLAYING for the cameras that made it
+    for(int phase = 0; phase < 2; phase++) {
+        std::vector<std::thread> threads;
+
+        for(size_t i = 0; i < cameras.size(); i++) {
+            if(phase == 1 && !changes[i]) {
+                continue;
+            }
+            threads.emplace_back([&, i, phase]() {
+                changes[i] = (phase == 0) ? cameras[i]->Prepare(deadline) : cameras[i]->Open(deadline);
+            });
+        }
+        for(std::thread& t : threads) {
+            t.join();
+        }
+    }
+    return changes;
+}
+
+void GstCamera::SetDecoding(bool decoding)
+{
+    if(recorder_) {
+        recorder_->SetDecoding(decoding);
+    }
+}
 
+std::vector<mtsai::gst::RecordSegment> GstCamera::Segments()
+{
+    return recorder_ ? recorder_->Segments() : std::vector<mtsai::gst::RecordSegment>();
+}
+
+bool GstCamera::TriggerClip(const std::string& location)
+{
+    return clipRing_ ? clipRing_->Trigger(location) : false;
+}
+
+std::vector<mtsai::gst::ClipInfo> GstCamera::Clips()
+{
+    return clipRing_ ? clipRing_->Clips() : std::vector<mtsai::gst::ClipInfo>();
 }
-void GstCamera::Capture()
+
+bool GstCamera::Capture(void** cpu, void** cuda, unsigned long timeout)
 {
+    mtsai::image::FrameDescriptor frame;
+    if(!Capture(&frame, timeout)) {
+        return false;
+    }
 
+    if(cpu != NULL) {
+        *cpu = frame.cpu;
+    }
+    if(cuda != NULL) {
+        *cuda = frame.cuda;
+    }
+    return true;
+}
+
+bool GstCamera::Capture(mtsai::image::FrameDescriptor* frame, unsigned long timeout)
+{
+    // Wait until checkFrameBuffer() publishes a frame which is not retrieved yet
+    std::unique_lock<std::mutex> lkRing(ringMutex_);
+    if(ringPool_) {
+        ringPool_->Recycle();   // the previous frame is released by this call
+    }
+    if(handedStale_) {
+        heldPool_->Attach(handedOut_, nullptr, nullptr, 0, nullptr, nullptr);
+        handedStale_ = false;
+    }
+
+    auto hasNewFrame = [this]() { return !latestRetrived_; };
+    if(timeout == ULONG_MAX) {
+        waitEvent_.wait(lkRing, hasNewFrame);
+    }
+    else if(!waitEvent_.wait_for(lkRing, std::chrono::milliseconds(timeout), hasNewFrame)) {
+        return false;
+    }
+
+    // copied under the lock, a resolution change swaps the slots
+    const uint32_t latest = latestRingBuffer_;
+    latestRetrived_ = true;
+    handedOut_ = (int32_t)latest;
+
+    if(frame != NULL) {
+        *frame = ringFrames_[latest];
+    }
+    return true;
 }
 
 void GstCamera::checkFrameBuffer()
 {
-    printf("\t%ld\n", frame_count );
+    MT_LOG_TRACE(logCamera, "frame %lu", frame_count);
     frame_count += 1;
 
     GstSample* gstSample = gst_app_sink_pull_sample(appsink_);
     if(!gstSample) {
-        printf("gstreamer camera -- gst_app_sink_pull_sample() returned NULL...\n");
+        MT_LOG_ERROR(logCamera, "gst_app_sink_pull_sample() returned NULL");
 		return;
     }
     GstBuffer* gstBuffer = gst_sample_get_buffer(gstSample);
 	
 	if( !gstBuffer )
 	{
-		printf("gstreamer camera -- gst_sample_get_buffer() returned NULL...\n");
+		MT_LOG_ERROR(logCamera, "gst_sample_get_buffer() returned NULL");
+        gst_sample_unref(gstSample);
 		return;
 	}
     // retrieve
@@ -166,7 +359,8 @@ void GstCamera::checkFrameBuffer()
 
 	if(	!gst_buffer_map(gstBuffer, &map, GST_MAP_READ) ) 
 	{
-		printf("gstreamer camera -- gst_buffer_map() failed...\n");
+		MT_LOG_ERROR(logCamera, "gst_buffer_map() failed");
+        gst_sample_unref(gstSample);
 		return;
 	}
 
@@ -174,79 +368,83 @@ void GstCamera::checkFrameBuffer()
 	const uint32_t gstSize = map.size; //GST_BUFFER_SIZE(gstBuffer);
 	if( !gstData )
 	{
-		printf("gstreamer camera -- gst_buffer had NULL data pointer...\n");
+		MT_LOG_ERROR(logCamera, "gst_buffer had NULL data pointer");
+        gst_buffer_unmap(gstBuffer, &map);
         gst_sample_unref(gstSample);
 		return;
 	}
-    // retrieve caps
-	GstCaps* gstCaps = gst_sample_get_caps(gstSample);
-	
-	if( !gstCaps )
-	{
-		printf("gstreamer camera -- gst_buffer had NULL caps...\n");
-		gst_sample_unref(gstSample);
-		return;
-	}
-    GstStructure* gstCapsStruct = gst_caps_get_structure(gstCaps, 0);
-	
-	if( !gstCapsStruct )
-	{
-		printf("gstreamer camera -- gst_caps had NULL structure...\n");
-		gst_sample_unref(gstSample);
-		return;
-	}
+    // parsed once per negotiation, every other frame only compares the caps pointer
+    const mtsai::gst::CapsUpdate update = capsLayout_.Update(gst_sample_get_caps(gstSample));
+    if(update == mtsai::gst::CAPS_INVALID) {
+        MT_LOG_ERROR(logCamera, "sample caps missing or without width/height");
+        gst_buffer_unmap(gstBuffer, &map);
+        gst_sample_unref(gstSample);
+        return;
+    }
 
-    // get width & height of the buffer
-	int width  = 0;
-	int height = 0;
-	
-	if( !gst_structure_get_int(gstCapsStruct, "width", &width) ||
-		!gst_structure_get_int(gstCapsStruct, "height", &height) )
-	{
-		printf("gstreamer camera -- gst_caps missing width/height...\n");
-		gst_sample_unref(gstSample);
-		return;
-	}
+    mtsai::image::FrameDescriptor frame = capsLayout_.Layout();
+    if(update == mtsai::gst::CAPS_CHANGED) {
+        width_ = frame.width;
+        height_ = frame.height;
+        depth_ = (gstSize * 8) / (width_ * height_);
+        MT_LOG_INFO(logCamera, "caps %dx%d, %d bpp, %u bytes", width_, height_, depth_, gstSize);
+    }
+    frameSize_ = gstSize;
+
+    // padded rows of this buffer override the caps layout
+    mtsai::gst::ApplyVideoMeta(gstBuffer, &frame);
+
+    frame.size = gstSize;
+    frame.pts = GST_BUFFER_PTS_IS_VALID(gstBuffer) ? GST_BUFFER_PTS(gstBuffer) : 0;
+    frame.captureTime = mtsai::image::FrameClockNow();
+    frame.sequence = sequence_++;
+    frame.sourceId = sourceId_;
+
+    // decoded straight into the proposed pool (or nothing to copy into): the
+    // ring keeps the sample itself
+    void* slotCPU = gstData;
+    void* slotCUDA = nullptr;
+    const bool hold = !ringPool_ || mtsai::gst::FrameBufferSlot(gstBuffer, upstreamPool_, &slotCPU, &slotCUDA);
+
+    // sized when the caps change (or a buffer outgrows the slots), a new
+    // resolution never writes past slots sized for the old frame
+    if(!hold && (update == mtsai::gst::CAPS_CHANGED || gstSize > ringPool_->Capacity())) {
+        if(!reserveRing(std::max<size_t>(gstSize, capsLayout_.Layout().size))) {
+            gst_buffer_unmap(gstBuffer, &map);
+            gst_sample_unref(gstSample);
+            return;
+        }
+    }
+
+	// copy to next ringbuffer, or keep the sample itself in it
+	const uint32_t nextRingbuffer = (latestRingBuffer_ + 1) % GST_CAMERA_RING_BUFFER_SIZE;		
 
-    if( width < 1 || height < 1 ) {
-        printf("gstreamer camera -- width < 1  or height < 1...\n");
+    if(hold) {
+        frame.cpu = slotCPU;
+        frame.cuda = slotCUDA;
+    }
+    else {
+        memcpy(ringPool_->CPU(nextRingbuffer), gstData, gstSize);
+        frame.cpu = ringPool_->CPU(nextRingbuffer);
+        frame.cuda = ringPool_->CUDA(nextRingbuffer);
+        gst_buffer_unmap(gstBuffer, &map);
         gst_sample_unref(gstSample);
-		return;
     }
-	width_  = width;
-	height_ = height;
-	depth_  = (gstSize * 8) / (width_ * height_);
-	frameSize_   = gstSize;
-    printf("width : %d\n", width_);
-    printf("height: %d\n", height_);
-    printf("depth : %d\n", depth_);
-    printf("size  : %d\n", frameSize_);
-    
-    // make sure ringbuffer is allocated
-	if( !ringBufferCPU_[0] )
-	{
-		for( uint32_t n=0; n < GST_CAMERA_RING_BUFFER_SIZE; n++ )
-		{
-			if( !cudaAllocMapped(&ringBufferCPU_[n], &ringBufferGPU_[n], gstSize) ) {
-                printf(LOG_CUDA "gstreamer camera -- failed to allocate ringbuffer %u  (size=%u)\n", n, gstSize);
-            }
-		}
-		
-		printf(LOG_CUDA "gstreamer camera -- allocated %u ringbuffers, %u bytes each\n", GST_CAMERA_RING_BUFFER_SIZE, gstSize);
-	}
-	
-	// copy to next ringbuffer
-	const uint32_t nextRingbuffer = (latestRingBuffer_ + 1) % GST_CAMERA_RING_BUFFER_SIZE;		
-	//printf(LOG_GSTREAMER "gstreamer camera -- using ringbuffer #%u for next frame\n", nextRingbuffer);
-	memcpy(ringBufferCPU_[nextRingbuffer], gstData, frameSize_);
-    gst_buffer_unmap(gstBuffer, &map); 
-	//gst_buffer_unref(gstBuffer);
-    gst_sample_unref(gstSample);
-	
 	
 	// update and signal sleeping threads
 	// Step1. Lock for update the latest index of RingBuffer and Retrived flag
     std::unique_lock<std::mutex> lkRing(ringMutex_);
+    // a copied frame still gives back the sample held in the slot before
+    if((int32_t)nextRingbuffer == handedOut_) {
+        handedStale_ = false;
+    }
+    if(hold) {
+        heldPool_->Attach(nextRingbuffer, gstData, slotCUDA, gstSize, new HeldSample{gstSample, gstBuffer, map}, releaseSample);
+    }
+    else {
+        heldPool_->Attach(nextRingbuffer, nullptr, nullptr, 0, nullptr, nullptr);
+    }
+    ringFrames_[nextRingbuffer] = frame;
 	latestRingBuffer_ = nextRingbuffer;
 	latestRetrived_  = false;
 
@@ -256,20 +454,74 @@ void GstCamera::checkFrameBuffer()
 }
 
 
+bool GstCamera::reserveRing(size_t size)
+{
+    // the consumer may still read the last frame, replaced slots are retired
+    // and freed on its next Capture()
+    std::unique_lock<std::mutex> lkRing(ringMutex_);
+    const size_t capacity = ringPool_->Capacity();
+    const bool reserved = ringPool_->Reserve(size);
+
+    // frames in moved slots are not handed out anymore
+    if(ringPool_->Capacity() != capacity) {
+        latestRetrived_ = true;
+    }
+    lkRing.unlock();
+
+    if(!reserved) {
+        MT_LOG_ERROR(logCamera, "failed to allocate %u %s ringbuffers  (size=%zu)", GST_CAMERA_RING_BUFFER_SIZE,
+                     mtsai::image::FrameMemoryName(ringPool_->Memory()), size);
+        return false;
+    }
+    if(ringPool_->Capacity() != capacity) {
+        MT_LOG_INFO(logCamera, "allocated %u %s ringbuffers, %zu bytes each", GST_CAMERA_RING_BUFFER_SIZE,
+                    mtsai::image::FrameMemoryName(ringPool_->Memory()), ringPool_->Capacity());
+    }
+    return true;
+}
+
+void GstCamera::returnHeldSamples(void* user_data)
+{
+    GstCamera* camera = (GstCamera*)user_data;
+
+    std::lock_guard<std::mutex> lock(camera->ringMutex_);
+    if(!camera->heldPool_) {
+        return;
+    }
+
+    // the consumer may still read the frame it got last, it is released on
+    // its next Capture()
+    for(uint32_t n = 0; n < camera->heldPool_->Count(); n++) {
+        if((int32_t)n != camera->handedOut_) {
+            camera->heldPool_->Attach(n, nullptr, nullptr, 0, nullptr, nullptr);
+        }
+    }
+    camera->handedStale_ = camera->handedOut_ >= 0;
+    camera->latestRetrived_ = true;
+}
+
+void GstCamera::releaseHeld()
+{
+    if(heldPool_) {
+        heldPool_->Release();
+        latestRetrived_ = true;
+    }
+    handedStale_ = false;
+}
+
 void GstCamera::onEOS(GstAppSink* sink, void* user_data)
 {
-    printf("gst rtsp onEOS\n");
+    MT_LOG_INFO(logCamera, "onEOS");
 }
 
 GstFlowReturn GstCamera::onPreroll(GstAppSink* sink, void* user_data)
 {
-    printf("gst rtsp onPreroll\n");
+    MT_LOG_DEBUG(logCamera, "onPreroll");
     return GST_FLOW_OK;
 }
 
 GstFlowReturn GstCamera::onBuffer(GstAppSink* sink, void* user_data)
 {
-    printf("%s\n", __func__);
     if(!user_data) {
         return GST_FLOW_ERROR;
     }
@@ -285,86 +537,94 @@ GstFlowReturn GstCamera::onBuffer(GstAppSink* sink, void* user_data)
 // checkMsgBus
 void GstCamera::checkBusMsg()
 {
+    if(stateWait_) {
+        return;
+    }
+
 	while(true)
 	{
 		GstMessage* msg = gst_bus_pop(bus_);
         if( !msg ) {
 			break;
 		}
-        
-        switch (GST_MESSAGE_TYPE (msg)) {
-            case GST_MESSAGE_ERROR:
-            {
-                GError *err = NULL;
-                gchar *debug_info = NULL;
-                gst_message_parse_error (msg, &err, &debug_info);
-                
-                g_printerr ("BUS Error received from element %s: %s\n", GST_OBJECT_NAME (msg->src), err->message);
-                g_printerr ("gstreamer Debugging information: %s\n", debug_info ? debug_info : "none");
-                g_clear_error (&err);
-                g_free (debug_info);
-                break;
-            }
-            case GST_MESSAGE_EOS:
+
+        printBusMsg(msg, this);
+		gst_message_unref (msg);
+	}
+}
+
+void GstCamera::printBusMsg(GstMessage* msg, void* user_data)
+{
+    switch (GST_MESSAGE_TYPE (msg)) {
+        case GST_MESSAGE_ERROR:
+        {
+            GError *err = NULL;
+            gchar *debug_info = NULL;
+            gst_message_parse_error (msg, &err, &debug_info);
+            
+            MT_LOG_ERROR(logCamera, "bus error from element %s: %s (%s)", GST_OBJECT_NAME (msg->src), err->message,
+                         debug_info ? debug_info : "no debug information");
+            g_clear_error (&err);
+            g_free (debug_info);
+            break;
+        }
+        case GST_MESSAGE_EOS:
+        {
+            MT_LOG_INFO(logCamera, "%s recieved EOS signal", GST_OBJECT_NAME(msg->src));
+            //g_main_loop_quit (app->loop);		// TODO trigger plugin Close() upon error
+            break;
+        }
+        case GST_MESSAGE_STATE_CHANGED:
+        {
+            GstState old_state, new_state;
+    
+            gst_message_parse_state_changed(msg, &old_state, &new_state, NULL);
+            
+            MT_LOG_DEBUG(logCamera, "changed state from %s to %s ==> %s",
+                            gst_element_state_get_name(old_state),
+                            gst_element_state_get_name(new_state),
+                            GST_OBJECT_NAME(msg->src));
+            break;
+        }
+        case GST_MESSAGE_STREAM_STATUS:
+        {
+            GstStreamStatusType streamStatus;
+            gst_message_parse_stream_status(msg, &streamStatus, NULL);
+            
+            std::string statusStr = "";
+            switch(streamStatus)
             {
-                printf("gstreamer %s recieved EOS signal...\n", GST_OBJECT_NAME(msg->src));
-                //g_main_loop_quit (app->loop);		// TODO trigger plugin Close() upon error
-                break;
+                case GST_STREAM_STATUS_TYPE_CREATE:	    statusStr = "CREATE";
+                case GST_STREAM_STATUS_TYPE_ENTER:		statusStr = "ENTER";
+                case GST_STREAM_STATUS_TYPE_LEAVE:		statusStr = "LEAVE";
+                case GST_STREAM_STATUS_TYPE_DESTROY:	statusStr = "DESTROY";
+                case GST_STREAM_STATUS_TYPE_START:		statusStr = "START";
+                case GST_STREAM_STATUS_TYPE_PAUSE:		statusStr = "PAUSE";
+                case GST_STREAM_STATUS_TYPE_STOP:		statusStr = "STOP";
+                default:						        statusStr = "UNKNOWN";
             }
-            case GST_MESSAGE_STATE_CHANGED:
-            {
-                GstState old_state, new_state;
-        
-                gst_message_parse_state_changed(msg, &old_state, &new_state, NULL);
-                
-                printf("gstreamer changed state from %s to %s ==> %s\n",
-                                gst_element_state_get_name(old_state),
-                                gst_element_state_get_name(new_state),
-                                GST_OBJECT_NAME(msg->src));
-                break;
+
+            MT_LOG_DEBUG(logCamera, "stream status %s ==> %s",
+                            statusStr.c_str(), 
+                            GST_OBJECT_NAME(msg->src));
+            break;
+        }
+        case GST_MESSAGE_TAG: 
+        {
+            GstTagList *tags = NULL;
+
+            gst_message_parse_tag(msg, &tags);
+            MT_LOG_DEBUG(logCamera, "%s missing gst_tag_list_to_string()", GST_OBJECT_NAME(msg->src));
+            if( tags != NULL ) {
+                gst_tag_list_free(tags);
             }
-            case GST_MESSAGE_STREAM_STATUS:
-            {
-                GstStreamStatusType streamStatus;
-                gst_message_parse_stream_status(msg, &streamStatus, NULL);
                 
-                std::string statusStr = "";
-                switch(streamStatus)
-                {
-                    case GST_STREAM_STATUS_TYPE_CREATE:	    statusStr = "CREATE";
-                    case GST_STREAM_STATUS_TYPE_ENTER:		statusStr = "ENTER";
-                    case GST_STREAM_STATUS_TYPE_LEAVE:		statusStr = "LEAVE";
-                    case GST_STREAM_STATUS_TYPE_DESTROY:	statusStr = "DESTROY";
-                    case GST_STREAM_STATUS_TYPE_START:		statusStr = "START";
-                    case GST_STREAM_STATUS_TYPE_PAUSE:		statusStr = "PAUSE";
-                    case GST_STREAM_STATUS_TYPE_STOP:		statusStr = "STOP";
-                    default:						        statusStr = "UNKNOWN";
-                }
-
-                printf("gstreamer stream status %s ==> %s\n",
-                                statusStr.c_str(), 
-                                GST_OBJECT_NAME(msg->src));
-                break;
-            }
-            case GST_MESSAGE_TAG: 
-            {
-                GstTagList *tags = NULL;
-
-                gst_message_parse_tag(msg, &tags);
-                printf("gstreamer %s missing gst_tag_list_to_string()\n", GST_OBJECT_NAME(msg->src));
-                if( tags != NULL ) {
-                    gst_tag_list_free(tags);
-                }
-                    
-                break;
-            }
-            default:
-            {
-                printf("gstreamer msg %s ==> %s\n", gst_message_type_get_name(GST_MESSAGE_TYPE(msg)), GST_OBJECT_NAME(msg->src));
-                break;
-            }
+            break;
         }
-        
-		gst_message_unref (msg);
-	}
+        default:
+        {
+            MT_LOG_DEBUG(logCamera, "msg %s ==> %s", gst_message_type_get_name(GST_MESSAGE_TYPE(msg)), GST_OBJECT_NAME(msg->src));
+            break;
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "gst_caps.h"
+
+#include <gst/video/video.h>
+
+namespace mtsai
+{
+namespace gst
+{
+
+    CapsLayout::CapsLayout() : caps_(NULL), valid_(false), parses_(0)
+    {
+    }
+
+    CapsLayout::~CapsLayout()
+    {
+        Reset();
+    }
+
+    void CapsLayout::Reset()
+    {
+        if(caps_) {
+            gst_caps_unref(caps_);
+            caps_ = NULL;
+        }
+        valid_ = false;
+        layout_ = mtsai::image::FrameDescriptor();
+    }
+
+    CapsUpdate CapsLayout::Update(GstCaps* caps)
+    {
+        if(caps == caps_ && caps != NULL) {
+            return valid_ ? CAPS_SAME : CAPS_INVALID;
+        }
+
+        // renegotiated to the same caps: keep the layout, track the new object
+        if(caps != NULL && caps_ != NULL && valid_ && gst_caps_is_equal(caps, caps_)) {
+            gst_caps_replace(&caps_, caps);
+            return CAPS_SAME;
+        }
+
+        Reset();
+        if(caps == NULL) {
+            return CAPS_INVALID;
+        }
+
+        gst_caps_replace(&caps_, caps);
+        valid_ = parse(caps);
+        parses_++;
+        return valid_ ? CAPS_CHANGED : CAPS_INVALID;
+    }
+
+    bool CapsLayout::parse(GstCaps* caps)
+    {
+        const GstStructure* structure = gst_caps_get_size(caps) > 0 ? gst_caps_get_structure(caps, 0) : NULL;
+        int width = 0;
+        int height = 0;
+
+        if(!structure || !gst_structure_get_int(structure, "width", &width) ||
+           !gst_structure_get_int(structure, "height", &height) || width < 1 || height < 1) {
+            return false;
+        }
+
+        mtsai::image::FrameDescriptor layout;
+        const uint32_t fourcc = mtsai::image::FourccFromGstFormat(gst_structure_get_string(structure, "format"));
+
+        // raw video: GstVideoInfo has the strides and offsets upstream will use,
+        // bayer and anything else without video info falls back to packed rows
+        GstVideoInfo info;
+        if(gst_video_info_from_caps(&info, caps)) {
+            layout.fourcc = fourcc;
+            layout.size = GST_VIDEO_INFO_SIZE(&info);
+
+            if(fourcc != 0 && GST_VIDEO_INFO_N_PLANES(&info) <= mtsai::image::kMaxFramePlanes) {
+                layout.planeCount = GST_VIDEO_INFO_N_PLANES(&info);
+                for(uint32_t n = 0; n < layout.planeCount; n++) {
+                    layout.planes[n].offset = GST_VIDEO_INFO_PLANE_OFFSET(&info, n);
+                    layout.planes[n].stride = GST_VIDEO_INFO_PLANE_STRIDE(&info, n);
+                }
+            }
+        }
+        else if(fourcc != 0) {
+            mtsai::image::DescribeFrame(fourcc, width, height, 0, &layout);
+        }
+
+        const char* colorimetry = gst_structure_get_string(structure, "colorimetry");
+        if(colorimetry != NULL) {
+            mtsai::image::ParseColorimetry(colorimetry, &layout.colour);
+        }
+
+        layout.width = width;
+        layout.height = height;
+        layout_ = layout;
+        return true;
+    }
+
+    bool ApplyVideoMeta(GstBuffer* buffer, mtsai::image::FrameDescriptor* frame)
+    {
+        GstVideoMeta* meta = gst_buffer_get_video_meta(buffer);
+
+        if(!meta || frame->fourcc == 0 || meta->n_planes > (guint)mtsai::image::kMaxFramePlanes) {
+            return false;
+        }
+
+        frame->planeCount = meta->n_planes;
+        for(uint32_t n = 0; n < meta->n_planes; n++) {
+            frame->planes[n].offset = meta->offset[n];
+            frame->planes[n].stride = meta->stride[n];
+        }
+        return true;
+    }
+
+} // gst
+} // mtsai
@@ -0,0 +1,399 @@
+#include "gst_clip.h"
+
+#include <chrono>
+
+#include "gst_record.h"
+#include "utils/mt_log.h"
+
+static mtsai::utils::LogCategory logClip("gstclip", 20);
+
+namespace mtsai
+{
+namespace gst
+{
+    namespace
+    {
+        GstClockTime unitTime(GstBuffer* buffer)
+        {
+            return GST_BUFFER_DTS_IS_VALID(buffer) ? GST_BUFFER_DTS(buffer) : GST_BUFFER_PTS(buffer);
+        }
+
+        GstClockTime rebase(GstClockTime time, GstClockTime base)
+        {
+            if(!GST_CLOCK_TIME_IS_VALID(time)) {
+                return time;
+            }
+            return time > base ? time - base : 0;
+        }
+    }
+
+    ClipRing::ClipRing(): pad_{nullptr}, probe_{0}, caps_{nullptr}, pre_{0}, post_{0}, budget_{0}, history_{0}, keyframes_{0}, bytes_{0}, evicted_{0}
+    {
+
+    }
+
+    ClipRing::~ClipRing()
+    {
+        if(pad_) {
+            gst_pad_remove_probe(pad_, probe_);
+            gst_object_unref(pad_);
+        }
+
+        // the probe is gone, nothing appends or triggers anymore
+        Finish();
+        for(std::unique_ptr<Clip>& clip : clips_) {
+            if(clip->writer.joinable()) {
+                clip->writer.join();
+            }
+        }
+
+        clear();
+        if(caps_) {
+            gst_caps_unref(caps_);
+        }
+    }
+
+    bool ClipRing::Attach(GstElement* pipeline, const GstClipParam& params)
+    {
+        GstElement* parser = FindStreamParser(pipeline);
+        if(!parser || pad_) {
+            MT_LOG_ERROR(logClip, "no h264parse / h265parse to take the access units from");
+            if(parser) {
+                gst_object_unref(parser);
+            }
+            return false;
+        }
+
+        pre_ = (GstClockTime)params.preSeconds_ * GST_SECOND;
+        post_ = (GstClockTime)params.postSeconds_ * GST_SECOND;
+        budget_ = params.budgetBytes_;
+        muxer_ = params.muxer_;
+        history_ = params.history_;
+
+        // clips get a parser of their own, the muxer may want another stream format
+        parser_ = GST_OBJECT_NAME(gst_element_get_factory(parser));
+        pad_ = gst_element_get_static_pad(parser, "src");
+        probe_ = gst_pad_add_probe(pad_, (GstPadProbeType)(GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM),
+                                   onData, this, NULL);
+        gst_object_unref(parser);
+
+        MT_LOG_INFO(logClip, "pre-event ring of %u s / %zu bytes after %s", params.preSeconds_, budget_,
+                    parser_.c_str());
+        return true;
+    }
+
+    bool ClipRing::Trigger(const std::string& location)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        reap();
+
+        // an open clip runs on
+        for(std::unique_ptr<Clip>& clip : clips_) {
+            if(clip->live) {
+                clip->end = units_.empty() ? clip->end : units_.back().time + post_;
+                MT_LOG_DEBUG(logClip, "%s extended", clip->info.location.c_str());
+                return true;
+            }
+        }
+
+        if(!keyframes_ || !caps_) {
+            MT_LOG_WARNING(logClip, "no keyframe in the ring yet, %s not written", location.c_str());
+            return false;
+        }
+
+        // the newest keyframe that still gives the whole pre-roll, else the oldest
+        const GstClockTime newest = units_.back().time;
+        size_t start = 0;
+        for(size_t i = 0; i < units_.size(); i++) {
+            if(units_[i].keyframe && units_[i].time + pre_ <= newest) {
+                start = i;
+            }
+        }
+
+        std::unique_ptr<Clip> clip(new Clip());
+        clip->info.location = location;
+        clip->info.state = CLIP_FAILED;
+        clip->info.duration = 0;
+        clip->info.preroll = 0;
+        clip->info.units = 0;
+        clip->info.bytes = 0;
+
+        // appsrc ! parser ! muxer ! filesink
+        clip->pipeline = gst_pipeline_new(NULL);
+        GstElement* src = gst_element_factory_make("appsrc", NULL);
+        GstElement* parser = gst_element_factory_make(parser_.c_str(), NULL);
+        GstElement* muxer = gst_element_factory_make(muxer_.c_str(), NULL);
+        GstElement* sink = gst_element_factory_make("filesink", NULL);
+
+        if(!src || !parser || !muxer || !sink) {
+            for(GstElement* element : {src, parser, muxer, sink}) {
+                if(element) {
+                    gst_object_unref(gst_object_ref_sink(element));
+                }
+            }
+            gst_object_unref(clip->pipeline);
+            clip->pipeline = nullptr;
+            MT_LOG_ERROR(logClip, "can not build the writer for %s (%s)", location.c_str(), muxer_.c_str());
+            clips_.push_back(std::move(clip));
+            return false;
+        }
+
+        // the pre-roll goes in at once, the queue holds it until the muxer took it
+        g_object_set(src, "caps", caps_, "format", GST_FORMAT_TIME, "is-live", FALSE, "max-bytes", (guint64)0, NULL);
+        g_object_set(sink, "location", location.c_str(), NULL);
+        gst_bin_add_many(GST_BIN(clip->pipeline), src, parser, muxer, sink, NULL);
+        gst_element_link_many(src, parser, muxer, sink, NULL);
+        clip->src = GST_APP_SRC(gst_object_ref(src));
+
+        if(gst_element_set_state(clip->pipeline, GST_STATE_PLAYING) == GST_STATE_CHANGE_FAILURE) {
+            MT_LOG_ERROR(logClip, "writer for %s failed to start", location.c_str());
+            gst_element_set_state(clip->pipeline, GST_STATE_NULL);
+            gst_object_unref(clip->src);
+            gst_object_unref(clip->pipeline);
+            clip->src = nullptr;
+            clip->pipeline = nullptr;
+            clips_.push_back(std::move(clip));
+            return false;
+        }
+
+        clip->info.state = CLIP_WRITING;
+        clip->base = units_[start].time;
+        clip->trigger = newest;
+        clip->end = newest + post_;
+        clip->live = true;
+        for(size_t i = start; i < units_.size(); i++) {
+            write(clip.get(), units_[i]);
+        }
+        clip->info.preroll = newest - clip->base;
+
+        MT_LOG_INFO(logClip, "clip %s: %.1f s before the trigger, %u units", location.c_str(),
+                    clip->info.preroll / 1e9, clip->info.units);
+
+        clip->writer = std::thread(&ClipRing::writeFile, this, clip.get());
+        clips_.push_back(std::move(clip));
+        return true;
+    }
+
+    void ClipRing::Finish()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for(std::unique_ptr<Clip>& clip : clips_) {
+            if(clip->live) {
+                end(clip.get());
+            }
+        }
+    }
+
+    bool ClipRing::Wait(unsigned long timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return writtenEvent_.wait_for(lock, std::chrono::milliseconds(timeout), [this]() {
+            for(const std::unique_ptr<Clip>& clip : clips_) {
+                if(clip->info.state == CLIP_WRITING) {
+                    return false;
+                }
+            }
+            return true;
+        });
+    }
+
+    std::vector<ClipInfo> ClipRing::Clips()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        reap();
+        std::vector<ClipInfo> clips;
+        for(const std::unique_ptr<Clip>& clip : clips_) {
+            clips.push_back(clip->info);
+        }
+        return clips;
+    }
+
+    ClipRingStats ClipRing::Stats()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ClipRingStats stats;
+        stats.bytes = bytes_;
+        stats.units = units_.size();
+        stats.keyframes = keyframes_;
+        stats.span = units_.empty() ? 0 : units_.back().time - units_.front().time;
+        stats.evicted = evicted_;
+        return stats;
+    }
+
+    void ClipRing::add(GstBuffer* buffer)
+    {
+        const GstClockTime time = unitTime(buffer);
+        const bool keyframe = !GST_BUFFER_FLAG_IS_SET(buffer, GST_BUFFER_FLAG_DELTA_UNIT);
+
+        // the ring starts at a keyframe, units without a time can not be placed
+        if((units_.empty() && !keyframe) || !GST_CLOCK_TIME_IS_VALID(time)) {
+            return;
+        }
+
+        units_.push_back(Unit{gst_buffer_ref(buffer), time, keyframe});
+        bytes_ += gst_buffer_get_size(buffer);
+        keyframes_ += keyframe;
+
+        // whole GOPs off the front while the next one still covers the pre-roll,
+        // or the budget is exceeded
+        while(keyframes_ > 1) {
+            size_t next = 1;
+            while(!units_[next].keyframe) {
+                next++;
+            }
+            if(bytes_ <= budget_ && units_[next].time + pre_ > time) {
+                break;
+            }
+
+            for(size_t i = 0; i < next; i++) {
+                const Unit& unit = units_.front();
+                bytes_ -= gst_buffer_get_size(unit.buffer);
+                keyframes_ -= unit.keyframe;
+                gst_buffer_unref(unit.buffer);
+                units_.pop_front();
+                evicted_++;
+            }
+        }
+
+        // one GOP larger than the budget: start over at the next keyframe
+        if(bytes_ > budget_) {
+            evicted_ += units_.size();
+            clear();
+        }
+    }
+
+    void ClipRing::clear()
+    {
+        for(Unit& unit : units_) {
+            gst_buffer_unref(unit.buffer);
+        }
+        units_.clear();
+        keyframes_ = 0;
+        bytes_ = 0;
+    }
+
+    void ClipRing::write(Clip* clip, const Unit& unit)
+    {
+        // a new buffer header on the same memory, rebased so the clip starts at 0
+        GstBuffer* copy = gst_buffer_copy(unit.buffer);
+        GST_BUFFER_PTS(copy) = rebase(GST_BUFFER_PTS(copy), clip->base);
+        GST_BUFFER_DTS(copy) = rebase(GST_BUFFER_DTS(copy), clip->base);
+
+        clip->info.units++;
+        clip->info.bytes += gst_buffer_get_size(copy);
+        clip->info.duration = unit.time > clip->base ? unit.time - clip->base : 0;
+        gst_app_src_push_buffer(clip->src, copy);
+    }
+
+    void ClipRing::end(Clip* clip)
+    {
+        clip->live = false;
+        gst_app_src_end_of_stream(clip->src);
+    }
+
+    void ClipRing::reap()
+    {
+        // a writer that set its state is past its last use of the clip
+        size_t finished = 0;
+        for(std::unique_ptr<Clip>& clip : clips_) {
+            if(clip->info.state != CLIP_WRITING) {
+                if(clip->writer.joinable()) {
+                    clip->writer.join();
+                }
+                finished++;
+            }
+        }
+
+        for(auto it = clips_.begin(); it != clips_.end() && finished > history_;) {
+            if((*it)->info.state != CLIP_WRITING) {
+                it = clips_.erase(it);
+                finished--;
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    void ClipRing::writeFile(Clip* clip)
+    {
+        // the muxer finishes the file on EOS
+        GstBus* bus = gst_element_get_bus(clip->pipeline);
+        GstMessage* msg = gst_bus_timed_pop_filtered(bus, GST_CLOCK_TIME_NONE,
+                                                     (GstMessageType)(GST_MESSAGE_EOS | GST_MESSAGE_ERROR));
+        const bool failed = !msg || GST_MESSAGE_TYPE(msg) == GST_MESSAGE_ERROR;
+        if(msg && failed) {
+            GError* err = NULL;
+            gst_message_parse_error(msg, &err, NULL);
+            MT_LOG_ERROR(logClip, "clip %s: %s", clip->info.location.c_str(), err ? err->message : "error");
+            g_clear_error(&err);
+        }
+        if(msg) {
+            gst_message_unref(msg);
+        }
+        gst_object_unref(bus);
+
+        gst_element_set_state(clip->pipeline, GST_STATE_NULL);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if(clip->live) {
+            clip->live = false;     // failed while live units still went in
+        }
+        gst_object_unref(clip->src);
+        gst_object_unref(clip->pipeline);
+        clip->src = nullptr;
+        clip->pipeline = nullptr;
+        clip->info.state = failed ? CLIP_FAILED : CLIP_DONE;
+
+        MT_LOG_INFO(logClip, "clip %s %s: %.1f s, %u units, %llu bytes", clip->info.location.c_str(),
+                    failed ? "failed" : "written", clip->info.duration / 1e9, clip->info.units,
+                    (unsigned long long)clip->info.bytes);
+        writtenEvent_.notify_all();
+    }
+
+    GstPadProbeReturn ClipRing::onData(GstPad* pad, GstPadProbeInfo* info, gpointer user_data)
+    {
+        ClipRing* ring = (ClipRing*)user_data;
+
+        if(info->type & GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM) {
+            GstEvent* event = GST_PAD_PROBE_INFO_EVENT(info);
+            if(GST_EVENT_TYPE(event) != GST_EVENT_CAPS) {
+                return GST_PAD_PROBE_OK;
+            }
+
+            GstCaps* caps = NULL;
+            gst_event_parse_caps(event, &caps);
+
+            // new resolution / codec data: the ring and open clips are of the old stream
+            std::lock_guard<std::mutex> lock(ring->mutex_);
+            if(ring->caps_ && !gst_caps_is_equal(ring->caps_, caps)) {
+                for(std::unique_ptr<Clip>& clip : ring->clips_) {
+                    if(clip->live) {
+                        ring->end(clip.get());
+                    }
+                }
+                ring->clear();
+            }
+            gst_caps_replace(&ring->caps_, caps);
+            return GST_PAD_PROBE_OK;
+        }
+
+        GstBuffer* buffer = GST_PAD_PROBE_INFO_BUFFER(info);
+        const Unit unit{buffer, unitTime(buffer), !GST_BUFFER_FLAG_IS_SET(buffer, GST_BUFFER_FLAG_DELTA_UNIT)};
+
+        std::lock_guard<std::mutex> lock(ring->mutex_);
+        for(std::unique_ptr<Clip>& clip : ring->clips_) {
+            if(!clip->live || !GST_CLOCK_TIME_IS_VALID(unit.time)) {
+                continue;
+            }
+            ring->write(clip.get(), unit);
+            if(unit.time >= clip->end) {
+                ring->end(clip.get());
+            }
+        }
+        ring->add(buffer);
+        return GST_PAD_PROBE_OK;
+    }
+
+} // gst
+} // mtsai
@@ -0,0 +1,357 @@
+#include "gst_frame_pool.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <gst/video/video.h>
+#include <gst/video/gstvideopool.h>
+
+namespace mtsai
+{
+namespace gst
+{
+    namespace
+    {
+        struct PoolState
+        {
+            mtsai::image::FrameMemory memory;
+            uint32_t count;
+            uint32_t held;
+            std::unique_ptr<mtsai::image::FramePool> frames;
+            std::vector<uint32_t> freeSlots;
+            std::mutex mutex;
+
+            GstVideoInfo info;
+            bool videoMeta;
+            uint64_t allocations;
+            uint32_t outstanding;    // buffers acquired and not yet released
+
+            // shared by a pool and the pools renewed from it
+            uint64_t family;
+        };
+
+        struct MtFrameBufferPool
+        {
+            GstBufferPool parent;
+            PoolState* state;
+        };
+
+        struct MtFrameBufferPoolClass
+        {
+            GstBufferPoolClass parent_class;
+        };
+
+        GType mt_frame_buffer_pool_get_type();
+        G_DEFINE_TYPE(MtFrameBufferPool, mt_frame_buffer_pool, GST_TYPE_BUFFER_POOL)
+
+        GQuark slotQuark()
+        {
+            static GQuark quark = g_quark_from_static_string("mtsai-frame-slot");
+            return quark;
+        }
+
+        PoolState* poolState(GstBufferPool* pool)
+        {
+            return ((MtFrameBufferPool*)pool)->state;
+        }
+
+        const gchar** frameBufferPoolOptions(GstBufferPool* pool)
+        {
+            static const gchar* options[] = {GST_BUFFER_POOL_OPTION_VIDEO_META, NULL};
+            return options;
+        }
+
+        gboolean frameBufferPoolSetConfig(GstBufferPool* pool, GstStructure* config)
+        {
+            PoolState* state = poolState(pool);
+            GstCaps* caps = NULL;
+            guint size = 0, min = 0, max = 0;
+
+            if(!gst_buffer_pool_config_get_params(config, &caps, &size, &min, &max) || !caps ||
+               !gst_video_info_from_caps(&state->info, caps)) {
+                GST_WARNING_OBJECT(pool, "frame buffer pool needs raw video caps");
+                return FALSE;
+            }
+
+            // upstream waits on the pool once the consumer holds its share
+            if(min + state->held > state->count || (max != 0 && max < min)) {
+                GST_WARNING_OBJECT(pool, "%u buffers requested, the pool has %u (%u held downstream)", min,
+                                   state->count, state->held);
+                return FALSE;
+            }
+            if(size < GST_VIDEO_INFO_SIZE(&state->info)) {
+                size = GST_VIDEO_INFO_SIZE(&state->info);
+            }
+            gst_buffer_pool_config_set_params(config, caps, size, min, state->count);
+            state->videoMeta = gst_buffer_pool_config_has_option(config, GST_BUFFER_POOL_OPTION_VIDEO_META);
+
+            return GST_BUFFER_POOL_CLASS(mt_frame_buffer_pool_parent_class)->set_config(pool, config);
+        }
+
+        gboolean frameBufferPoolStart(GstBufferPool* pool)
+        {
+            PoolState* state = poolState(pool);
+            GstStructure* config = gst_buffer_pool_get_config(pool);
+            guint size = 0;
+            gst_buffer_pool_config_get_params(config, NULL, &size, NULL, NULL);
+            gst_structure_free(config);
+
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+
+                // same size as the last activation keeps the slots
+                if(!state->frames->Reserve(size)) {
+                    GST_ERROR_OBJECT(pool, "failed to allocate %u %s slots of %u bytes", state->count,
+                                     mtsai::image::FrameMemoryName(state->memory), size);
+                    return FALSE;
+                }
+                state->frames->Recycle();
+
+                state->freeSlots.clear();
+                for(uint32_t n = state->count; n > 0; n--) {
+                    state->freeSlots.push_back(n - 1);
+                }
+            }
+            return GST_BUFFER_POOL_CLASS(mt_frame_buffer_pool_parent_class)->start(pool);
+        }
+
+        GstFlowReturn frameBufferPoolAcquire(GstBufferPool* pool, GstBuffer** buffer, GstBufferPoolAcquireParams* params)
+        {
+            const GstFlowReturn ret =
+                GST_BUFFER_POOL_CLASS(mt_frame_buffer_pool_parent_class)->acquire_buffer(pool, buffer, params);
+            if(ret == GST_FLOW_OK) {
+                PoolState* state = poolState(pool);
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->outstanding++;
+            }
+            return ret;
+        }
+
+        void frameBufferPoolRelease(GstBufferPool* pool, GstBuffer* buffer)
+        {
+            {
+                PoolState* state = poolState(pool);
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->outstanding--;
+            }
+            GST_BUFFER_POOL_CLASS(mt_frame_buffer_pool_parent_class)->release_buffer(pool, buffer);
+        }
+
+        GstFlowReturn frameBufferPoolAlloc(GstBufferPool* pool, GstBuffer** buffer, GstBufferPoolAcquireParams* params)
+        {
+            PoolState* state = poolState(pool);
+            uint32_t slot = 0;
+
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if(state->freeSlots.empty()) {
+                    return GST_FLOW_EOS;
+                }
+                slot = state->freeSlots.back();
+                state->freeSlots.pop_back();
+                state->allocations++;
+            }
+
+            // the slot stays ours, the memory only borrows it
+            const gsize size = GST_VIDEO_INFO_SIZE(&state->info);
+            GstBuffer* out = gst_buffer_new();
+            gst_buffer_append_memory(out, gst_memory_new_wrapped((GstMemoryFlags)0, state->frames->CPU(slot),
+                                                                 state->frames->Capacity(), 0, size, NULL, NULL));
+            gst_mini_object_set_qdata(GST_MINI_OBJECT(out), slotQuark(), GUINT_TO_POINTER(slot + 1), NULL);
+
+            if(state->videoMeta) {
+                gst_buffer_add_video_meta_full(out, GST_VIDEO_FRAME_FLAG_NONE, GST_VIDEO_INFO_FORMAT(&state->info),
+                                               GST_VIDEO_INFO_WIDTH(&state->info), GST_VIDEO_INFO_HEIGHT(&state->info),
+                                               GST_VIDEO_INFO_N_PLANES(&state->info), state->info.offset,
+                                               state->info.stride);
+            }
+
+            *buffer = out;
+            return GST_FLOW_OK;
+        }
+
+        void frameBufferPoolFree(GstBufferPool* pool, GstBuffer* buffer)
+        {
+            PoolState* state = poolState(pool);
+            const guint slot = GPOINTER_TO_UINT(gst_mini_object_get_qdata(GST_MINI_OBJECT(buffer), slotQuark()));
+
+            if(slot > 0) {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->freeSlots.push_back(slot - 1);
+            }
+            GST_BUFFER_POOL_CLASS(mt_frame_buffer_pool_parent_class)->free_buffer(pool, buffer);
+        }
+
+        void frameBufferPoolFinalize(GObject* object)
+        {
+            delete ((MtFrameBufferPool*)object)->state;
+            G_OBJECT_CLASS(mt_frame_buffer_pool_parent_class)->finalize(object);
+        }
+
+        void mt_frame_buffer_pool_class_init(MtFrameBufferPoolClass* klass)
+        {
+            GObjectClass* objectClass = G_OBJECT_CLASS(klass);
+            GstBufferPoolClass* poolClass = GST_BUFFER_POOL_CLASS(klass);
+
+            objectClass->finalize = frameBufferPoolFinalize;
+            poolClass->get_options = frameBufferPoolOptions;
+            poolClass->set_config = frameBufferPoolSetConfig;
+            poolClass->start = frameBufferPoolStart;
+            poolClass->acquire_buffer = frameBufferPoolAcquire;
+            poolClass->release_buffer = frameBufferPoolRelease;
+            poolClass->alloc_buffer = frameBufferPoolAlloc;
+            poolClass->free_buffer = frameBufferPoolFree;
+        }
+
+        void mt_frame_buffer_pool_init(MtFrameBufferPool* pool)
+        {
+            pool->state = new PoolState();
+            pool->state->memory = mtsai::image::FRAME_MEMORY_MAPPED;
+            pool->state->count = 0;
+            pool->state->held = 0;
+            pool->state->videoMeta = false;
+            pool->state->allocations = 0;
+            pool->state->outstanding = 0;
+            pool->state->family = 0;
+            gst_video_info_init(&pool->state->info);
+        }
+
+        bool isFrameBufferPool(GstBufferPool* pool)
+        {
+            return G_TYPE_CHECK_INSTANCE_TYPE(pool, mt_frame_buffer_pool_get_type());
+        }
+
+        uint32_t outstandingBuffers(GstBufferPool* pool)
+        {
+            PoolState* state = poolState(pool);
+            std::lock_guard<std::mutex> lock(state->mutex);
+            return state->outstanding;
+        }
+
+        // same memory and counts as pool, in the same family, with slots of its own
+        GstBufferPool* renewPool(GstBufferPool* pool)
+        {
+            const PoolState* state = poolState(pool);
+            GstBufferPool* fresh = NewFrameBufferPool(state->memory, state->count, state->held);
+            poolState(fresh)->family = state->family;
+            return fresh;
+        }
+
+        struct Proposal
+        {
+            GstBufferPool* pool;
+            ReturnBuffersFn returnBuffers;
+            void* user;
+        };
+
+        void freeProposal(gpointer data)
+        {
+            Proposal* proposal = (Proposal*)data;
+            gst_object_unref(proposal->pool);
+            delete proposal;
+        }
+
+        GstPadProbeReturn allocationProbe(GstPad* pad, GstPadProbeInfo* info, gpointer user_data)
+        {
+            GstQuery* query = GST_PAD_PROBE_INFO_QUERY(info);
+            if(GST_QUERY_TYPE(query) != GST_QUERY_ALLOCATION) {
+                return GST_PAD_PROBE_OK;
+            }
+
+            GstCaps* caps = NULL;
+            gboolean needPool = FALSE;
+            GstVideoInfo video;
+            gst_query_parse_allocation(query, &caps, &needPool);
+
+            if(!caps || !gst_video_info_from_caps(&video, caps)) {
+                return GST_PAD_PROBE_OK;
+            }
+
+            Proposal* proposal = (Proposal*)user_data;
+            if(needPool) {
+                // upstream reconfigures the pool after this, nothing may be out
+                if(proposal->returnBuffers) {
+                    proposal->returnBuffers(proposal->user);
+                }
+
+                // a buffer still out (the consumer's last frame) makes the
+                // reconfigure fail and upstream fall back to its own buffers,
+                // offer a fresh pool instead; the old one goes with its buffers
+                const uint32_t outstanding = outstandingBuffers(proposal->pool);
+                if(outstanding > 0) {
+                    GST_INFO_OBJECT(proposal->pool, "%u buffers still out, proposing a fresh pool", outstanding);
+                    GstBufferPool* fresh = renewPool(proposal->pool);
+                    gst_object_unref(proposal->pool);
+                    proposal->pool = fresh;
+                }
+                gst_query_add_allocation_pool(query, proposal->pool, GST_VIDEO_INFO_SIZE(&video), 0,
+                                              poolState(proposal->pool)->count);
+            }
+            gst_query_add_allocation_meta(query, GST_VIDEO_META_API_TYPE, NULL);
+            return GST_PAD_PROBE_OK;
+        }
+    }
+
+    GstBufferPool* NewFrameBufferPool(mtsai::image::FrameMemory memory, uint32_t count, uint32_t held)
+    {
+        static std::atomic<uint64_t> families(0);
+
+        MtFrameBufferPool* pool = (MtFrameBufferPool*)g_object_new(mt_frame_buffer_pool_get_type(), NULL);
+        gst_object_ref_sink(pool);
+
+        pool->state->family = ++families;
+        pool->state->memory = memory;
+        pool->state->count = count;
+        pool->state->held = held;
+        pool->state->frames.reset(new mtsai::image::FramePool(memory, count));
+        return GST_BUFFER_POOL(pool);
+    }
+
+    bool FrameBufferSlot(GstBuffer* buffer, GstBufferPool* pool, void** cpu, void** cuda)
+    {
+        if(!buffer || !pool || !buffer->pool) {
+            return false;
+        }
+        if(buffer->pool != pool && (!isFrameBufferPool(buffer->pool) || !isFrameBufferPool(pool) ||
+                                    poolState(buffer->pool)->family != poolState(pool)->family)) {
+            return false;
+        }
+
+        const guint slot = GPOINTER_TO_UINT(gst_mini_object_get_qdata(GST_MINI_OBJECT(buffer), slotQuark()));
+        if(slot == 0) {
+            return false;
+        }
+
+        // the slot is not reserved again while one of its buffers is out
+        PoolState* state = poolState(buffer->pool);
+        *cpu = state->frames->CPU(slot - 1);
+        *cuda = state->frames->CUDA(slot - 1);
+        return true;
+    }
+
+    uint64_t FrameBufferAllocations(GstBufferPool* pool)
+    {
+        PoolState* state = poolState(pool);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        return state->allocations;
+    }
+
+    gulong ProposeAllocation(GstElement* sink, GstBufferPool* pool, ReturnBuffersFn returnBuffers, void* user)
+    {
+        GstPad* pad = gst_element_get_static_pad(sink, "sink");
+        if(!pad) {
+            return 0;
+        }
+
+        // the probe holds its own ref on the pool
+        Proposal* proposal = new Proposal{(GstBufferPool*)gst_object_ref(pool), returnBuffers, user};
+        const gulong id = gst_pad_add_probe(pad, GST_PAD_PROBE_TYPE_QUERY_DOWNSTREAM, allocationProbe,
+                                            proposal, freeProposal);
+        gst_object_unref(pad);
+        return id;
+    }
+
+} // gst
+} // mtsai
@@ -0,0 +1,464 @@
+#include "gst_output_param.h"
+#include "gst_output.h"
+
+#include <cstring> // memset
+#include <climits>
+#include <chrono>
+
+#include "gst_runtime.h"
+#include "utils/mt_log.h"
+
+static mtsai::utils::LogCategory logOutput("gstoutput", 50);
+
+namespace
+{
+    // travels with the wrapped memory until the pipeline lets go of it
+    struct PushedFrame
+    {
+        std::shared_ptr<std::atomic<uint64_t>> released;
+        GstOutputReleaseFn release;
+        void* user;
+    };
+}
+
+GstOutput::GstOutput(): bus_{nullptr}, appsrc_{nullptr}, pipeline_{nullptr}, fpsN_{30}, fpsD_{1}, maxQueued_{4}, hasCaps_{false}, started_{false}, firstCapture_{0}, firstRunning_{0}, lastPts_{GST_CLOCK_TIME_NONE}, full_{false}, open_{false}, stateWait_{false}, pushed_{0}, dropped_{0}, released_{std::make_shared<std::atomic<uint64_t>>(0)}
+{
+    gst_video_info_init(&info_);
+}
+
+GstOutput::GstOutput(GstOutputParam params): GstOutput()
+{
+    Init(params);
+}
+
+GstOutput::~GstOutput()
+{
+    // NULL releases whatever the pipeline still holds, before this goes
+    if(pipeline_) {
+        Close();
+        if(appsrc_) {
+            gst_object_unref(appsrc_);
+        }
+        if(bus_) {
+            gst_object_unref(bus_);
+        }
+        gst_object_unref(pipeline_);
+    }
+    else {
+        Detach();
+    }
+}
+
+bool GstOutput::Init(GstOutputParam params)
+{
+    if(!mtsai::gst::Init()) {
+        return false;
+    }
+
+    std::string error;
+    if(!mtsai::gst::LaunchTemplateCache::Instance().Expand(params.launchStr_, params.values_, &launchStr_, &error)) {
+        MT_LOG_ERROR(logOutput, "failed to expand launch string: %s", error.c_str());
+        return false;
+    }
+    MT_LOG_INFO(logOutput, "launch string: %s", launchStr_.c_str());
+
+    pipeline_ = mtsai::gst::LaunchTemplateCache::Instance().Instantiate(params.launchStr_, params.values_, &error);
+    if(!pipeline_) {
+        MT_LOG_ERROR(logOutput, "Error for launch: %s", error.c_str());
+        return false;
+    }
+    bus_ = gst_pipeline_get_bus(GST_PIPELINE(pipeline_));
+
+    // app source name must be "mysrc"
+    GstElement* appsrcElement = gst_bin_get_by_name(GST_BIN(pipeline_), "mysrc");
+    const bool configured = configureSource(appsrcElement, params);
+    if(appsrcElement) {
+        gst_object_unref(appsrcElement);
+    }
+    return configured;
+}
+
+bool GstOutput::Adopt(GstElement* appsrc, GstOutputParam params)
+{
+    if(pipeline_) {
+        MT_LOG_ERROR(logOutput, "output already runs its own pipeline");
+        return false;
+    }
+    Detach();
+
+    std::lock_guard<std::mutex> pushLock(pushMutex_);
+    if(!configureSource(appsrc, params)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    full_ = false;
+    open_ = true;
+    started_ = false;
+    return true;
+}
+
+void GstOutput::Detach()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        open_ = false;
+    }
+    queueEvent_.notify_all();
+
+    std::lock_guard<std::mutex> pushLock(pushMutex_);
+    if(pipeline_ || !appsrc_) {
+        return;
+    }
+
+    GstAppSrcCallbacks cb;
+    memset(&cb, 0, sizeof(GstAppSrcCallbacks));
+    gst_app_src_set_callbacks(appsrc_, &cb, NULL, NULL);
+    gst_object_unref(appsrc_);
+    appsrc_ = nullptr;
+    hasCaps_ = false;
+}
+
+bool GstOutput::configureSource(GstElement* appsrc, const GstOutputParam& params)
+{
+    if(!appsrc || !GST_IS_APP_SRC(appsrc)) {
+        MT_LOG_ERROR(logOutput, "no appsrc named mysrc in the launch string");
+        return false;
+    }
+    if(params.fpsN_ <= 0 || params.fpsD_ <= 0 || params.maxQueued_ == 0) {
+        MT_LOG_ERROR(logOutput, "bad rate %d/%d or queue of %u frames", params.fpsN_, params.fpsD_, params.maxQueued_);
+        return false;
+    }
+    fpsN_ = params.fpsN_;
+    fpsD_ = params.fpsD_;
+    maxQueued_ = params.maxQueued_;
+    appsrc_ = GST_APP_SRC(gst_object_ref(appsrc));
+
+    // timestamps are ours, queue bounded by max-bytes once the frame size is known
+    g_object_set(appsrc,
+                 "format", GST_FORMAT_TIME,
+                 "is-live", TRUE,
+                 "do-timestamp", FALSE,
+                 "block", FALSE,
+                 "min-latency", (gint64)params.latencyMs_ * GST_MSECOND,
+                 NULL);
+
+    GstAppSrcCallbacks cb;
+    memset(&cb, 0, sizeof(GstAppSrcCallbacks));
+    cb.need_data   = onNeedData;
+    cb.enough_data = onEnoughData;
+    gst_app_src_set_callbacks(appsrc_, &cb, (void*)this, NULL);
+    return true;
+}
+
+mtsai::gst::StateChange GstOutput::Open(unsigned long timeout)
+{
+    if(!pipeline_) {
+        mtsai::gst::StateChange change;
+        change.error = "no pipeline of its own";
+        return change;
+    }
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        full_ = false;
+        open_ = true;
+        started_ = false;
+    }
+
+    stateWait_ = true;
+    mtsai::gst::StateChange change = mtsai::gst::SetState(pipeline_, GST_STATE_PLAYING, mtsai::gst::DeadlineIn(timeout),
+                                                          printBusMsg, this);
+    stateWait_ = false;
+
+    if(!change) {
+        MT_LOG_ERROR(logOutput, "failed to set pipeline state to PLAYING (%s after %.1f ms) %s",
+                     mtsai::gst::StateResultName(change.result), change.elapsedMs, change.error.c_str());
+
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        open_ = false;
+        gst_element_set_state(pipeline_, GST_STATE_NULL);
+        return change;
+    }
+
+    MT_LOG_INFO(logOutput, "pipeline PLAYING in %.1f ms", change.elapsedMs);
+    return change;
+}
+
+mtsai::gst::StateChange GstOutput::Close(unsigned long timeout)
+{
+    if(!pipeline_) {
+        mtsai::gst::StateChange change;
+        change.error = "no pipeline of its own";
+        return change;
+    }
+    const mtsai::gst::Deadline deadline = mtsai::gst::DeadlineIn(timeout);
+    bool wasOpen = false;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        wasOpen = open_;
+        open_ = false;
+    }
+    queueEvent_.notify_all();
+
+    stateWait_ = true;
+
+    // muxers only finish the file on EOS, wait for it to come out of the sinks
+    if(wasOpen && gst_app_src_end_of_stream(appsrc_) == GST_FLOW_OK) {
+        bool done = false;
+        while(!done) {
+            const auto left = deadline - std::chrono::steady_clock::now();
+            if(left <= std::chrono::steady_clock::duration::zero()) {
+                MT_LOG_ERROR(logOutput, "no EOS from the pipeline before the timeout");
+                break;
+            }
+
+            GstMessage* msg = gst_bus_timed_pop_filtered(bus_,
+                                  std::chrono::duration_cast<std::chrono::nanoseconds>(left).count(),
+                                  (GstMessageType)(GST_MESSAGE_EOS | GST_MESSAGE_ERROR));
+            if(!msg) {
+                continue;
+            }
+            printBusMsg(msg, this);
+            done = true;
+            gst_message_unref(msg);
+        }
+    }
+
+    mtsai::gst::StateChange change = mtsai::gst::SetState(pipeline_, GST_STATE_NULL, deadline, printBusMsg, this);
+    stateWait_ = false;
+
+    if(!change) {
+        MT_LOG_ERROR(logOutput, "failed to set pipeline state to NULL (%s) %s",
+                     mtsai::gst::StateResultName(change.result), change.error.c_str());
+    }
+    return change;
+}
+
+bool GstOutput::Push(const mtsai::image::FrameDescriptor& frame, GstOutputReleaseFn release, void* user,
+                     unsigned long timeout)
+{
+    PushedFrame* pushed = new PushedFrame{released_, release, user};
+
+    // wait for the encoder to take some of the queue, then give up on the frame
+    bool room = false;
+    {
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        auto hasRoom = [this]() { return !full_ || !open_; };
+        if(timeout == ULONG_MAX) {
+            queueEvent_.wait(lock, hasRoom);
+        }
+        else {
+            queueEvent_.wait_for(lock, std::chrono::milliseconds(timeout), hasRoom);
+        }
+        room = open_ && !full_;
+    }
+
+    std::lock_guard<std::mutex> pushLock(pushMutex_);
+    if(!room || !appsrc_ || !frame.cpu || !setCaps(frame)) {
+        dropped_++;
+        MT_LOG_TRACE(logOutput, "frame %llu dropped (%s)", (unsigned long long)frame.sequence,
+                     !room ? "queue full" : "no usable layout");
+        releaseFrame(pushed);
+        checkBusMsg();
+        return false;
+    }
+
+    // the pipeline reads the caller's memory, releaseFrame() hands it back
+    GstBuffer* buffer = gst_buffer_new_wrapped_full(GST_MEMORY_FLAG_READONLY, frame.cpu, frame.size, 0, frame.size,
+                                                    pushed, releaseFrame);
+
+    // rows laid out other than GStreamer's default for the caps
+    bool meta = (uint32_t)GST_VIDEO_INFO_N_PLANES(&info_) != frame.planeCount;
+    for(uint32_t p = 0; !meta && p < frame.planeCount; p++) {
+        meta = frame.planes[p].offset != GST_VIDEO_INFO_PLANE_OFFSET(&info_, p) ||
+               frame.planes[p].stride != (size_t)GST_VIDEO_INFO_PLANE_STRIDE(&info_, p);
+    }
+    if(meta) {
+        gsize offset[GST_VIDEO_MAX_PLANES] = {0};
+        gint stride[GST_VIDEO_MAX_PLANES] = {0};
+        for(uint32_t p = 0; p < frame.planeCount; p++) {
+            offset[p] = frame.planes[p].offset;
+            stride[p] = (gint)frame.planes[p].stride;
+        }
+        gst_buffer_add_video_meta_full(buffer, GST_VIDEO_FRAME_FLAG_NONE, GST_VIDEO_INFO_FORMAT(&info_), frame.width,
+                                       frame.height, frame.planeCount, offset, stride);
+    }
+
+    GST_BUFFER_PTS(buffer) = timestamp(frame);
+    GST_BUFFER_DURATION(buffer) = gst_util_uint64_scale_int(GST_SECOND, fpsD_, fpsN_);
+    GST_BUFFER_OFFSET(buffer) = frame.sequence;
+
+    // takes the buffer, also when it fails (flushing / not negotiated)
+    const GstFlowReturn flow = gst_app_src_push_buffer(appsrc_, buffer);
+    if(flow != GST_FLOW_OK) {
+        dropped_++;
+        MT_LOG_ERROR(logOutput, "push-buffer returned %s", gst_flow_get_name(flow));
+        checkBusMsg();
+        return false;
+    }
+
+    pushed_++;
+    checkBusMsg();
+    return true;
+}
+
+GstOutputStats GstOutput::Stats() const
+{
+    GstOutputStats stats;
+    stats.pushed = pushed_;
+    stats.dropped = dropped_;
+    stats.released = *released_;
+    return stats;
+}
+
+bool GstOutput::setCaps(const mtsai::image::FrameDescriptor& frame)
+{
+    if(hasCaps_ && frame.fourcc == layout_.fourcc && frame.width == layout_.width && frame.height == layout_.height) {
+        return true;
+    }
+
+    // raw video only, bayer has no video/x-raw format
+    const char* name = mtsai::image::GstFormatFromFourcc(frame.fourcc);
+    const GstVideoFormat format = name ? gst_video_format_from_string(name) : GST_VIDEO_FORMAT_UNKNOWN;
+    if(format == GST_VIDEO_FORMAT_UNKNOWN || frame.width == 0 || frame.height == 0) {
+        char fourcc[5];
+        mtsai::image::FourccToString(frame.fourcc, fourcc);
+        MT_LOG_ERROR(logOutput, "can not output %s %ux%u frames", fourcc, frame.width, frame.height);
+        return false;
+    }
+
+    GstVideoInfo info;
+    gst_video_info_set_format(&info, format, frame.width, frame.height);
+    GST_VIDEO_INFO_FPS_N(&info) = fpsN_;
+    GST_VIDEO_INFO_FPS_D(&info) = fpsD_;
+
+    // new caps travel in stream order, frames already queued keep the old ones
+    GstCaps* caps = gst_video_info_to_caps(&info);
+    gst_app_src_set_caps(appsrc_, caps);
+    gst_caps_unref(caps);
+
+    // the padded size bounds the queue, whatever the strides of later frames
+    const guint64 frameBytes = frame.size > GST_VIDEO_INFO_SIZE(&info) ? frame.size : GST_VIDEO_INFO_SIZE(&info);
+    gst_app_src_set_max_bytes(appsrc_, frameBytes * maxQueued_);
+
+    info_ = info;
+    layout_ = frame;
+    hasCaps_ = true;
+    MT_LOG_INFO(logOutput, "caps %s %ux%u at %d/%d, queue of %u frames", name, frame.width, frame.height, fpsN_,
+                fpsD_, maxQueued_);
+    return true;
+}
+
+GstClockTime GstOutput::timestamp(const mtsai::image::FrameDescriptor& frame)
+{
+    const uint64_t now = mtsai::image::FrameClockNow();
+    const uint64_t captured = (frame.captureTime && frame.captureTime <= now) ? frame.captureTime : now;
+
+    // first frame of the run: its capture time on the running time, minus
+    // what the processing took since then
+    if(!started_) {
+        GstClockTime running = 0;
+        GstElement* element = GST_ELEMENT(appsrc_);
+        GstClock* clock = gst_element_get_clock(element);
+        if(clock) {
+            const GstClockTime clockTime = gst_clock_get_time(clock);
+            const GstClockTime baseTime = gst_element_get_base_time(element);
+            running = clockTime > baseTime ? clockTime - baseTime : 0;
+            gst_object_unref(clock);
+        }
+
+        firstCapture_ = captured;
+        firstRunning_ = running > now - captured ? running - (now - captured) : 0;
+        lastPts_ = GST_CLOCK_TIME_NONE;
+        started_ = true;
+    }
+
+    // frames captured before the first one of the run (reordered by the
+    // processing) still come out in order
+    GstClockTime pts = captured > firstCapture_ ? firstRunning_ + (captured - firstCapture_) : firstRunning_;
+    if(GST_CLOCK_TIME_IS_VALID(lastPts_) && pts <= lastPts_) {
+        pts = lastPts_ + 1;
+    }
+    lastPts_ = pts;
+    return pts;
+}
+
+void GstOutput::releaseFrame(gpointer data)
+{
+    PushedFrame* pushed = (PushedFrame*)data;
+    if(pushed->release) {
+        pushed->release(pushed->user);
+    }
+    (*pushed->released)++;
+    delete pushed;
+}
+
+void GstOutput::onNeedData(GstAppSrc* src, guint length, gpointer user_data)
+{
+    GstOutput* output = (GstOutput*)user_data;
+    {
+        std::lock_guard<std::mutex> lock(output->queueMutex_);
+        output->full_ = false;
+    }
+    output->queueEvent_.notify_all();
+}
+
+void GstOutput::onEnoughData(GstAppSrc* src, gpointer user_data)
+{
+    GstOutput* output = (GstOutput*)user_data;
+    std::lock_guard<std::mutex> lock(output->queueMutex_);
+    output->full_ = true;
+}
+
+void GstOutput::checkBusMsg()
+{
+    if(stateWait_ || !bus_) {
+        return;
+    }
+
+    while(true) {
+        GstMessage* msg = gst_bus_pop(bus_);
+        if(!msg) {
+            break;
+        }
+        printBusMsg(msg, this);
+        gst_message_unref(msg);
+    }
+}
+
+void GstOutput::printBusMsg(GstMessage* msg, void* user_data)
+{
+    switch(GST_MESSAGE_TYPE(msg)) {
+        case GST_MESSAGE_ERROR:
+        {
+            GError* err = NULL;
+            gchar* debug_info = NULL;
+            gst_message_parse_error(msg, &err, &debug_info);
+
+            MT_LOG_ERROR(logOutput, "bus error from element %s: %s (%s)", GST_OBJECT_NAME(msg->src), err->message,
+                         debug_info ? debug_info : "no debug information");
+            g_clear_error(&err);
+            g_free(debug_info);
+            break;
+        }
+        case GST_MESSAGE_WARNING:
+        {
+            GError* err = NULL;
+            gst_message_parse_warning(msg, &err, NULL);
+            MT_LOG_WARNING(logOutput, "bus warning from element %s: %s", GST_OBJECT_NAME(msg->src), err->message);
+            g_clear_error(&err);
+            break;
+        }
+        case GST_MESSAGE_EOS:
+        {
+            MT_LOG_INFO(logOutput, "%s recieved EOS signal", GST_OBJECT_NAME(msg->src));
+            break;
+        }
+        default:
+        {
+            MT_LOG_DEBUG(logOutput, "msg %s ==> %s", gst_message_type_get_name(GST_MESSAGE_TYPE(msg)),
+                         GST_OBJECT_NAME(msg->src));
+            break;
+        }
+    }
+}
@@ -0,0 +1,323 @@
+#include "gst_record.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+#include "utils/mt_log.h"
+
+static mtsai::utils::LogCategory logRecord("gstrecord", 20);
+
+namespace mtsai
+{
+namespace gst
+{
+    namespace
+    {
+        bool isStreamParser(GstElement* element)
+        {
+            GstElementFactory* factory = gst_element_get_factory(element);
+            if(!factory) {
+                return false;
+            }
+            const gchar* name = GST_OBJECT_NAME(factory);
+            return !strcmp(name, "h264parse") || !strcmp(name, "h265parse");
+        }
+
+        GstElement* makeElement(const char* factory)
+        {
+            GstElement* element = gst_element_factory_make(factory, NULL);
+            if(!element) {
+                MT_LOG_ERROR(logRecord, "registry has no element %s", factory);
+            }
+            return element;
+        }
+
+        // the location goes to printf with the segment number (a guint): one
+        // integer conversion without a length modifier, "%%" for a literal %
+        bool segmentPattern(const std::string& location)
+        {
+            int conversions = 0;
+            for(size_t i = 0; i < location.size(); i++) {
+                if(location[i] != '%') {
+                    continue;
+                }
+                if(++i < location.size() && location[i] == '%') {
+                    continue;
+                }
+                while(i < location.size() && location[i] && strchr("-+ #0", location[i])) {
+                    i++;
+                }
+                while(i < location.size() && (isdigit((unsigned char)location[i]) || location[i] == '.')) {
+                    i++;
+                }
+                if(i >= location.size() || !location[i] || !strchr("diuxXo", location[i])) {
+                    return false;
+                }
+                conversions++;
+            }
+            return conversions == 1;
+        }
+    }
+
+    GstElement* FindStreamParser(GstElement* pipeline)
+    {
+        GstElement* parser = NULL;
+        GstIterator* it = gst_bin_iterate_recurse(GST_BIN(pipeline));
+        GValue item = G_VALUE_INIT;
+
+        while(!parser && gst_iterator_next(it, &item) == GST_ITERATOR_OK) {
+            GstElement* element = GST_ELEMENT(g_value_get_object(&item));
+            if(isStreamParser(element)) {
+                parser = GST_ELEMENT(gst_object_ref(element));
+            }
+            g_value_reset(&item);
+        }
+        g_value_unset(&item);
+        gst_iterator_free(it);
+        return parser;
+    }
+
+    Recorder::Recorder(): splitmux_{nullptr}, decodePad_{nullptr}, recordPad_{nullptr}, gateProbe_{0}, bus_{nullptr}, decoding_{true}, waitKeyframe_{false}, finishing_{false}, finished_{false}
+    {
+
+    }
+
+    Recorder::~Recorder()
+    {
+        if(bus_) {
+            gst_bus_set_sync_handler(bus_, NULL, NULL, NULL);
+            gst_object_unref(bus_);
+        }
+        if(decodePad_) {
+            gst_pad_remove_probe(decodePad_, gateProbe_);
+            gst_object_unref(decodePad_);
+        }
+        if(recordPad_) {
+            gst_object_unref(recordPad_);
+        }
+        if(splitmux_) {
+            g_signal_handlers_disconnect_by_data(splitmux_, this);
+            gst_object_unref(splitmux_);
+        }
+    }
+
+    bool Recorder::Attach(GstElement* pipeline, const GstRecordParam& params, const LaunchValues& values)
+    {
+        std::string error;
+        if(splitmux_ || !LaunchTemplateCache::Instance().Expand(params.location_, values, &location_, &error)) {
+            MT_LOG_ERROR(logRecord, "can not record to %s %s", params.location_.c_str(), error.c_str());
+            return false;
+        }
+        if(!segmentPattern(location_)) {
+            MT_LOG_ERROR(logRecord, "can not record to %s, it needs exactly one %%d style segment number",
+                         location_.c_str());
+            return false;
+        }
+        index_ = params.index_;
+
+        GstElement* parser = FindStreamParser(pipeline);
+        if(!parser) {
+            MT_LOG_ERROR(logRecord, "no h264parse / h265parse to record after");
+            return false;
+        }
+
+        GstPad* parserSrc = gst_element_get_static_pad(parser, "src");
+        GstPad* decodeSink = gst_pad_get_peer(parserSrc);
+        GstBin* bin = GST_BIN(gst_object_get_parent(GST_OBJECT(parser)));
+
+        GstElement* tee = makeElement("tee");
+        GstElement* decodeQueue = makeElement("queue");
+        GstElement* recordQueue = makeElement("queue");
+        GstElement* splitmux = makeElement("splitmuxsink");
+        GstElement* muxer = makeElement(params.muxer_.c_str());
+
+        bool attached = decodeSink && bin && tee && decodeQueue && recordQueue && splitmux && muxer;
+        if(attached) {
+            // segments cut at the first keyframe past a limit, the muxer only sees whole GOPs
+            g_object_set(splitmux,
+                         "muxer", muxer,
+                         "max-size-time", (guint64)params.segmentSeconds_ * GST_SECOND,
+                         "max-size-bytes", (guint64)params.segmentBytes_,
+                         "max-files", (guint)params.maxFiles_,
+                         NULL);
+            g_signal_connect(splitmux, "format-location-full", G_CALLBACK(onFormatLocation), this);
+
+            // parser ! tee ! queue ! <rest of the launch>
+            //              tee ! queue ! splitmuxsink
+            gst_pad_unlink(parserSrc, decodeSink);
+            gst_bin_add_many(bin, tee, decodeQueue, recordQueue, splitmux, NULL);
+
+            GstPad* decodeSrc = gst_element_get_static_pad(decodeQueue, "src");
+            attached = gst_element_link(parser, tee) && gst_element_link(tee, decodeQueue) &&
+                       gst_pad_link(decodeSrc, decodeSink) == GST_PAD_LINK_OK &&
+                       gst_element_link_many(tee, recordQueue, splitmux, NULL);
+            gst_object_unref(decodeSrc);
+
+            if(attached) {
+                GstPad* queueSink = gst_element_get_static_pad(decodeQueue, "sink");
+                decodePad_ = gst_pad_get_peer(queueSink);
+                gst_object_unref(queueSink);
+
+                gateProbe_ = gst_pad_add_probe(decodePad_, (GstPadProbeType)(GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_BUFFER_LIST),
+                                               gateProbe, this, NULL);
+                recordPad_ = gst_element_get_static_pad(recordQueue, "sink");
+                splitmux_ = GST_ELEMENT(gst_object_ref(splitmux));
+
+                // fragment messages would pile up on a bus nobody reads while decoding is off
+                bus_ = gst_pipeline_get_bus(GST_PIPELINE(pipeline));
+                gst_bus_set_sync_handler(bus_, onBusSync, this, NULL);
+            }
+        }
+        else {
+            for(GstElement* element : {tee, decodeQueue, recordQueue, splitmux, muxer}) {
+                if(element) {
+                    gst_object_unref(gst_object_ref_sink(element));
+                }
+            }
+        }
+
+        if(bin) {
+            gst_object_unref(bin);
+        }
+        if(decodeSink) {
+            gst_object_unref(decodeSink);
+        }
+        gst_object_unref(parserSrc);
+        gst_object_unref(parser);
+
+        if(!attached) {
+            MT_LOG_ERROR(logRecord, "failed to add the recording branch");
+            return false;
+        }
+        MT_LOG_INFO(logRecord, "recording %s segments of %u s to %s", params.muxer_.c_str(), params.segmentSeconds_,
+                    location_.c_str());
+        return true;
+    }
+
+    bool Recorder::Finish(Deadline deadline)
+    {
+        if(!splitmux_) {
+            return true;
+        }
+
+        GstState state = GST_STATE_NULL;
+        gst_element_get_state(splitmux_, &state, NULL, 0);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if(state != GST_STATE_PLAYING || segments_.empty()) {
+                return true;
+            }
+            finishing_ = true;
+            finished_ = false;
+        }
+
+        gst_pad_send_event(recordPad_, gst_event_new_eos());
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        const bool closed = closedEvent_.wait_until(lock, deadline, [this]() { return finished_; });
+        finishing_ = false;
+        if(!closed) {
+            MT_LOG_ERROR(logRecord, "segment %s not closed before the timeout", segments_.back().location.c_str());
+        }
+        return closed;
+    }
+
+    void Recorder::SetDecoding(bool decoding)
+    {
+        if(decoding && !decoding_) {
+            waitKeyframe_ = true;
+        }
+        decoding_ = decoding;
+    }
+
+    std::vector<RecordSegment> Recorder::Segments()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return segments_;
+    }
+
+    GstPadProbeReturn Recorder::gateProbe(GstPad* pad, GstPadProbeInfo* info, gpointer user_data)
+    {
+        Recorder* recorder = (Recorder*)user_data;
+
+        if(!recorder->decoding_) {
+            return GST_PAD_PROBE_DROP;
+        }
+        if(!recorder->waitKeyframe_) {
+            return GST_PAD_PROBE_OK;
+        }
+
+        // a list starts a GOP when its first buffer does
+        GstBuffer* buffer = (info->type & GST_PAD_PROBE_TYPE_BUFFER_LIST) ?
+                            gst_buffer_list_get(GST_PAD_PROBE_INFO_BUFFER_LIST(info), 0) :
+                            GST_PAD_PROBE_INFO_BUFFER(info);
+        if(!buffer || GST_BUFFER_FLAG_IS_SET(buffer, GST_BUFFER_FLAG_DELTA_UNIT)) {
+            return GST_PAD_PROBE_DROP;
+        }
+        recorder->waitKeyframe_ = false;
+        return GST_PAD_PROBE_OK;
+    }
+
+    gchar* Recorder::onFormatLocation(GstElement* splitmux, guint fragment, GstSample* first, gpointer user_data)
+    {
+        Recorder* recorder = (Recorder*)user_data;
+
+        // splitmuxsink owns the name, Attach() checked the pattern
+        gchar* location = g_strdup_printf(recorder->location_.c_str(), fragment);
+
+        RecordSegment segment;
+        segment.id = fragment;
+        segment.location = location;
+        segment.wallTime = (uint64_t)g_get_real_time() * 1000;
+        segment.pts = 0;
+
+        GstBuffer* buffer = first ? gst_sample_get_buffer(first) : NULL;
+        if(buffer && GST_BUFFER_PTS_IS_VALID(buffer)) {
+            segment.pts = GST_BUFFER_PTS(buffer);
+        }
+
+        if(!recorder->index_.empty()) {
+            FILE* index = fopen(recorder->index_.c_str(), "a");
+            if(index) {
+                fprintf(index, "%u\t%s\t%llu\t%llu\n", segment.id, segment.location.c_str(),
+                        (unsigned long long)segment.wallTime, (unsigned long long)segment.pts);
+                fclose(index);
+            }
+            else {
+                MT_LOG_ERROR(logRecord, "can not append to index %s", recorder->index_.c_str());
+            }
+        }
+        MT_LOG_INFO(logRecord, "segment %u: %s", segment.id, segment.location.c_str());
+
+        std::lock_guard<std::mutex> lock(recorder->mutex_);
+        recorder->segments_.push_back(segment);
+        return location;
+    }
+
+    GstBusSyncReply Recorder::onBusSync(GstBus* bus, GstMessage* msg, gpointer user_data)
+    {
+        if(GST_MESSAGE_TYPE(msg) != GST_MESSAGE_ELEMENT) {
+            return GST_BUS_PASS;
+        }
+
+        const GstStructure* s = gst_message_get_structure(msg);
+        if(!s || !g_str_has_prefix(gst_structure_get_name(s), "splitmuxsink-fragment")) {
+            return GST_BUS_PASS;
+        }
+
+        if(gst_structure_has_name(s, "splitmuxsink-fragment-closed")) {
+            Recorder* recorder = (Recorder*)user_data;
+            MT_LOG_DEBUG(logRecord, "segment %s closed", gst_structure_get_string(s, "location"));
+
+            std::lock_guard<std::mutex> lock(recorder->mutex_);
+            if(recorder->finishing_) {
+                recorder->finished_ = true;
+                recorder->closedEvent_.notify_all();
+            }
+        }
+        return GST_BUS_DROP;
+    }
+
+} // gst
+} // mtsai
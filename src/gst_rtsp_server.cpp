@@ -0,0 +1,461 @@
+#include "gst_rtsp_server_param.h"
+#include "gst_rtsp_server.h"
+
+#include <algorithm>
+
+#include "utils/mt_log.h"
+
+static mtsai::utils::LogCategory logRtsp("rtspserver", 50);
+
+namespace
+{
+    const char* kMountKey = "mtsai-mount";
+
+    GstRTSPFilterResult closeClient(GstRTSPServer* server, GstRTSPClient* client, gpointer user_data)
+    {
+        // the server may be gone before the connection is
+        g_signal_handlers_disconnect_by_data(client, user_data);
+        return GST_RTSP_FILTER_REMOVE;
+    }
+
+    GstRTSPFilterResult removeSession(GstRTSPSessionPool* pool, GstRTSPSession* session, gpointer user_data)
+    {
+        return GST_RTSP_FILTER_REMOVE;
+    }
+}
+
+GstRtspServer::GstRtspServer(): server_{nullptr}, mountPoints_{nullptr}, context_{nullptr}, loop_{nullptr}, serverSource_{0}, cleanupSource_{nullptr}, maxClients_{0}, maxViewers_{0}, connections_{0}, refused_{0}
+{
+
+}
+
+GstRtspServer::GstRtspServer(GstRtspServerParam params): GstRtspServer()
+{
+    Init(params);
+}
+
+GstRtspServer::~GstRtspServer()
+{
+    Stop();
+
+    // no new medias from the factories, then the server and its mounts go;
+    // frames still in a media's encoder only touch their own release counter
+    for(std::unique_ptr<MountPoint>& mount : mountList_) {
+        g_signal_handlers_disconnect_by_data(mount->factory, mount.get());
+    }
+    if(mountPoints_) {
+        g_object_unref(mountPoints_);
+    }
+    if(server_) {
+        g_object_unref(server_);
+    }
+    mountList_.clear();
+    if(loop_) {
+        g_main_loop_unref(loop_);
+    }
+    if(context_) {
+        g_main_context_unref(context_);
+    }
+}
+
+bool GstRtspServer::Init(GstRtspServerParam params)
+{
+    if(!mtsai::gst::Init()) {
+        return false;
+    }
+
+    maxClients_ = params.maxClients_;
+    maxViewers_ = params.maxViewers_;
+
+    server_ = gst_rtsp_server_new();
+    gst_rtsp_server_set_address(server_, params.address_.c_str());
+    gst_rtsp_server_set_service(server_, params.service_.c_str());
+
+    GstRTSPSessionPool* pool = gst_rtsp_server_get_session_pool(server_);
+    gst_rtsp_session_pool_set_max_sessions(pool, params.maxSessions_);
+    g_object_unref(pool);
+
+    mountPoints_ = gst_rtsp_server_get_mount_points(server_);
+    g_signal_connect(server_, "client-connected", G_CALLBACK(onClientConnected), this);
+
+    // the server's sources run here, not on the application's default context
+    context_ = g_main_context_new();
+    loop_ = g_main_loop_new(context_, FALSE);
+    return true;
+}
+
+bool GstRtspServer::Mount(const std::string& path, const std::string& launchTemplate,
+                          const mtsai::gst::LaunchValues& values, uint32_t maxViewers)
+{
+    std::string launch;
+    std::string error;
+    if(!mtsai::gst::LaunchTemplateCache::Instance().Expand(launchTemplate, values, &launch, &error)) {
+        MT_LOG_ERROR(logRtsp, "%s: failed to expand launch string: %s", path.c_str(), error.c_str());
+        return false;
+    }
+    return addMount(path, launch, maxViewers, nullptr) != nullptr;
+}
+
+GstOutput* GstRtspServer::MountFrames(const std::string& path, GstOutputParam params, uint32_t maxViewers)
+{
+    std::string launch;
+    std::string error;
+    if(!mtsai::gst::LaunchTemplateCache::Instance().Expand(params.launchStr_, params.values_, &launch, &error)) {
+        MT_LOG_ERROR(logRtsp, "%s: failed to expand launch string: %s", path.c_str(), error.c_str());
+        return nullptr;
+    }
+
+    // frames are refused until the first viewer builds the media
+    MountPoint* mount = addMount(path, launch, maxViewers, &params);
+    return mount ? mount->output.get() : nullptr;
+}
+
+bool GstRtspServer::Start()
+{
+    if(!server_ || serverSource_) {
+        return server_ != nullptr;
+    }
+
+    gchar* address = gst_rtsp_server_get_address(server_);
+    gchar* service = gst_rtsp_server_get_service(server_);
+    serverSource_ = gst_rtsp_server_attach(server_, context_);
+    if(serverSource_ == 0) {
+        MT_LOG_ERROR(logRtsp, "failed to listen on %s:%s", address, service);
+        g_free(address);
+        g_free(service);
+        return false;
+    }
+
+    // sessions of clients that vanished without a TEARDOWN time out
+    cleanupSource_ = g_timeout_source_new_seconds(2);
+    g_source_set_callback(cleanupSource_, onCleanup, this, NULL);
+    g_source_attach(cleanupSource_, context_);
+
+    thread_ = std::thread([this]() {
+        g_main_context_push_thread_default(context_);
+        g_main_loop_run(loop_);
+        g_main_context_pop_thread_default(context_);
+    });
+
+    MT_LOG_INFO(logRtsp, "listening on %s:%d", address, BoundPort());
+    g_free(address);
+    g_free(service);
+    return true;
+}
+
+void GstRtspServer::Stop()
+{
+    if(!serverSource_) {
+        return;
+    }
+
+    // closing the sessions unprepares the medias and stops their encoders
+    gst_rtsp_server_client_filter(server_, closeClient, this);
+    GstRTSPSessionPool* pool = gst_rtsp_server_get_session_pool(server_);
+    GList* kept = gst_rtsp_session_pool_filter(pool, removeSession, NULL);
+    g_list_free_full(kept, g_object_unref);
+    g_object_unref(pool);
+
+    g_main_loop_quit(loop_);
+    thread_.join();
+
+    GSource* source = g_main_context_find_source_by_id(context_, serverSource_);
+    if(source) {
+        g_source_destroy(source);
+    }
+    g_source_destroy(cleanupSource_);
+    g_source_unref(cleanupSource_);
+    cleanupSource_ = nullptr;
+    serverSource_ = 0;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    clients_.clear();
+    for(std::unique_ptr<MountPoint>& mount : mountList_) {
+        // a media not unprepared yet is still alive, it must not call back
+        // into the mount once the server is gone
+        if(mount->media) {
+            g_signal_handlers_disconnect_by_data(mount->media, mount.get());
+        }
+        mount->viewers = 0;
+        mount->media = nullptr;
+        if(mount->output) {
+            mount->output->Detach();
+        }
+    }
+}
+
+int GstRtspServer::BoundPort() const
+{
+    return serverSource_ ? gst_rtsp_server_get_bound_port(server_) : -1;
+}
+
+GstRtspServerStats GstRtspServer::Stats()
+{
+    const uint64_t now = mtsai::image::FrameClockNow();
+    GstRtspServerStats stats;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.clients = (uint32_t)clients_.size();
+    stats.connections = connections_;
+    stats.refused = refused_;
+
+    for(const auto& entry : clients_) {
+        const Client& client = entry.second;
+        GstRtspClientStats c;
+        c.address = client.address;
+        for(const MountPoint* mount : client.mounts) {
+            c.paths.push_back(mount->path);
+        }
+        c.connectedMs = (now - client.connectedAt) / 1e6;
+        c.playing = client.playing;
+        stats.clientStats.push_back(c);
+    }
+
+    for(const std::unique_ptr<MountPoint>& mount : mountList_) {
+        GstRtspMountStats m;
+        m.path = mount->path;
+        m.viewers = mount->viewers;
+        m.peakViewers = mount->peakViewers;
+        m.medias = mount->medias;
+        m.refused = mount->refused;
+        m.frames = mount->output ? mount->output->Stats() : GstOutputStats{0, 0, 0};
+        stats.mounts.push_back(m);
+    }
+    return stats;
+}
+
+GstRtspServer::MountPoint* GstRtspServer::addMount(const std::string& path, const std::string& launch,
+                                                   uint32_t maxViewers, const GstOutputParam* frames)
+{
+    if(!server_) {
+        return nullptr;
+    }
+
+    // one pipeline per mount, whatever the number of viewers
+    GstRTSPMediaFactory* factory = gst_rtsp_media_factory_new();
+    const std::string description = "( " + launch + " )";
+    gst_rtsp_media_factory_set_launch(factory, description.c_str());
+    gst_rtsp_media_factory_set_shared(factory, TRUE);
+
+    MountPoint* mount = new MountPoint();
+    mount->server = this;
+    mount->path = path;
+    mount->factory = factory;
+    mount->media = nullptr;
+    mount->maxViewers = maxViewers ? maxViewers : maxViewers_;
+    mount->viewers = 0;
+    mount->peakViewers = 0;
+    mount->medias = 0;
+    mount->refused = 0;
+    if(frames) {
+        mount->output.reset(new GstOutput());
+        mount->outputParam = *frames;
+    }
+
+    g_object_set_data(G_OBJECT(factory), kMountKey, mount);
+    g_signal_connect(factory, "media-configure", G_CALLBACK(onMediaConfigure), mount);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        mountList_.emplace_back(mount);
+    }
+
+    // the mount points own the factory
+    gst_rtsp_mount_points_add_factory(mountPoints_, path.c_str(), factory);
+    MT_LOG_INFO(logRtsp, "mounted %s: %s", path.c_str(), description.c_str());
+    return mount;
+}
+
+GstRtspServer::MountPoint* GstRtspServer::findMount(GstRTSPContext* ctx)
+{
+    if(!ctx || !ctx->uri || !ctx->uri->abspath) {
+        return nullptr;
+    }
+
+    // SETUP / TEARDOWN urls carry the stream after the mount path
+    GstRTSPMediaFactory* factory = gst_rtsp_mount_points_match(mountPoints_, ctx->uri->abspath, NULL);
+    if(!factory) {
+        return nullptr;
+    }
+    MountPoint* mount = (MountPoint*)g_object_get_data(G_OBJECT(factory), kMountKey);
+    g_object_unref(factory);
+    return mount;
+}
+
+void GstRtspServer::onClientConnected(GstRTSPServer* server, GstRTSPClient* client, gpointer user_data)
+{
+    GstRtspServer* rtsp = (GstRtspServer*)user_data;
+
+    GstRTSPConnection* connection = gst_rtsp_client_get_connection(client);
+    const std::string address = connection ? gst_rtsp_connection_get_ip(connection) : "";
+
+    {
+        std::lock_guard<std::mutex> lock(rtsp->mutex_);
+        if(rtsp->maxClients_ && rtsp->clients_.size() >= rtsp->maxClients_) {
+            rtsp->refused_++;
+            MT_LOG_WARNING(logRtsp, "client %s refused, %u connected", address.c_str(), rtsp->maxClients_);
+            gst_rtsp_client_close(client);
+            return;
+        }
+
+        Client& entry = rtsp->clients_[client];
+        entry.address = address;
+        entry.connectedAt = mtsai::image::FrameClockNow();
+        entry.playing = false;
+        rtsp->connections_++;
+    }
+
+    g_signal_connect(client, "closed", G_CALLBACK(onClientClosed), rtsp);
+    g_signal_connect(client, "pre-setup-request", G_CALLBACK(onPreSetup), rtsp);
+    g_signal_connect(client, "setup-request", G_CALLBACK(onSetup), rtsp);
+    g_signal_connect(client, "play-request", G_CALLBACK(onPlay), rtsp);
+    g_signal_connect(client, "teardown-request", G_CALLBACK(onTeardown), rtsp);
+    MT_LOG_INFO(logRtsp, "client %s connected", address.c_str());
+}
+
+void GstRtspServer::onClientClosed(GstRTSPClient* client, gpointer user_data)
+{
+    GstRtspServer* rtsp = (GstRtspServer*)user_data;
+
+    std::lock_guard<std::mutex> lock(rtsp->mutex_);
+    auto it = rtsp->clients_.find(client);
+    if(it == rtsp->clients_.end()) {
+        return;
+    }
+
+    // a client that drops the connection without TEARDOWN stops watching too
+    for(MountPoint* mount : it->second.mounts) {
+        mount->viewers--;
+    }
+    MT_LOG_INFO(logRtsp, "client %s closed", it->second.address.c_str());
+    rtsp->clients_.erase(it);
+}
+
+GstRTSPStatusCode GstRtspServer::onPreSetup(GstRTSPClient* client, GstRTSPContext* ctx, gpointer user_data)
+{
+    GstRtspServer* rtsp = (GstRtspServer*)user_data;
+    MountPoint* mount = rtsp->findMount(ctx);
+
+    std::lock_guard<std::mutex> lock(rtsp->mutex_);
+    auto it = rtsp->clients_.find(client);
+    if(!mount || it == rtsp->clients_.end()) {
+        return GST_RTSP_STS_OK;
+    }
+
+    // further streams of a mount the client already watches
+    const std::vector<MountPoint*>& mounts = it->second.mounts;
+    if(std::find(mounts.begin(), mounts.end(), mount) != mounts.end()) {
+        return GST_RTSP_STS_OK;
+    }
+
+    if(mount->maxViewers && mount->viewers >= mount->maxViewers) {
+        mount->refused++;
+        MT_LOG_WARNING(logRtsp, "%s: %s refused, %u viewers", mount->path.c_str(), it->second.address.c_str(),
+                       mount->viewers);
+        return GST_RTSP_STS_SERVICE_UNAVAILABLE;
+    }
+    return GST_RTSP_STS_OK;
+}
+
+void GstRtspServer::onSetup(GstRTSPClient* client, GstRTSPContext* ctx, gpointer user_data)
+{
+    GstRtspServer* rtsp = (GstRtspServer*)user_data;
+    MountPoint* mount = rtsp->findMount(ctx);
+
+    std::lock_guard<std::mutex> lock(rtsp->mutex_);
+    auto it = rtsp->clients_.find(client);
+    if(!mount || it == rtsp->clients_.end()) {
+        return;
+    }
+
+    std::vector<MountPoint*>& mounts = it->second.mounts;
+    if(std::find(mounts.begin(), mounts.end(), mount) == mounts.end()) {
+        mounts.push_back(mount);
+        mount->viewers++;
+        mount->peakViewers = std::max(mount->peakViewers, mount->viewers);
+    }
+}
+
+void GstRtspServer::onPlay(GstRTSPClient* client, GstRTSPContext* ctx, gpointer user_data)
+{
+    GstRtspServer* rtsp = (GstRtspServer*)user_data;
+
+    std::lock_guard<std::mutex> lock(rtsp->mutex_);
+    auto it = rtsp->clients_.find(client);
+    if(it != rtsp->clients_.end()) {
+        it->second.playing = true;
+    }
+}
+
+void GstRtspServer::onTeardown(GstRTSPClient* client, GstRTSPContext* ctx, gpointer user_data)
+{
+    GstRtspServer* rtsp = (GstRtspServer*)user_data;
+    MountPoint* mount = rtsp->findMount(ctx);
+
+    std::lock_guard<std::mutex> lock(rtsp->mutex_);
+    auto it = rtsp->clients_.find(client);
+    if(!mount || it == rtsp->clients_.end()) {
+        return;
+    }
+
+    std::vector<MountPoint*>& mounts = it->second.mounts;
+    auto watched = std::find(mounts.begin(), mounts.end(), mount);
+    if(watched != mounts.end()) {
+        mounts.erase(watched);
+        mount->viewers--;
+    }
+    it->second.playing = !mounts.empty();
+}
+
+void GstRtspServer::onMediaConfigure(GstRTSPMediaFactory* factory, GstRTSPMedia* media, gpointer user_data)
+{
+    MountPoint* mount = (MountPoint*)user_data;
+    {
+        std::lock_guard<std::mutex> lock(mount->server->mutex_);
+        mount->medias++;
+    }
+    if(!mount->output) {
+        return;
+    }
+
+    // pushed frames go to the appsrc of this media until it is unprepared
+    GstElement* element = gst_rtsp_media_get_element(media);
+    GstElement* appsrc = gst_bin_get_by_name_recurse_up(GST_BIN(element), "mysrc");
+    if(mount->output->Adopt(appsrc, mount->outputParam)) {
+        std::lock_guard<std::mutex> lock(mount->server->mutex_);
+        mount->media = media;
+        g_signal_connect(media, "unprepared", G_CALLBACK(onMediaUnprepared), mount);
+    }
+    else {
+        MT_LOG_ERROR(logRtsp, "%s: media without an appsrc named mysrc", mount->path.c_str());
+    }
+
+    if(appsrc) {
+        gst_object_unref(appsrc);
+    }
+    gst_object_unref(element);
+}
+
+void GstRtspServer::onMediaUnprepared(GstRTSPMedia* media, gpointer user_data)
+{
+    MountPoint* mount = (MountPoint*)user_data;
+    {
+        // a new media may already feed from the output
+        std::lock_guard<std::mutex> lock(mount->server->mutex_);
+        if(mount->media != media) {
+            return;
+        }
+        mount->media = nullptr;
+    }
+    mount->output->Detach();
+}
+
+gboolean GstRtspServer::onCleanup(gpointer user_data)
+{
+    GstRtspServer* rtsp = (GstRtspServer*)user_data;
+
+    GstRTSPSessionPool* pool = gst_rtsp_server_get_session_pool(rtsp->server_);
+    gst_rtsp_session_pool_cleanup(pool);
+    g_object_unref(pool);
+    return G_SOURCE_CONTINUE;
+}
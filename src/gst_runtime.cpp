@@ -0,0 +1,330 @@
+#include "gst_runtime.h"
+
+#include "utils/mt_log.h"
+
+#include <cctype>
+#include <cstdio>
+
+namespace mtsai
+{
+namespace gst
+{
+    namespace
+    {
+        std::once_flag initOnce;
+        bool initResult = false;
+
+        // GStreamer debug output, bursts of element warnings are rate limited
+        mtsai::utils::LogCategory logGst("gstreamer", 100);
+
+        // element FIXME / INFO lines are DEBUG here, the default level only
+        // shows GStreamer's errors and warnings
+        mtsai::utils::LogLevel logLevel(GstDebugLevel level)
+        {
+            switch(level) {
+            case GST_LEVEL_ERROR:   return mtsai::utils::LOG_LEVEL_ERROR;
+            case GST_LEVEL_WARNING: return mtsai::utils::LOG_LEVEL_WARNING;
+            case GST_LEVEL_FIXME:
+            case GST_LEVEL_INFO:
+            case GST_LEVEL_DEBUG:   return mtsai::utils::LOG_LEVEL_DEBUG;
+            default:                return mtsai::utils::LOG_LEVEL_TRACE;
+            }
+        }
+
+        // runs on the streaming thread that logged, only formats when the level is on
+        void gstLogFunction(GstDebugCategory* category, GstDebugLevel level, const gchar* file, const gchar* function,
+                            gint line, GObject* object, GstDebugMessage* message, gpointer user_data)
+        {
+            const mtsai::utils::LogLevel mapped = logLevel(level);
+
+            MT_LOG(logGst, mapped, "%s %s %s:%d %s", gst_debug_category_get_name(category),
+                   object ? G_OBJECT_TYPE_NAME(object) : "-", function, line, gst_debug_message_get(message));
+        }
+
+        void initGstreamer()
+        {
+            GError* err = NULL;
+            if(!gst_init_check(NULL, NULL, &err)) {
+                MT_LOG_ERROR(logGst, "failed to initialize gstreamer library with gst_init(): %s", err ? err->message : "unknown error");
+                g_clear_error(&err);
+                return;
+            }
+
+            uint32_t ver[] = {0, 0, 0, 0};
+            gst_version(&ver[0], &ver[1], &ver[2], &ver[3]);
+            MT_LOG_INFO(logGst, "Initialized gstreamer, Ver %u.%u.%u.%u", ver[0], ver[1], ver[2], ver[3]);
+
+            gst_debug_remove_log_function(gst_debug_log_default);
+            gst_debug_add_log_function(gstLogFunction, NULL, NULL);
+            gst_debug_set_active(true);
+            gst_debug_set_colored(false);
+            initResult = true;
+        }
+
+        // elements of a launch description, '!' inside quotes does not split
+        std::vector<std::string> splitLinks(const std::string& launch)
+        {
+            std::vector<std::string> segments(1);
+            char quote = 0;
+
+            for(char c : launch) {
+                if(quote) {
+                    quote = (c == quote) ? 0 : quote;
+                } else if(c == '"' || c == '\'') {
+                    quote = c;
+                } else if(c == '!') {
+                    segments.emplace_back();
+                    continue;
+                }
+                segments.back() += c;
+            }
+            return segments;
+        }
+
+        // "$" "{" name "}", text before it in *literal
+        bool nextPlaceholder(const std::string& text, size_t* pos, std::string* literal, std::string* name)
+        {
+            const size_t start = text.find("${", *pos);
+            if(start == std::string::npos) {
+                *literal = text.substr(*pos);
+                *pos = text.size();
+                return false;
+            }
+
+            const size_t end = text.find('}', start);
+            if(end == std::string::npos) {
+                *literal = text.substr(*pos);
+                *pos = text.size();
+                return false;
+            }
+
+            *literal = text.substr(*pos, start - *pos);
+            *name = text.substr(start + 2, end - start - 2);
+            *pos = end + 1;
+            return true;
+        }
+    }
+
+    bool Init()
+    {
+        std::call_once(initOnce, initGstreamer);
+        return initResult;
+    }
+
+    std::vector<std::string> LaunchFactories(const std::string& launch)
+    {
+        std::vector<std::string> factories;
+
+        for(const std::string& segment : splitLinks(launch)) {
+            // an element may follow a pad reference in the same segment ("t. ! queue"
+            // splits into "t. " and " queue"), and branches are separated by spaces
+            size_t pos = 0;
+            while(pos < segment.size()) {
+                while(pos < segment.size() && isspace((unsigned char)segment[pos])) pos++;
+                size_t end = pos;
+                while(end < segment.size() && !isspace((unsigned char)segment[end])) end++;
+
+                const std::string token = segment.substr(pos, end - pos);
+                pos = end;
+
+                // properties, caps, pad references and bins are not factories
+                if(token.empty() || token.find('=') != std::string::npos || token.find('/') != std::string::npos ||
+                   token.find('.') != std::string::npos || token[0] == '(' || token[0] == ')' ||
+                   token[0] == '"' || token[0] == '\'' || token[0] == '$') {
+                    continue;
+                }
+                factories.push_back(token);
+                break;      // the rest of the segment are its properties
+            }
+        }
+        return factories;
+    }
+
+    size_t WarmRegistry(const std::vector<std::string>& factories)
+    {
+        if(!Init()) {
+            return 0;
+        }
+
+        size_t found = 0;
+        for(const std::string& name : factories) {
+            GstElementFactory* factory = gst_element_factory_find(name.c_str());
+            if(!factory) {
+                MT_LOG_WARNING(logGst, "registry has no element %s", name.c_str());
+                continue;
+            }
+
+            GstPluginFeature* loaded = gst_plugin_feature_load(GST_PLUGIN_FEATURE(factory));
+            if(loaded) {
+                gst_object_unref(loaded);
+                found++;
+            }
+            gst_object_unref(factory);
+        }
+        return found;
+    }
+
+    LaunchTemplateCache::Template::~Template()
+    {
+        for(GstElementFactory* factory : factories) {
+            gst_object_unref(factory);
+        }
+    }
+
+    LaunchTemplateCache& LaunchTemplateCache::Instance()
+    {
+        static LaunchTemplateCache cache;
+        return cache;
+    }
+
+    std::shared_ptr<LaunchTemplateCache::Template> LaunchTemplateCache::lookup(const std::string& launchTemplate)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = templates_.find(launchTemplate);
+            if(it != templates_.end()) {
+                it->second->lastUse = ++uses_;
+                return it->second;
+            }
+        }
+
+        // split and load without the lock, cold starts of different
+        // templates load their plugins side by side
+        std::shared_ptr<Template> entry = std::make_shared<Template>();
+
+        size_t pos = 0;
+        std::string literal, name;
+        while(nextPlaceholder(launchTemplate, &pos, &literal, &name)) {
+            entry->pieces.push_back(literal);
+            entry->pieces.push_back(name);
+        }
+        entry->pieces.push_back(literal);
+
+        // keep the factories (and so their loaded plugins) for the life of the template
+        for(const std::string& factoryName : LaunchFactories(launchTemplate)) {
+            GstElementFactory* factory = gst_element_factory_find(factoryName.c_str());
+            GstPluginFeature* loaded = factory ? gst_plugin_feature_load(GST_PLUGIN_FEATURE(factory)) : NULL;
+
+            if(factory) {
+                gst_object_unref(factory);
+            }
+            if(!loaded) {
+                entry->error = "no element \"" + factoryName + "\"";
+                break;
+            }
+            entry->factories.push_back(GST_ELEMENT_FACTORY(loaded));
+        }
+
+        // a bad template is parsed again on the next call, it is not kept
+        if(!entry->error.empty()) {
+            return entry;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // another camera with the same template got here first
+        auto it = templates_.find(launchTemplate);
+        if(it != templates_.end()) {
+            it->second->lastUse = ++uses_;
+            return it->second;
+        }
+
+        // the least recently used one makes room
+        if(templates_.size() >= kMaxTemplates) {
+            auto oldest = templates_.begin();
+            for(auto t = templates_.begin(); t != templates_.end(); ++t) {
+                if(t->second->lastUse < oldest->second->lastUse) {
+                    oldest = t;
+                }
+            }
+            templates_.erase(oldest);
+        }
+
+        entry->lastUse = ++uses_;
+        templates_[launchTemplate] = entry;
+        return entry;
+    }
+
+    bool LaunchTemplateCache::expand(const Template& entry, const LaunchValues& values, std::string* launch, std::string* error)
+    {
+        std::string text;
+
+        for(size_t i = 0; i < entry.pieces.size(); i++) {
+            if(i % 2 == 0) {
+                text += entry.pieces[i];
+                continue;
+            }
+
+            auto value = values.find(entry.pieces[i]);
+            if(value == values.end()) {
+                if(error) *error = "no value for ${" + entry.pieces[i] + "}";
+                return false;
+            }
+            text += value->second;
+        }
+
+        *launch = text;
+        return true;
+    }
+
+    bool LaunchTemplateCache::Expand(const std::string& launchTemplate, const LaunchValues& values, std::string* launch, std::string* error)
+    {
+        if(!Init()) {
+            if(error) *error = "gstreamer is not initialized";
+            return false;
+        }
+        return expand(*lookup(launchTemplate), values, launch, error);
+    }
+
+    GstElement* LaunchTemplateCache::Instantiate(const std::string& launchTemplate, const LaunchValues& values, std::string* error)
+    {
+        if(!Init()) {
+            if(error) *error = "gstreamer is not initialized";
+            return NULL;
+        }
+
+        // one lookup, a bad template (not kept) loads its plugins once per call
+        std::shared_ptr<Template> entry = lookup(launchTemplate);
+        std::string launch;
+        if(!expand(*entry, values, &launch, error)) {
+            return NULL;
+        }
+        if(!entry->error.empty()) {
+            if(error) *error = entry->error;
+            return NULL;
+        }
+
+        // link failures are fatal, a half linked pipeline would only fail later at preroll
+        GError* err = NULL;
+        GstElement* pipeline = gst_parse_launch_full(launch.c_str(), NULL, GST_PARSE_FLAG_FATAL_ERRORS, &err);
+
+        if(err) {
+            if(error) *error = err->message;
+            g_clear_error(&err);
+
+            if(pipeline) {
+                gst_object_unref(pipeline);
+            }
+            return NULL;
+        }
+
+        if(pipeline && g_object_is_floating(pipeline)) {
+            gst_object_ref_sink(pipeline);
+        }
+        return pipeline;
+    }
+
+    size_t LaunchTemplateCache::Size()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return templates_.size();
+    }
+
+    void LaunchTemplateCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        templates_.clear();
+    }
+
+} // gst
+} // mtsai
@@ -0,0 +1,169 @@
+#include "gst_state.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace mtsai
+{
+namespace gst
+{
+    namespace
+    {
+        // bus polls are cut into slices so a state change completed behind
+        // our back (message popped elsewhere) is still noticed
+        const GstClockTime kPollSlice = 50 * GST_MSECOND;
+
+        double msSince(std::chrono::steady_clock::time_point start)
+        {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        GstState currentState(GstElement* pipeline)
+        {
+            GstState state = GST_STATE_VOID_PENDING;
+            gst_element_get_state(pipeline, &state, NULL, 0);
+            return state;
+        }
+
+        std::string errorText(GstMessage* msg)
+        {
+            GError* err = NULL;
+            gchar* debug = NULL;
+            gst_message_parse_error(msg, &err, &debug);
+
+            std::string text = GST_OBJECT_NAME(msg->src);
+            text += ": ";
+            text += err ? err->message : "unknown error";
+
+            g_clear_error(&err);
+            g_free(debug);
+            return text;
+        }
+
+        // the ERROR behind a FAILURE return is already on the bus
+        void drainError(GstBus* bus, StateChange* change, BusMessageFn onMessage, void* user)
+        {
+            while(GstMessage* msg = gst_bus_pop(bus)) {
+                if(GST_MESSAGE_TYPE(msg) == GST_MESSAGE_ERROR && change->error.empty()) {
+                    change->error = errorText(msg);
+                }
+                if(onMessage) {
+                    onMessage(msg, user);
+                }
+                gst_message_unref(msg);
+            }
+        }
+    }
+
+    Deadline DeadlineIn(unsigned long timeout)
+    {
+        return std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+    }
+
+    const char* StateResultName(StateResult result)
+    {
+        switch(result) {
+        case STATE_CHANGED:     return "changed";
+        case STATE_NO_PREROLL:  return "no preroll (live)";
+        case STATE_TIMEOUT:     return "timeout";
+        case STATE_FAILED:      return "failed";
+        default:                return "unknown";
+        }
+    }
+
+    StateChange SetState(GstElement* pipeline, GstState state, Deadline deadline,
+                         BusMessageFn onMessage, void* user)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        StateChange change;
+        change.target = state;
+
+        if(!pipeline) {
+            change.error = "no pipeline";
+            return change;
+        }
+
+        GstBus* bus = gst_element_get_bus(pipeline);
+        const GstStateChangeReturn ret = gst_element_set_state(pipeline, state);
+
+        switch(ret) {
+        case GST_STATE_CHANGE_SUCCESS:
+            change.result = STATE_CHANGED;
+            break;
+        case GST_STATE_CHANGE_NO_PREROLL:
+            change.result = STATE_NO_PREROLL;
+            break;
+        case GST_STATE_CHANGE_FAILURE:
+            change.result = STATE_FAILED;
+            drainError(bus, &change, onMessage, user);
+            break;
+        case GST_STATE_CHANGE_ASYNC:
+            change.result = STATE_TIMEOUT;
+
+            while(change.result == STATE_TIMEOUT) {
+                const auto left = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - std::chrono::steady_clock::now());
+                if(left.count() <= 0) {
+                    break;
+                }
+
+                GstMessage* msg = gst_bus_timed_pop(bus, std::min((GstClockTime)left.count(), kPollSlice));
+
+                if(msg) {
+                    if(GST_MESSAGE_TYPE(msg) == GST_MESSAGE_ERROR) {
+                        change.result = STATE_FAILED;
+                        change.error = errorText(msg);
+                    }
+                    else if(GST_MESSAGE_TYPE(msg) == GST_MESSAGE_ASYNC_DONE && GST_MESSAGE_SRC(msg) == GST_OBJECT(pipeline)) {
+                        change.result = STATE_CHANGED;
+                    }
+                    if(onMessage) {
+                        onMessage(msg, user);
+                    }
+                    gst_message_unref(msg);
+                }
+
+                // completed, or failed, without us seeing the message
+                if(change.result == STATE_TIMEOUT) {
+                    GstState current = GST_STATE_VOID_PENDING;
+                    const GstStateChangeReturn now = gst_element_get_state(pipeline, &current, NULL, 0);
+
+                    if(now == GST_STATE_CHANGE_FAILURE) {
+                        change.result = STATE_FAILED;
+                    }
+                    else if(now != GST_STATE_CHANGE_ASYNC && current == state) {
+                        change.result = (now == GST_STATE_CHANGE_NO_PREROLL) ? STATE_NO_PREROLL : STATE_CHANGED;
+                    }
+                }
+            }
+            break;
+        }
+
+        gst_object_unref(bus);
+
+        change.reached = currentState(pipeline);
+        change.elapsedMs = msSince(start);
+        return change;
+    }
+
+    std::vector<StateChange> SetStateAll(const std::vector<GstElement*>& pipelines, GstState state, Deadline deadline,
+                                         BusMessageFn onMessage, void* user)
+    {
+        std::vector<StateChange> changes(pipelines.size());
+        std::vector<std::thread> threads;
+        threads.reserve(pipelines.size());
+
+        // set_state itself blocks on NULL -> READY (device open, socket bind),
+        // so each pipeline gets its own thread rather than a set then wait loop
+        for(size_t i = 0; i < pipelines.size(); i++) {
+            threads.emplace_back([&, i]() {
+                changes[i] = SetState(pipelines[i], state, deadline, onMessage, user);
+            });
+        }
+        for(std::thread& t : threads) {
+            t.join();
+        }
+        return changes;
+    }
+
+} // gst
+} // mtsai
@@ -0,0 +1,189 @@
+#include "image/colour.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace mtsai
+{
+namespace image
+{
+    namespace
+    {
+        // luma weights of every matrix, Kr and Kb
+        const double kLumaWeights[3][2] = {
+            { 0.299,  0.114  },     // BT.601
+            { 0.2126, 0.0722 },     // BT.709
+            { 0.2627, 0.0593 }      // BT.2020
+        };
+
+        inline int32_t fixed(double v)
+        {
+            return (int32_t)lround(v * (1 << kColourShift));
+        }
+
+        struct ColourTables
+        {
+            YuvToRgbCoeffs toRgb[3][2];
+            RgbToYuvCoeffs toYuv[3][2];
+
+            ColourTables()
+            {
+                for(int m = 0; m < 3; m++) {
+                    const double kr = kLumaWeights[m][0];
+                    const double kb = kLumaWeights[m][1];
+                    const double kg = 1.0 - kr - kb;
+
+                    for(int r = 0; r < 2; r++) {
+                        const bool full = (r == COLOUR_RANGE_FULL);
+
+                        // code values per unit of E'Y and E'Pb / E'Pr
+                        const double yScale = full ? 255.0 : 219.0;
+                        const double cScale = full ? 255.0 : 224.0;
+
+                        YuvToRgbCoeffs& a = toRgb[m][r];
+                        a.y       = fixed(255.0 / yScale);
+                        a.crR     = fixed(2.0 * (1.0 - kr) * 255.0 / cScale);
+                        a.cbG     = fixed(2.0 * kb * (1.0 - kb) / kg * 255.0 / cScale);
+                        a.crG     = fixed(2.0 * kr * (1.0 - kr) / kg * 255.0 / cScale);
+                        a.cbB     = fixed(2.0 * (1.0 - kb) * 255.0 / cScale);
+                        a.yOffset = full ? 0 : 16;
+
+                        RgbToYuvCoeffs& b = toYuv[m][r];
+                        b.yR = fixed(kr * yScale / 255.0);
+                        b.yG = fixed(kg * yScale / 255.0);
+                        b.yB = fixed(kb * yScale / 255.0);
+
+                        b.cbR = fixed(-kr / (2.0 * (1.0 - kb)) * cScale / 255.0);
+                        b.cbG = fixed(-kg / (2.0 * (1.0 - kb)) * cScale / 255.0);
+                        b.cbB = -(b.cbR + b.cbG);
+
+                        b.crG = fixed(-kg / (2.0 * (1.0 - kr)) * cScale / 255.0);
+                        b.crB = fixed(-kb / (2.0 * (1.0 - kr)) * cScale / 255.0);
+                        b.crR = -(b.crG + b.crB);
+
+                        b.yOffset = full ? 0 : 16;
+                    }
+                }
+            }
+        };
+
+        const ColourTables& colourTables()
+        {
+            static const ColourTables tables;
+            return tables;
+        }
+
+        inline int matrixIndex(ColourMatrix matrix)
+        {
+            return (matrix >= COLOUR_BT601 && matrix <= COLOUR_BT2020) ? (int)matrix : (int)COLOUR_BT601;
+        }
+
+        inline int rangeIndex(ColourRange range)
+        {
+            return (range == COLOUR_RANGE_FULL) ? 1 : 0;
+        }
+    }
+
+    const YuvToRgbCoeffs& GetYuvToRgbCoeffs(const ColourSpace& colour)
+    {
+        return colourTables().toRgb[matrixIndex(colour.matrix)][rangeIndex(colour.range)];
+    }
+
+    const RgbToYuvCoeffs& GetRgbToYuvCoeffs(const ColourSpace& colour)
+    {
+        return colourTables().toYuv[matrixIndex(colour.matrix)][rangeIndex(colour.range)];
+    }
+
+    void GetYuvToRgbMatrix(const ColourSpace& colour, float matrix[9], float offset[3])
+    {
+        const YuvToRgbCoeffs& k = GetYuvToRgbCoeffs(colour);
+        const float s = 1.0f / (1 << kColourShift);
+
+        const float y   = k.y * s;
+        const float crR = k.crR * s;
+        const float cbG = k.cbG * s;
+        const float crG = k.crG * s;
+        const float cbB = k.cbB * s;
+
+        matrix[0] = y;  matrix[1] = 0.0f;  matrix[2] = crR;
+        matrix[3] = y;  matrix[4] = -cbG;  matrix[5] = -crG;
+        matrix[6] = y;  matrix[7] = cbB;   matrix[8] = 0.0f;
+
+        offset[0] = -k.yOffset * y - 128.0f * crR;
+        offset[1] = -k.yOffset * y + 128.0f * (cbG + crG);
+        offset[2] = -k.yOffset * y - 128.0f * cbB;
+    }
+
+    bool ParseColorimetry(const char* colorimetry, ColourSpace* colour)
+    {
+        if(!colorimetry || !colour) {
+            return false;
+        }
+
+        ColourSpace parsed;
+
+        if(!strcmp(colorimetry, "bt601")) {
+            parsed.matrix = COLOUR_BT601;
+        } else if(!strcmp(colorimetry, "bt709")) {
+            parsed.matrix = COLOUR_BT709;
+        } else if(!strncmp(colorimetry, "bt2020", 6) || !strncmp(colorimetry, "bt2100", 6)) {
+            parsed.matrix = COLOUR_BT2020;
+        } else if(!strcmp(colorimetry, "sRGB")) {
+            parsed.matrix = COLOUR_BT709;
+            parsed.range = COLOUR_RANGE_FULL;
+        } else if(!strcmp(colorimetry, "jpeg")) {
+            parsed.matrix = COLOUR_BT601;
+            parsed.range = COLOUR_RANGE_FULL;
+        } else {
+            // GstVideoColorimetry "range:matrix:transfer:primaries"
+            int range = 0, matrix = 0, transfer = 0, primaries = 0;
+            if(sscanf(colorimetry, "%d:%d:%d:%d", &range, &matrix, &transfer, &primaries) != 4) {
+                return false;
+            }
+
+            switch(matrix) {
+            case 2:     // FCC
+            case 4:     parsed.matrix = COLOUR_BT601;  break;
+            case 3:
+            case 5:     parsed.matrix = COLOUR_BT709;  break;    // SMPTE 240M is close to BT.709
+            case 6:     parsed.matrix = COLOUR_BT2020; break;
+            default:    return false;
+            }
+            parsed.range = (range == 1) ? COLOUR_RANGE_FULL : COLOUR_RANGE_LIMITED;
+        }
+
+        *colour = parsed;
+        return true;
+    }
+
+    const char* ColourSpaceName(const ColourSpace& colour)
+    {
+        static const char* names[3][2] = {
+            { "bt601 limited",  "bt601 full"  },
+            { "bt709 limited",  "bt709 full"  },
+            { "bt2020 limited", "bt2020 full" }
+        };
+        return names[matrixIndex(colour.matrix)][rangeIndex(colour.range)];
+    }
+
+    void RGBtoUYVYRow(const uint8_t* src, size_t step, uint8_t* dst, size_t width, const RgbToYuvCoeffs& k)
+    {
+        for(size_t x = 0; x + 2 <= width; x += 2, src += step * 2, dst += 4) {
+            const uint8_t* p0 = src;
+            const uint8_t* p1 = src + step;
+            uint8_t cb, cr, unused;
+
+            RgbToYuv(k, p0[0], p0[1], p0[2], &dst[1], &unused, &unused);
+            RgbToYuv(k, p1[0], p1[1], p1[2], &dst[3], &unused, &unused);
+            RgbToYuv(k, (p0[0] + p1[0] + 1) >> 1, (p0[1] + p1[1] + 1) >> 1, (p0[2] + p1[2] + 1) >> 1,
+                     &unused, &cb, &cr);
+
+            dst[0] = cb;
+            dst[2] = cr;
+        }
+    }
+
+} // image
+} // mtsai
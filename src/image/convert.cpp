@@ -0,0 +1,106 @@
+#include "image/convert.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace mtsai
+{
+namespace image
+{
+    namespace
+    {
+        struct BackendRegistry
+        {
+            std::mutex mutex;
+            std::vector<ConvertBackend*> backends;
+        };
+
+        BackendRegistry& registry()
+        {
+            static BackendRegistry instance;
+            return instance;
+        }
+
+        ConvertBackend* findBackend(ConvertBackendType type)
+        {
+            BackendRegistry& reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+
+            for(ConvertBackend* backend : reg.backends) {
+                if(backend->Type() == type && backend->Available()) {
+                    return backend;
+                }
+            }
+            return nullptr;
+        }
+    }
+
+    bool ConvertBackend::ConvertFrame(const FrameDescriptor& frame, const void* src, void* dst, PixelType type)
+    {
+        if(!IsPackedFrame(frame)) {
+            char fourcc[5];
+            FourccToString(frame.fourcc, fourcc);
+            printf("convert -- %s backend has no strided %s %ux%u conversion\n", Name(), fourcc, frame.width, frame.height);
+            return false;
+        }
+
+        const uint8_t* data = (const uint8_t*)src;
+
+        switch(frame.fourcc) {
+        case FOURCC_NV12:   return NV12toRGBA(data, dst, type, frame.width, frame.height, frame.colour);
+        case FOURCC_UYVY:   return UYVYtoRGBA(data, dst, type, frame.width, frame.height, frame.colour);
+        case FOURCC_RGB24:  return RGBtoRGBA(data, dst, type, frame.width, frame.height);
+        case FOURCC_GRBG8:  return BayerGR8toRGBA(data, dst, type, frame.width, frame.height);
+        default:            return false;
+        }
+    }
+
+    void RegisterConvertBackend(ConvertBackend* backend)
+    {
+        if(!backend) {
+            return;
+        }
+
+        BackendRegistry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+
+        for(ConvertBackend* b : reg.backends) {
+            if(b == backend) {
+                return;
+            }
+        }
+        reg.backends.push_back(backend);
+    }
+
+    ConvertBackend* GetConvertBackend(ConvertBackendType type)
+    {
+        if(type == CONVERT_BACKEND_AUTO) {
+            const char* env = getenv("GSTCAMERA_CONVERT");
+
+            if(env && strcmp(env, "cpu") == 0) {
+                type = CONVERT_BACKEND_CPU;
+            } else if(env && strcmp(env, "cuda") == 0) {
+                type = CONVERT_BACKEND_CUDA;
+            } else {
+                ConvertBackend* cuda = findBackend(CONVERT_BACKEND_CUDA);
+                return cuda ? cuda : GetCpuConvertBackend();
+            }
+        }
+
+        if(type == CONVERT_BACKEND_CPU) {
+            return GetCpuConvertBackend();
+        }
+
+        ConvertBackend* backend = findBackend(type);
+        if(!backend) {
+            printf("convert -- requested backend is not available, using CPU\n");
+            return GetCpuConvertBackend();
+        }
+        return backend;
+    }
+
+} // image
+} // mtsai
@@ -0,0 +1,574 @@
+#include "image/convert.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace mtsai
+{
+namespace image
+{
+    namespace
+    {
+        inline void storeRGBA(float* dst, float r, float g, float b, float a)
+        {
+            dst[0] = r;
+            dst[1] = g;
+            dst[2] = b;
+            dst[3] = a;
+        }
+
+        /*
+         * Bayer GRBG (cudaRGB-NV12.cu BAYER_GR8toRGBA)
+         * Keeps the kernel's interpolation as is, including its operator
+         * precedence. The kernel reads outside the image on the borders,
+         * here the neighbours are clamped to the image instead.
+         */
+        inline void bayerPixel(const uint8_t* src, size_t stride, size_t width, size_t height, size_t x, size_t y, float* dst)
+        {
+            const size_t xl = (x > 0) ? x - 1 : x;
+            const size_t xr = (x + 1 < width) ? x + 1 : x;
+            const size_t yd = (y + 1 < height) ? y + 1 : y;
+
+            const uint8_t* row  = src + y * stride;
+            const uint8_t* down = src + yd * stride;
+
+            const int c  = row[x];
+            const int l  = row[xl];
+            const int r  = row[xr];
+            const int d  = down[x];
+            const int dl = down[xl];
+            const int dr = down[xr];
+
+            const bool lineOdd  = (y % 2) == 0;
+            const bool pixelOdd = ((y * width + x) % 2) != 0;
+
+            if(lineOdd && pixelOdd) {
+                storeRGBA(dst, l + r / 2, c, d, 0.0f);
+            } else if(lineOdd) {
+                storeRGBA(dst, c, l + r / 2, dl + dr / 2, 0.0f);
+            } else if(pixelOdd) {
+                storeRGBA(dst, dl + dr / 2, r + l / 2, c, 0.0f);
+            } else {
+                storeRGBA(dst, d + d / 2, c, r + l / 2, 0.0f);
+            }
+        }
+
+#if defined(__SSE2__)
+        inline __m128i load4u8(const uint8_t* src)
+        {
+            int32_t v;
+            memcpy(&v, src, sizeof(v));
+            const __m128i zero = _mm_setzero_si128();
+            return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(v), zero), zero);
+        }
+
+        inline __m128i select(__m128i mask, __m128i a, __m128i b)
+        {
+            return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+        }
+
+        // Transpose planar r/g/b/a lanes into 4 consecutive float4 pixels
+        inline void storeRGBA4(float* dst, __m128 r, __m128 g, __m128 b, __m128 a)
+        {
+            _MM_TRANSPOSE4_PS(r, g, b, a);
+            _mm_storeu_ps(dst,      r);
+            _mm_storeu_ps(dst + 4,  g);
+            _mm_storeu_ps(dst + 8,  b);
+            _mm_storeu_ps(dst + 12, a);
+        }
+#endif
+
+#if defined(__SSE2__)
+        /*
+         * 8 pixels of YCbCr to RGBA8 with the colour core's fixed point math.
+         * y holds 8 luma samples, c the 4 Cb Cr pairs of the pixel pairs, all
+         * as 16 bit lanes.
+         */
+        inline void yuvToRGBA8x8(__m128i y, __m128i c, const YuvToRgbCoeffs& k, uint8_t* dst)
+        {
+            const __m128i ones  = _mm_set1_epi16(1);
+            const __m128i alpha = _mm_set1_epi16(255);
+
+            y = _mm_sub_epi16(y, _mm_set1_epi16((short)k.yOffset));
+            c = _mm_sub_epi16(c, _mm_set1_epi16(128));
+
+            // (u, v) of every pixel, each pair used twice
+            const __m128i u4 = _mm_srai_epi32(_mm_slli_epi32(c, 16), 16);
+            const __m128i v4 = _mm_srai_epi32(c, 16);
+            const __m128i uv = _mm_unpacklo_epi16(_mm_packs_epi32(u4, u4), _mm_packs_epi32(v4, v4));
+            const __m128i uvLo = _mm_unpacklo_epi32(uv, uv);
+            const __m128i uvHi = _mm_unpackhi_epi32(uv, uv);
+
+            // (Y - offset) * y + round as madd of (Y, 1) pairs
+            const __m128i ky  = _mm_setr_epi16((short)k.y, kColourRound, (short)k.y, kColourRound,
+                                               (short)k.y, kColourRound, (short)k.y, kColourRound);
+            const __m128i tLo = _mm_madd_epi16(_mm_unpacklo_epi16(y, ones), ky);
+            const __m128i tHi = _mm_madd_epi16(_mm_unpackhi_epi16(y, ones), ky);
+
+            const __m128i kR = _mm_setr_epi16(0, (short)k.crR, 0, (short)k.crR, 0, (short)k.crR, 0, (short)k.crR);
+            const __m128i kG = _mm_setr_epi16((short)-k.cbG, (short)-k.crG, (short)-k.cbG, (short)-k.crG,
+                                              (short)-k.cbG, (short)-k.crG, (short)-k.cbG, (short)-k.crG);
+            const __m128i kB = _mm_setr_epi16((short)k.cbB, 0, (short)k.cbB, 0, (short)k.cbB, 0, (short)k.cbB, 0);
+
+            const __m128i r = _mm_packs_epi32(_mm_srai_epi32(_mm_add_epi32(tLo, _mm_madd_epi16(uvLo, kR)), kColourShift),
+                                              _mm_srai_epi32(_mm_add_epi32(tHi, _mm_madd_epi16(uvHi, kR)), kColourShift));
+            const __m128i g = _mm_packs_epi32(_mm_srai_epi32(_mm_add_epi32(tLo, _mm_madd_epi16(uvLo, kG)), kColourShift),
+                                              _mm_srai_epi32(_mm_add_epi32(tHi, _mm_madd_epi16(uvHi, kG)), kColourShift));
+            const __m128i b = _mm_packs_epi32(_mm_srai_epi32(_mm_add_epi32(tLo, _mm_madd_epi16(uvLo, kB)), kColourShift),
+                                              _mm_srai_epi32(_mm_add_epi32(tHi, _mm_madd_epi16(uvHi, kB)), kColourShift));
+
+            // r0..r7 b0..b7 and g0..g7 a0..a7, interleaved to r g b a
+            const __m128i rb = _mm_packus_epi16(r, b);
+            const __m128i ga = _mm_packus_epi16(g, alpha);
+            const __m128i rg = _mm_unpacklo_epi8(rb, ga);
+            const __m128i ba = _mm_unpackhi_epi8(rb, ga);
+
+            _mm_storeu_si128((__m128i*)dst,        _mm_unpacklo_epi16(rg, ba));
+            _mm_storeu_si128((__m128i*)(dst + 16), _mm_unpackhi_epi16(rg, ba));
+        }
+#endif
+
+        inline void storeYuvPixel(const YuvToRgbCoeffs& k, int y, int cb, int cr, uint8_t* dst)
+        {
+            YuvToRgb(k, y, cb, cr, dst, dst + 1, dst + 2);
+            dst[3] = 255;
+        }
+
+        void nv12Row(const uint8_t* luma, const uint8_t* chroma, uint8_t* dst, size_t width, const YuvToRgbCoeffs& k)
+        {
+            size_t x = 0;
+
+#if defined(__SSE2__)
+            const __m128i zero = _mm_setzero_si128();
+
+            for(; x + 8 <= width; x += 8) {
+                const __m128i y = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(luma + x)), zero);
+                const __m128i c = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(chroma + x)), zero);
+                yuvToRGBA8x8(y, c, k, dst + x * 4);
+            }
+#endif
+            for(; x < width; x += 2) {
+                storeYuvPixel(k, luma[x],     chroma[x], chroma[x + 1], dst + x * 4);
+                storeYuvPixel(k, luma[x + 1], chroma[x], chroma[x + 1], dst + (x + 1) * 4);
+            }
+        }
+
+        void uyvyRow(const uint8_t* src, uint8_t* dst, size_t width, const YuvToRgbCoeffs& k)
+        {
+            size_t x = 0;
+
+#if defined(__SSE2__)
+            const __m128i lowByte = _mm_set1_epi16(0x00FF);
+
+            // Cb Y0 Cr Y1, luma in the high bytes, chroma pairs in the low ones
+            for(; x + 8 <= width; x += 8) {
+                const __m128i v = _mm_loadu_si128((const __m128i*)(src + x * 2));
+                yuvToRGBA8x8(_mm_srli_epi16(v, 8), _mm_and_si128(v, lowByte), k, dst + x * 4);
+            }
+#endif
+            for(; x + 2 <= width; x += 2) {
+                const uint8_t* p = src + x * 2;
+                storeYuvPixel(k, p[1], p[0], p[2], dst + x * 4);
+                storeYuvPixel(k, p[3], p[0], p[2], dst + (x + 1) * 4);
+            }
+        }
+
+        void yuyvRow(const uint8_t* src, uint8_t* dst, size_t width, const YuvToRgbCoeffs& k)
+        {
+            size_t x = 0;
+
+#if defined(__SSE2__)
+            const __m128i lowByte = _mm_set1_epi16(0x00FF);
+
+            // Y0 Cb Y1 Cr, luma in the low bytes, chroma pairs in the high ones
+            for(; x + 8 <= width; x += 8) {
+                const __m128i v = _mm_loadu_si128((const __m128i*)(src + x * 2));
+                yuvToRGBA8x8(_mm_and_si128(v, lowByte), _mm_srli_epi16(v, 8), k, dst + x * 4);
+            }
+#endif
+            for(; x + 2 <= width; x += 2) {
+                const uint8_t* p = src + x * 2;
+                storeYuvPixel(k, p[0], p[1], p[3], dst + x * 4);
+                storeYuvPixel(k, p[2], p[1], p[3], dst + (x + 1) * 4);
+            }
+        }
+
+        void rgbRow(const uint8_t* src, float* dst, size_t width, size_t available, bool bgr)
+        {
+            size_t x = 0;
+
+#if defined(__SSE2__)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i mask = _mm_setr_epi32(-1, -1, -1, 0);
+
+            // 4 pixels use 12 bytes but the load reads 16
+            for(; x + 4 <= width && x * 3 + 16 <= available; x += 4) {
+                const __m128i v = _mm_loadu_si128((const __m128i*)(src + x * 3));
+
+                __m128i p0 = _mm_unpacklo_epi16(_mm_unpacklo_epi8(v, zero), zero);
+                __m128i p1 = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_srli_si128(v, 3), zero), zero);
+                __m128i p2 = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_srli_si128(v, 6), zero), zero);
+                __m128i p3 = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_srli_si128(v, 9), zero), zero);
+
+                if(bgr) {
+                    p0 = _mm_shuffle_epi32(p0, _MM_SHUFFLE(3, 0, 1, 2));
+                    p1 = _mm_shuffle_epi32(p1, _MM_SHUFFLE(3, 0, 1, 2));
+                    p2 = _mm_shuffle_epi32(p2, _MM_SHUFFLE(3, 0, 1, 2));
+                    p3 = _mm_shuffle_epi32(p3, _MM_SHUFFLE(3, 0, 1, 2));
+                }
+
+                _mm_storeu_ps(dst + x * 4,      _mm_cvtepi32_ps(_mm_and_si128(p0, mask)));
+                _mm_storeu_ps(dst + x * 4 + 4,  _mm_cvtepi32_ps(_mm_and_si128(p1, mask)));
+                _mm_storeu_ps(dst + x * 4 + 8,  _mm_cvtepi32_ps(_mm_and_si128(p2, mask)));
+                _mm_storeu_ps(dst + x * 4 + 12, _mm_cvtepi32_ps(_mm_and_si128(p3, mask)));
+            }
+#endif
+            const int r = bgr ? 2 : 0;
+
+            for(; x < width; x++) {
+                storeRGBA(dst + x * 4, src[x * 3 + r], src[x * 3 + 1], src[x * 3 + 2 - r], 0.0f);
+            }
+        }
+
+        void bayerRow(const uint8_t* src, size_t stride, float* out, size_t width, size_t height, size_t y)
+        {
+            size_t x = 0;
+
+            bayerPixel(src, stride, width, height, x++, y, out);
+
+#if defined(__SSE2__)
+            if(y + 1 < height) {
+                const uint8_t* row  = src + y * stride;
+                const uint8_t* down = row + stride;
+                const bool lineOdd  = (y % 2) == 0;
+                const __m128 alpha  = _mm_setzero_ps();
+
+                for(; x + 5 <= width; x += 4) {
+                    const __m128i c  = load4u8(row + x);
+                    const __m128i l  = load4u8(row + x - 1);
+                    const __m128i r  = load4u8(row + x + 1);
+                    const __m128i d  = load4u8(down + x);
+                    const __m128i dl = load4u8(down + x - 1);
+                    const __m128i dr = load4u8(down + x + 1);
+
+                    // lanes holding an odd pixel index
+                    const __m128i odd = ((y * width + x) % 2) ? _mm_setr_epi32(-1, 0, -1, 0)
+                                                              : _mm_setr_epi32(0, -1, 0, -1);
+                    __m128i red, green, blue;
+
+                    if(lineOdd) {
+                        const __m128i lr = _mm_add_epi32(l, _mm_srli_epi32(r, 1));
+                        red   = select(odd, lr, c);
+                        green = select(odd, c, lr);
+                        blue  = select(odd, d, _mm_add_epi32(dl, _mm_srli_epi32(dr, 1)));
+                    } else {
+                        const __m128i rl = _mm_add_epi32(r, _mm_srli_epi32(l, 1));
+                        red   = select(odd, _mm_add_epi32(dl, _mm_srli_epi32(dr, 1)), _mm_add_epi32(d, _mm_srli_epi32(d, 1)));
+                        green = select(odd, rl, c);
+                        blue  = select(odd, c, rl);
+                    }
+
+                    storeRGBA4(out + x * 4, _mm_cvtepi32_ps(red), _mm_cvtepi32_ps(green), _mm_cvtepi32_ps(blue), alpha);
+                }
+            }
+#endif
+            for(; x < width; x++) {
+                bayerPixel(src, stride, width, height, x, y, out + x * 4);
+            }
+        }
+
+
+        // float RGBA row to 8 bit, rounded and saturated, alpha 255
+        void packRow(const float* src, uint8_t* dst, size_t width)
+        {
+            size_t x = 0;
+
+#if defined(__SSE2__)
+            const __m128i alpha = _mm_set1_epi32((int)0xFF000000);
+
+            for(; x + 4 <= width; x += 4) {
+                const __m128i p0 = _mm_cvtps_epi32(_mm_loadu_ps(src + x * 4));
+                const __m128i p1 = _mm_cvtps_epi32(_mm_loadu_ps(src + x * 4 + 4));
+                const __m128i p2 = _mm_cvtps_epi32(_mm_loadu_ps(src + x * 4 + 8));
+                const __m128i p3 = _mm_cvtps_epi32(_mm_loadu_ps(src + x * 4 + 12));
+
+                const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3));
+                _mm_storeu_si128((__m128i*)(dst + x * 4), _mm_or_si128(packed, alpha));
+            }
+#endif
+            for(; x < width; x++) {
+                for(int c = 0; c < 3; c++) {
+                    const long q = lrintf(src[x * 4 + c]);
+                    dst[x * 4 + c] = (uint8_t)(q < 0 ? 0 : q > 255 ? 255 : q);
+                }
+                dst[x * 4 + 3] = 255;
+            }
+        }
+
+        /*
+         * Runs a float row converter for every row, straight into the output
+         * for float RGBA or through a scratch row that is packed to 8 bit.
+         */
+        template<typename RowFunc>
+        void convertRows(void* dst, PixelType type, size_t width, size_t height, RowFunc row)
+        {
+            std::vector<float> scratch(type == PIXEL_TYPE_RGBA8 ? width * 4 : 0);
+
+            for(size_t y = 0; y < height; y++) {
+                if(type == PIXEL_TYPE_RGBAF) {
+                    row(y, (float*)dst + y * width * 4);
+                } else {
+                    row(y, scratch.data());
+                    packRow(scratch.data(), (uint8_t*)dst + y * width * 4, width);
+                }
+            }
+        }
+
+        // 8 bit RGBA row to float, alpha written as the given value
+        void widenRow(const uint8_t* src, float* dst, size_t width, float alpha)
+        {
+            size_t x = 0;
+
+#if defined(__SSE2__)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128 rgb   = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+            const __m128 a     = _mm_setr_ps(0.0f, 0.0f, 0.0f, alpha);
+
+            for(; x + 4 <= width; x += 4) {
+                const __m128i v  = _mm_loadu_si128((const __m128i*)(src + x * 4));
+                const __m128i lo = _mm_unpacklo_epi8(v, zero);
+                const __m128i hi = _mm_unpackhi_epi8(v, zero);
+
+                const __m128 p[4] = {
+                    _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)),
+                    _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero))
+                };
+                for(int i = 0; i < 4; i++) {
+                    _mm_storeu_ps(dst + (x + i) * 4, _mm_or_ps(_mm_and_ps(p[i], rgb), a));
+                }
+            }
+#endif
+            for(; x < width; x++) {
+                storeRGBA(dst + x * 4, src[x * 4], src[x * 4 + 1], src[x * 4 + 2], alpha);
+            }
+        }
+
+        /*
+         * Runs an 8 bit row converter for every row, straight into the output
+         * for 8 bit RGBA or through a scratch row widened to float.
+         */
+        template<typename RowFunc>
+        void convertRows8(void* dst, PixelType type, size_t width, size_t height, float alpha, RowFunc row)
+        {
+            std::vector<uint8_t> scratch(type == PIXEL_TYPE_RGBAF ? width * 4 : 0);
+
+            for(size_t y = 0; y < height; y++) {
+                if(type == PIXEL_TYPE_RGBA8) {
+                    row(y, (uint8_t*)dst + y * width * 4);
+                } else {
+                    row(y, scratch.data());
+                    widenRow(scratch.data(), (float*)dst + y * width * 4, width, alpha);
+                }
+            }
+        }
+
+        class CpuConvertBackend : public ConvertBackend
+        {
+        public:
+            const char* Name() const override           { return "cpu"; }
+            ConvertBackendType Type() const override    { return CONVERT_BACKEND_CPU; }
+            bool Available() const override             { return true; }
+
+            void* Alloc(size_t size) override
+            {
+                void* ptr = nullptr;
+                if(size == 0 || posix_memalign(&ptr, 64, size) != 0) {
+                    return nullptr;
+                }
+                return ptr;
+            }
+
+            void Free(void* ptr) override
+            {
+                free(ptr);
+            }
+
+            bool NV12toRGBA(const uint8_t* src, void* dst, PixelType type, size_t width, size_t height,
+                            const ColourSpace& colour) override
+            {
+                return nv12(src, width, src + width * height, width, dst, type, width, height, colour);
+            }
+
+            bool UYVYtoRGBA(const uint8_t* src, void* dst, PixelType type, size_t width, size_t height,
+                            const ColourSpace& colour) override
+            {
+                return packed422(src, width * 2, true, dst, type, width, height, colour);
+            }
+
+            bool RGBtoRGBA(const uint8_t* src, void* dst, PixelType type, size_t width, size_t height) override
+            {
+                return rgb(src, width * 3, false, dst, type, width, height);
+            }
+
+            bool BayerGR8toRGBA(const uint8_t* src, void* dst, PixelType type, size_t width, size_t height) override
+            {
+                return bayer(src, width, dst, type, width, height);
+            }
+
+            // reads the rows where they are, no repacking of padded frames
+            bool ConvertFrame(const FrameDescriptor& frame, const void* src, void* dst, PixelType type) override
+            {
+                if(!src || frame.planeCount == 0) {
+                    return false;
+                }
+
+                const uint8_t* data = FramePlaneData(frame, src, 0);
+                const size_t stride = frame.planes[0].stride;
+
+                switch(frame.fourcc) {
+                case FOURCC_NV12:
+                    return frame.planeCount == 2 &&
+                           nv12(data, stride, FramePlaneData(frame, src, 1), frame.planes[1].stride,
+                                dst, type, frame.width, frame.height, frame.colour);
+                case FOURCC_UYVY:
+                case FOURCC_YUYV:
+                    return packed422(data, stride, frame.fourcc == FOURCC_UYVY, dst, type, frame.width, frame.height, frame.colour);
+                case FOURCC_RGB24:
+                case FOURCC_BGR24:
+                    return rgb(data, stride, frame.fourcc == FOURCC_BGR24, dst, type, frame.width, frame.height);
+                case FOURCC_GRBG8:
+                    return bayer(data, stride, dst, type, frame.width, frame.height);
+                default:
+                    return ConvertBackend::ConvertFrame(frame, src, dst, type);
+                }
+            }
+
+            bool RGBA8toRGBAf(const uint8_t* src, float* dst, size_t width, size_t height) override
+            {
+                if(!src || !dst || width == 0 || height == 0) {
+                    return false;
+                }
+
+                const size_t count = width * height * 4;
+                size_t i = 0;
+
+#if defined(__SSE2__)
+                const __m128i zero = _mm_setzero_si128();
+
+                for(; i + 16 <= count; i += 16) {
+                    const __m128i v  = _mm_loadu_si128((const __m128i*)(src + i));
+                    const __m128i lo = _mm_unpacklo_epi8(v, zero);
+                    const __m128i hi = _mm_unpackhi_epi8(v, zero);
+
+                    _mm_storeu_ps(dst + i,      _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)));
+                    _mm_storeu_ps(dst + i + 4,  _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)));
+                    _mm_storeu_ps(dst + i + 8,  _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)));
+                    _mm_storeu_ps(dst + i + 12, _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)));
+                }
+#endif
+                for(; i < count; i++) {
+                    dst[i] = src[i];
+                }
+                return true;
+            }
+
+        private:
+            bool nv12(const uint8_t* luma, size_t lumaStride, const uint8_t* chroma, size_t chromaStride,
+                      void* dst, PixelType type, size_t width, size_t height, const ColourSpace& colour)
+            {
+                if(!luma || !chroma || !dst || width < 2 || height < 2 || (width & 1) || (height & 1)) {
+                    return false;
+                }
+
+                const size_t chromaRows = height >> 1;
+                std::vector<uint8_t> interp(width);
+                const YuvToRgbCoeffs& k = GetYuvToRgbCoeffs(colour);
+
+                convertRows8(dst, type, width, height, 1.0f, [&](size_t y, uint8_t* out) {
+                    const size_t yc = y >> 1;
+                    const uint8_t* c = chroma + yc * chromaStride;
+
+                    // odd rows average with the next chroma row, (a + b + 1) >> 1
+                    if((y & 1) && yc < chromaRows - 1) {
+                        size_t i = 0;
+#if defined(__SSE2__)
+                        for(; i + 16 <= width; i += 16) {
+                            const __m128i a = _mm_loadu_si128((const __m128i*)(c + i));
+                            const __m128i b = _mm_loadu_si128((const __m128i*)(c + chromaStride + i));
+                            _mm_storeu_si128((__m128i*)(interp.data() + i), _mm_avg_epu8(a, b));
+                        }
+#endif
+                        for(; i < width; i++) {
+                            interp[i] = (uint8_t)((c[i] + c[chromaStride + i] + 1) >> 1);
+                        }
+                        c = interp.data();
+                    }
+
+                    nv12Row(luma + y * lumaStride, c, out, width, k);
+                });
+                return true;
+            }
+
+            bool packed422(const uint8_t* src, size_t stride, bool uyvy, void* dst, PixelType type,
+                           size_t width, size_t height, const ColourSpace& colour)
+            {
+                if(!src || !dst || width < 2 || height == 0 || (width & 1)) {
+                    return false;
+                }
+
+                const YuvToRgbCoeffs& k = GetYuvToRgbCoeffs(colour);
+
+                convertRows8(dst, type, width, height, 1.0f, [&](size_t y, uint8_t* out) {
+                    if(uyvy) {
+                        uyvyRow(src + y * stride, out, width, k);
+                    } else {
+                        yuyvRow(src + y * stride, out, width, k);
+                    }
+                });
+                return true;
+            }
+
+            bool rgb(const uint8_t* src, size_t stride, bool bgr, void* dst, PixelType type, size_t width, size_t height)
+            {
+                if(!src || !dst || width == 0 || height == 0) {
+                    return false;
+                }
+
+                // the last row may end right at the buffer end
+                const size_t total = (height - 1) * stride + width * 3;
+
+                convertRows(dst, type, width, height, [&](size_t y, float* out) {
+                    const size_t offset = y * stride;
+                    rgbRow(src + offset, out, width, total - offset, bgr);
+                });
+                return true;
+            }
+
+            bool bayer(const uint8_t* src, size_t stride, void* dst, PixelType type, size_t width, size_t height)
+            {
+                if(!src || !dst || width < 2 || height == 0) {
+                    return false;
+                }
+
+                convertRows(dst, type, width, height, [&](size_t y, float* out) {
+                    bayerRow(src, stride, out, width, height, y);
+                });
+                return true;
+            }
+        };
+    }
+
+    ConvertBackend* GetCpuConvertBackend()
+    {
+        static CpuConvertBackend backend;
+        return &backend;
+    }
+
+} // image
+} // mtsai
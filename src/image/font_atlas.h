@@ -0,0 +1,1644 @@
+/*
+ * 8x16 glyph coverage atlas for printable ASCII (0x20 - 0x7E)
+ *
+ * Rasterised from DejaVu Sans Mono (Bitstream Vera derived, free licence)
+ * with 16x16 supersampling, one byte of coverage per pixel, baseline at
+ * row 12. Glyph c starts at kFontAtlas[(c - kFontFirst) * kGlyphWidth * kGlyphHeight].
+ */
+#ifndef MTSAI_IMAGE_FONT_ATLAS_H
+#define MTSAI_IMAGE_FONT_ATLAS_H
+
+#include <stdint.h>
+
+namespace mtsai
+{
+namespace image
+{
+    const int kGlyphWidth  = 8;
+    const int kGlyphHeight = 16;
+    const int kFontFirst   = 0x20;
+    const int kFontLast    = 0x7E;
+
+    const uint8_t kFontAtlas[(kFontLast - kFontFirst + 1) * kGlyphWidth * kGlyphHeight] =
+    {
+        // 0x20 ' '
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x21 '!'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x1E, 0x21, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0xA2, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x90, 0x93, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x32, 0x35, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x14, 0x16, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x50, 0x58, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x22 '"'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x27, 0x0F, 0x0F, 0x27, 0x00, 0x00,
+        0x00, 0x00, 0xCF, 0x50, 0x50, 0xCF, 0x00, 0x00,
+        0x00, 0x00, 0xCF, 0x50, 0x50, 0xCF, 0x00, 0x00,
+        0x00, 0x00, 0xCF, 0x50, 0x50, 0xCF, 0x00, 0x00,
+        0x00, 0x00, 0x5B, 0x23, 0x23, 0x5B, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x23 '#'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0A, 0x07, 0x00, 0x0F, 0x01,
+        0x00, 0x00, 0x00, 0xBB, 0x4C, 0x1B, 0xED, 0x02,
+        0x00, 0x00, 0x06, 0xF2, 0x0F, 0x5C, 0xAF, 0x00,
+        0x18, 0x60, 0x7E, 0xE6, 0x60, 0xB9, 0xAD, 0x60,
+        0x28, 0x9F, 0xD5, 0xCD, 0x9F, 0xF7, 0xA9, 0x9F,
+        0x00, 0x00, 0xBB, 0x50, 0x18, 0xED, 0x02, 0x00,
+        0x30, 0x32, 0xF5, 0x42, 0x73, 0xC3, 0x30, 0x0C,
+        0xCF, 0xDF, 0xF0, 0xCF, 0xF0, 0xDF, 0xCF, 0x34,
+        0x00, 0x7C, 0x8B, 0x00, 0xDB, 0x30, 0x00, 0x00,
+        0x00, 0xBB, 0x4C, 0x1C, 0xEA, 0x02, 0x00, 0x00,
+        0x00, 0x76, 0x0E, 0x26, 0x5E, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x24 '$'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x1E, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x35, 0x86, 0x00, 0x00, 0x00,
+        0x00, 0x1A, 0xB9, 0xE8, 0xEE, 0xE9, 0x79, 0x00,
+        0x00, 0xA2, 0xA0, 0x31, 0x80, 0x0C, 0x32, 0x00,
+        0x00, 0xBB, 0x7D, 0x30, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x59, 0xF4, 0xAB, 0xA8, 0x1E, 0x00, 0x00,
+        0x00, 0x00, 0x34, 0x9B, 0xE3, 0xF6, 0x83, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0x80, 0x2E, 0xFF, 0x23,
+        0x00, 0x0E, 0x00, 0x30, 0x80, 0x10, 0xFF, 0x2E,
+        0x00, 0xB7, 0xAA, 0x8F, 0xBB, 0xC4, 0xAD, 0x00,
+        0x00, 0x0C, 0x4F, 0x90, 0xBB, 0x4B, 0x02, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x15, 0x38, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x25 '%'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x11, 0x9F, 0xC3, 0x5B, 0x00, 0x00, 0x00, 0x00,
+        0x9C, 0x78, 0x28, 0xCC, 0x30, 0x00, 0x00, 0x00,
+        0xBF, 0x25, 0x00, 0x8F, 0x57, 0x00, 0x00, 0x00,
+        0x61, 0xCB, 0x92, 0xD5, 0x10, 0x22, 0x85, 0x54,
+        0x00, 0x31, 0x5A, 0x63, 0xAC, 0x97, 0x33, 0x00,
+        0x18, 0x82, 0xB3, 0x66, 0x4C, 0x9B, 0x76, 0x06,
+        0x24, 0x33, 0x00, 0x26, 0xD6, 0x49, 0x99, 0x85,
+        0x00, 0x00, 0x00, 0x58, 0x8B, 0x00, 0x25, 0xC2,
+        0x00, 0x00, 0x00, 0x1C, 0xDC, 0x6D, 0xB5, 0x77,
+        0x00, 0x00, 0x00, 0x00, 0x27, 0x7A, 0x52, 0x01,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x26 '&'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x13, 0x54, 0x53, 0x1C, 0x00, 0x00,
+        0x00, 0x20, 0xE9, 0xBB, 0xAE, 0xA3, 0x00, 0x00,
+        0x00, 0x6D, 0xBC, 0x00, 0x00, 0x04, 0x00, 0x00,
+        0x00, 0x58, 0xDA, 0x03, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x15, 0xF7, 0x79, 0x00, 0x00, 0x00, 0x00,
+        0x08, 0xCD, 0x93, 0xF2, 0x39, 0x00, 0x1C, 0x5B,
+        0x6A, 0xB9, 0x00, 0x68, 0xE1, 0x12, 0x42, 0xBF,
+        0x9D, 0x85, 0x00, 0x00, 0xAB, 0xB1, 0x69, 0x93,
+        0x7F, 0xC7, 0x02, 0x00, 0x0F, 0xDE, 0xEF, 0x2F,
+        0x16, 0xE3, 0xB4, 0x58, 0x70, 0xE0, 0xF3, 0x34,
+        0x00, 0x16, 0x82, 0xAD, 0x91, 0x2F, 0x52, 0x5E,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x27 '''
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x1B, 0x1B, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x28 '('
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x45, 0x53, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x09, 0xE3, 0x2C, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x68, 0xBE, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xC6, 0x6C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0D, 0xFC, 0x32, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x31, 0xFF, 0x13, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x3E, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x26, 0xFF, 0x19, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0xF2, 0x43, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xA9, 0x84, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x3F, 0xDF, 0x02, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xBC, 0x58, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x18, 0x2B, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x29 ')'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x53, 0x45, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2C, 0xE3, 0x09, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xC0, 0x68, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6D, 0xC6, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x33, 0xFC, 0x0D, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x13, 0xFF, 0x31, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0xFF, 0x3E, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x19, 0xFF, 0x27, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x44, 0xF2, 0x04, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x86, 0xAA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0xE0, 0x42, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x58, 0xBE, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2B, 0x18, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x2A '*'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x00,
+        0x00, 0x10, 0x00, 0x60, 0x60, 0x00, 0x10, 0x00,
+        0x00, 0x8C, 0x95, 0x72, 0x72, 0x95, 0x8C, 0x00,
+        0x00, 0x00, 0x33, 0xE8, 0xE8, 0x33, 0x00, 0x00,
+        0x00, 0x4A, 0xB6, 0xA6, 0xA6, 0xB6, 0x4A, 0x00,
+        0x00, 0x51, 0x0B, 0x60, 0x60, 0x0B, 0x51, 0x00,
+        0x00, 0x00, 0x00, 0x42, 0x42, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x2B '+'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x12, 0x12, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x15, 0x30, 0x30, 0xA4, 0xA4, 0x30, 0x30, 0x15,
+        0x62, 0xDF, 0xDF, 0xF1, 0xF1, 0xDF, 0xDF, 0x62,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x2C ','
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x54, 0x62, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xE7, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2A, 0xF6, 0x19, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x21, 0x44, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x2D '-'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x79, 0xAF, 0xAF, 0x79, 0x00, 0x00,
+        0x00, 0x00, 0x42, 0x60, 0x60, 0x42, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x2E '.'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x68, 0x68, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xCF, 0xCF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x68, 0x68, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x2F '/'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x2E, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xAD, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x12, 0xF3, 0x37, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x7D, 0xBE, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x09, 0xEB, 0x47, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6C, 0xCE, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0xDF, 0x58, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x5C, 0xDC, 0x04, 0x00, 0x00, 0x00,
+        0x00, 0x01, 0xD2, 0x69, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x4B, 0xE8, 0x09, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xC2, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x21, 0xBC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x30 '0'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0C, 0x51, 0x51, 0x0C, 0x00, 0x00,
+        0x00, 0x1D, 0xE1, 0xCB, 0xCC, 0xE1, 0x1D, 0x00,
+        0x00, 0xA1, 0xBC, 0x01, 0x01, 0xBC, 0xA1, 0x00,
+        0x00, 0xED, 0x61, 0x00, 0x00, 0x61, 0xED, 0x00,
+        0x17, 0xFF, 0x3A, 0x1A, 0x1A, 0x3A, 0xFF, 0x16,
+        0x20, 0xFF, 0x30, 0xCF, 0xCE, 0x30, 0xFF, 0x20,
+        0x1C, 0xFF, 0x34, 0x4B, 0x48, 0x34, 0xFF, 0x1C,
+        0x05, 0xFA, 0x50, 0x00, 0x00, 0x50, 0xFA, 0x05,
+        0x00, 0xC0, 0x94, 0x00, 0x00, 0x94, 0xC0, 0x00,
+        0x00, 0x46, 0xF6, 0x7B, 0x7C, 0xF6, 0x45, 0x00,
+        0x00, 0x00, 0x43, 0xA2, 0xA2, 0x42, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x31 '1'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x1F, 0x30, 0x03, 0x00, 0x00,
+        0x00, 0x49, 0xE7, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x2A, 0x49, 0x41, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x28, 0x9F, 0xB1, 0xFF, 0xA5, 0x9F, 0x14,
+        0x00, 0x20, 0x80, 0x80, 0x80, 0x80, 0x80, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x32 '2'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x03, 0x3A, 0x5C, 0x45, 0x07, 0x00, 0x00,
+        0x00, 0xD9, 0xEC, 0xC2, 0xE3, 0xDD, 0x22, 0x00,
+        0x00, 0x54, 0x05, 0x00, 0x07, 0xCB, 0xA7, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xCB, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xCA, 0x8C, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x71, 0xE4, 0x13, 0x00,
+        0x00, 0x00, 0x00, 0x51, 0xED, 0x31, 0x00, 0x00,
+        0x00, 0x00, 0x42, 0xEE, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x37, 0xEC, 0x4C, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xEE, 0xD9, 0x9F, 0x9F, 0x9F, 0x8B, 0x00,
+        0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x70, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x33 '3'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0C, 0x3D, 0x5C, 0x47, 0x08, 0x00, 0x00,
+        0x00, 0xCE, 0xDF, 0xBF, 0xDF, 0xE2, 0x28, 0x00,
+        0x00, 0x18, 0x00, 0x00, 0x03, 0xBF, 0xA7, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xBB, 0x00,
+        0x00, 0x00, 0x15, 0x36, 0x62, 0xED, 0x58, 0x00,
+        0x00, 0x00, 0x62, 0xDF, 0xF7, 0xA7, 0x0A, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x10, 0xBC, 0xA6, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xF8, 0x00,
+        0x02, 0x00, 0x00, 0x00, 0x00, 0x79, 0xEB, 0x00,
+        0x20, 0xD1, 0x85, 0x70, 0x95, 0xF9, 0x77, 0x00,
+        0x07, 0x63, 0x98, 0xAF, 0x9A, 0x4B, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x34 '4'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x18, 0x30, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0xD9, 0xFF, 0x10, 0x00,
+        0x00, 0x00, 0x00, 0x82, 0xB8, 0xFF, 0x10, 0x00,
+        0x00, 0x00, 0x2C, 0xD5, 0x47, 0xFF, 0x10, 0x00,
+        0x00, 0x02, 0xC5, 0x48, 0x40, 0xFF, 0x10, 0x00,
+        0x00, 0x6B, 0xAD, 0x00, 0x40, 0xFF, 0x10, 0x00,
+        0x1B, 0xE8, 0x1F, 0x00, 0x40, 0xFF, 0x10, 0x00,
+        0x50, 0xF7, 0xDF, 0xDF, 0xE7, 0xFF, 0xE1, 0x54,
+        0x0F, 0x30, 0x30, 0x30, 0x64, 0xFF, 0x3D, 0x12,
+        0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x10, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0x08, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x35 '5'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x21, 0x30, 0x30, 0x30, 0x30, 0x0C, 0x00,
+        0x00, 0xAF, 0xF8, 0xEF, 0xEF, 0xEF, 0x3C, 0x00,
+        0x00, 0xAF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xAF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xAF, 0xE7, 0xDE, 0xCE, 0x6B, 0x01, 0x00,
+        0x00, 0x5E, 0x49, 0x35, 0x75, 0xF9, 0x6F, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xD4, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xED, 0x00,
+        0x01, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xC4, 0x00,
+        0x10, 0xCC, 0x80, 0x71, 0xA7, 0xF9, 0x45, 0x00,
+        0x05, 0x74, 0xA2, 0xAF, 0x91, 0x30, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x36 '6'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x38, 0x5D, 0x40, 0x07, 0x00,
+        0x00, 0x0A, 0xBB, 0xF0, 0xC1, 0xDD, 0x70, 0x00,
+        0x00, 0x84, 0xD2, 0x12, 0x00, 0x00, 0x0E, 0x00,
+        0x00, 0xE3, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x12, 0xFF, 0x5B, 0xC8, 0xDD, 0xA3, 0x15, 0x00,
+        0x20, 0xFF, 0xD3, 0x3D, 0x2E, 0xC3, 0xB7, 0x00,
+        0x1D, 0xFF, 0x6C, 0x00, 0x00, 0x43, 0xFE, 0x10,
+        0x06, 0xFB, 0x50, 0x00, 0x00, 0x2D, 0xFF, 0x20,
+        0x00, 0xC6, 0x7F, 0x00, 0x00, 0x52, 0xF8, 0x08,
+        0x00, 0x50, 0xF4, 0x76, 0x66, 0xE0, 0x91, 0x00,
+        0x00, 0x00, 0x46, 0xA1, 0xA9, 0x67, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x37 '7'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x06, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00,
+        0x1E, 0xEF, 0xEF, 0xEF, 0xEF, 0xF7, 0xEC, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x91, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x19, 0xFB, 0x32, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x7A, 0xCF, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0xDC, 0x6F, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x43, 0xF9, 0x14, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xA6, 0xAC, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x14, 0xF8, 0x4C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x70, 0xE6, 0x03, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x5E, 0x51, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x38 '8'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x19, 0x55, 0x54, 0x19, 0x00, 0x00,
+        0x00, 0x4E, 0xF6, 0xB9, 0xB9, 0xF5, 0x4E, 0x00,
+        0x00, 0xD4, 0x8C, 0x00, 0x00, 0x8A, 0xD4, 0x00,
+        0x00, 0xE2, 0x68, 0x00, 0x00, 0x68, 0xE2, 0x00,
+        0x00, 0x76, 0xCE, 0x34, 0x34, 0xCE, 0x76, 0x00,
+        0x00, 0x13, 0xBE, 0xF2, 0xF3, 0xBE, 0x13, 0x00,
+        0x00, 0xC8, 0x98, 0x04, 0x04, 0x9A, 0xC8, 0x00,
+        0x1C, 0xFF, 0x34, 0x00, 0x00, 0x34, 0xFF, 0x1C,
+        0x16, 0xFF, 0x4B, 0x00, 0x00, 0x49, 0xFF, 0x16,
+        0x00, 0xAD, 0xDF, 0x67, 0x67, 0xDE, 0xAC, 0x00,
+        0x00, 0x06, 0x6C, 0xA8, 0xA7, 0x6A, 0x06, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x39 '9'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x1E, 0x58, 0x4C, 0x0A, 0x00, 0x00,
+        0x00, 0x5D, 0xF7, 0xB9, 0xCC, 0xDF, 0x1E, 0x00,
+        0x04, 0xEE, 0x6E, 0x00, 0x01, 0xB1, 0x9F, 0x00,
+        0x28, 0xFF, 0x25, 0x00, 0x00, 0x62, 0xE8, 0x00,
+        0x24, 0xFF, 0x29, 0x00, 0x00, 0x68, 0xFF, 0x0B,
+        0x02, 0xE5, 0x81, 0x00, 0x07, 0xC2, 0xFF, 0x16,
+        0x00, 0x48, 0xEF, 0xD9, 0xE5, 0x92, 0xFF, 0x0E,
+        0x00, 0x00, 0x0B, 0x38, 0x1B, 0x4A, 0xEC, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0xA1, 0x00,
+        0x00, 0x65, 0x87, 0x71, 0xB5, 0xEA, 0x21, 0x00,
+        0x00, 0x31, 0x95, 0xAE, 0x87, 0x1D, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x3A ':'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x4E, 0x4E, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xCF, 0xCF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x75, 0x75, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x68, 0x68, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xCF, 0xCF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x68, 0x68, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x3B ';'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x4E, 0x4E, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xCF, 0xCF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x75, 0x75, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x54, 0x62, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0xDF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xE7, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2A, 0xF6, 0x19, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x21, 0x44, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x3C '<'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x8C, 0x5E,
+        0x00, 0x00, 0x08, 0x5D, 0xC2, 0xF1, 0x9D, 0x27,
+        0x20, 0x92, 0xEC, 0xBD, 0x5E, 0x0B, 0x00, 0x00,
+        0x6B, 0xFE, 0x8F, 0x17, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x3D, 0xA2, 0xF2, 0xB1, 0x52, 0x06, 0x00,
+        0x00, 0x00, 0x00, 0x10, 0x6D, 0xD2, 0xEC, 0x4D,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x38,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x3D '='
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x3F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x3F,
+        0x3F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x3F,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x62, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x62,
+        0x15, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x15,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x3E '>'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x5E, 0x8C, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x27, 0x9D, 0xF1, 0xC2, 0x5D, 0x08, 0x00, 0x00,
+        0x00, 0x00, 0x0B, 0x5E, 0xBD, 0xEC, 0x92, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x17, 0x8F, 0xFE, 0x6B,
+        0x00, 0x06, 0x52, 0xB1, 0xF2, 0xA2, 0x3D, 0x00,
+        0x4D, 0xEC, 0xD2, 0x6D, 0x10, 0x00, 0x00, 0x00,
+        0x38, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x3F '?'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x16, 0x51, 0x57, 0x19, 0x00, 0x00,
+        0x00, 0x52, 0xF2, 0xBE, 0xCE, 0xF5, 0x41, 0x00,
+        0x00, 0x33, 0x19, 0x00, 0x00, 0xB2, 0xB1, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xA4, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x87, 0xEA, 0x21, 0x00,
+        0x00, 0x00, 0x00, 0x64, 0xE8, 0x28, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xC3, 0x7B, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xB5, 0x62, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x1A, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xCF, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x68, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x40 '@'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0x67, 0x8B, 0x71, 0x13, 0x00,
+        0x00, 0x38, 0xE3, 0x91, 0x62, 0x8F, 0xDE, 0x15,
+        0x10, 0xE3, 0x39, 0x00, 0x00, 0x00, 0x8C, 0x7B,
+        0x71, 0x97, 0x00, 0x36, 0xBB, 0xC2, 0x93, 0x9F,
+        0xB1, 0x4A, 0x0E, 0xE8, 0x57, 0x2D, 0xC6, 0x9F,
+        0xCD, 0x28, 0x49, 0xBC, 0x00, 0x00, 0x52, 0x9F,
+        0xCC, 0x29, 0x47, 0xBF, 0x00, 0x00, 0x55, 0x9F,
+        0xAC, 0x51, 0x0B, 0xE4, 0x67, 0x3D, 0xD1, 0x9F,
+        0x65, 0xA9, 0x00, 0x2A, 0xA9, 0xB2, 0x67, 0x64,
+        0x08, 0xD7, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x24, 0xD2, 0xAD, 0x68, 0x65, 0x56, 0x00,
+        0x00, 0x00, 0x04, 0x50, 0x85, 0x8B, 0x4B, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x41 'A'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x27, 0x27, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0xF6, 0xF6, 0x0A, 0x00, 0x00,
+        0x00, 0x00, 0x50, 0xD8, 0xDA, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x9D, 0x91, 0x92, 0x9D, 0x00, 0x00,
+        0x00, 0x02, 0xE9, 0x4B, 0x4D, 0xE9, 0x02, 0x00,
+        0x00, 0x3B, 0xF7, 0x0A, 0x0B, 0xF8, 0x3B, 0x00,
+        0x00, 0x88, 0xC1, 0x10, 0x10, 0xC3, 0x88, 0x00,
+        0x00, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x00,
+        0x26, 0xFF, 0x27, 0x00, 0x00, 0x29, 0xFF, 0x26,
+        0x74, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x74,
+        0x57, 0x56, 0x00, 0x00, 0x00, 0x00, 0x56, 0x57,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x42 'B'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x2D, 0x30, 0x30, 0x29, 0x04, 0x00, 0x00,
+        0x00, 0xEF, 0xEB, 0xDF, 0xEE, 0xEA, 0x4A, 0x00,
+        0x00, 0xEF, 0x60, 0x00, 0x01, 0x86, 0xE8, 0x00,
+        0x00, 0xEF, 0x60, 0x00, 0x00, 0x53, 0xFE, 0x07,
+        0x00, 0xEF, 0x7E, 0x30, 0x3F, 0xC3, 0xB1, 0x00,
+        0x00, 0xEF, 0xEB, 0xDF, 0xEA, 0xE5, 0x39, 0x00,
+        0x00, 0xEF, 0x60, 0x00, 0x00, 0x5B, 0xF3, 0x18,
+        0x00, 0xEF, 0x60, 0x00, 0x00, 0x00, 0xF4, 0x59,
+        0x00, 0xEF, 0x60, 0x00, 0x00, 0x1C, 0xFD, 0x4C,
+        0x00, 0xEF, 0xB9, 0x8F, 0x9C, 0xE3, 0xC5, 0x06,
+        0x00, 0x78, 0x80, 0x80, 0x7A, 0x4E, 0x04, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x43 'C'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x26, 0x59, 0x4F, 0x12, 0x00,
+        0x00, 0x01, 0x94, 0xF5, 0xBA, 0xCA, 0xE8, 0x00,
+        0x00, 0x65, 0xF0, 0x25, 0x00, 0x00, 0x2F, 0x00,
+        0x00, 0xD0, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x08, 0xFD, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x15, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0D, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xE6, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x92, 0xD3, 0x06, 0x00, 0x00, 0x04, 0x00,
+        0x00, 0x14, 0xDB, 0xC3, 0x69, 0x77, 0xC7, 0x00,
+        0x00, 0x00, 0x10, 0x7A, 0xAA, 0xA1, 0x59, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x44 'D'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x06, 0x30, 0x30, 0x28, 0x05, 0x00, 0x00, 0x00,
+        0x20, 0xFF, 0xE5, 0xEF, 0xF1, 0x84, 0x03, 0x00,
+        0x20, 0xFF, 0x30, 0x00, 0x3D, 0xEA, 0x78, 0x00,
+        0x20, 0xFF, 0x30, 0x00, 0x00, 0x7A, 0xE4, 0x00,
+        0x20, 0xFF, 0x30, 0x00, 0x00, 0x46, 0xFF, 0x1A,
+        0x20, 0xFF, 0x30, 0x00, 0x00, 0x32, 0xFF, 0x30,
+        0x20, 0xFF, 0x30, 0x00, 0x00, 0x3E, 0xFF, 0x24,
+        0x20, 0xFF, 0x30, 0x00, 0x00, 0x64, 0xF5, 0x05,
+        0x20, 0xFF, 0x30, 0x00, 0x09, 0xC9, 0xA3, 0x00,
+        0x20, 0xFF, 0xA4, 0x9F, 0xE3, 0xD1, 0x18, 0x00,
+        0x10, 0x80, 0x80, 0x78, 0x47, 0x04, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x45 'E'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x24, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00,
+        0x00, 0xBF, 0xF8, 0xEF, 0xEF, 0xEF, 0xEF, 0x00,
+        0x00, 0xBF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0xA4, 0x30, 0x30, 0x30, 0x27, 0x00,
+        0x00, 0xBF, 0xF1, 0xDF, 0xDF, 0xDF, 0xB5, 0x00,
+        0x00, 0xBF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0xD5, 0x9F, 0x9F, 0x9F, 0x9F, 0x14,
+        0x00, 0x60, 0x80, 0x80, 0x80, 0x80, 0x80, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x46 'F'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x09,
+        0x00, 0x80, 0xFC, 0xEF, 0xEF, 0xEF, 0xEF, 0x2D,
+        0x00, 0x80, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0xDB, 0x40, 0x40, 0x40, 0x34, 0x00,
+        0x00, 0x80, 0xF9, 0xDF, 0xDF, 0xDF, 0xB5, 0x00,
+        0x00, 0x80, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x40, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x47 'G'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x36, 0x5D, 0x3E, 0x03, 0x00,
+        0x00, 0x0F, 0xC0, 0xE9, 0xB4, 0xDB, 0xB9, 0x00,
+        0x00, 0xA3, 0xCB, 0x0C, 0x00, 0x01, 0x44, 0x00,
+        0x11, 0xFB, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x43, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x50, 0xFF, 0x0F, 0x00, 0x40, 0x80, 0x80, 0x18,
+        0x4B, 0xFF, 0x13, 0x00, 0x50, 0xA5, 0xFF, 0x30,
+        0x24, 0xFF, 0x36, 0x00, 0x00, 0x10, 0xFF, 0x30,
+        0x00, 0xCF, 0x94, 0x00, 0x00, 0x10, 0xFF, 0x30,
+        0x00, 0x38, 0xF3, 0x9D, 0x62, 0x95, 0xFB, 0x24,
+        0x00, 0x00, 0x25, 0x8B, 0xAF, 0x90, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x48 'H'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x06, 0x30, 0x09, 0x00, 0x00, 0x09, 0x30, 0x06,
+        0x20, 0xFF, 0x30, 0x00, 0x00, 0x30, 0xFF, 0x20,
+        0x20, 0xFF, 0x30, 0x00, 0x00, 0x30, 0xFF, 0x20,
+        0x20, 0xFF, 0x30, 0x00, 0x00, 0x30, 0xFF, 0x20,
+        0x20, 0xFF, 0x57, 0x30, 0x30, 0x57, 0xFF, 0x20,
+        0x20, 0xFF, 0xE5, 0xDF, 0xDF, 0xE5, 0xFF, 0x20,
+        0x20, 0xFF, 0x30, 0x00, 0x00, 0x30, 0xFF, 0x20,
+        0x20, 0xFF, 0x30, 0x00, 0x00, 0x30, 0xFF, 0x20,
+        0x20, 0xFF, 0x30, 0x00, 0x00, 0x30, 0xFF, 0x20,
+        0x20, 0xFF, 0x30, 0x00, 0x00, 0x30, 0xFF, 0x20,
+        0x10, 0x80, 0x18, 0x00, 0x00, 0x18, 0x80, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x49 'I'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x21, 0x30, 0x30, 0x30, 0x30, 0x21, 0x00,
+        0x00, 0xA4, 0xEF, 0xFA, 0xF9, 0xEF, 0xA4, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x6E, 0x9F, 0xE1, 0xDB, 0x9F, 0x6E, 0x00,
+        0x00, 0x58, 0x80, 0x80, 0x80, 0x80, 0x58, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x4A 'J'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x1B, 0x30, 0x30, 0x30, 0x09, 0x00,
+        0x00, 0x00, 0x86, 0xEF, 0xF1, 0xFF, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x30, 0x00,
+        0x19, 0x06, 0x00, 0x00, 0x3A, 0xFF, 0x1B, 0x00,
+        0x50, 0xD6, 0x79, 0x66, 0xCC, 0xC7, 0x00, 0x00,
+        0x0D, 0x67, 0xA1, 0xAC, 0x82, 0x15, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x4B 'K'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x06, 0x30, 0x09, 0x00, 0x00, 0x00, 0x27, 0x24,
+        0x20, 0xFF, 0x30, 0x00, 0x00, 0x5B, 0xF3, 0x39,
+        0x20, 0xFF, 0x30, 0x00, 0x50, 0xF4, 0x42, 0x00,
+        0x20, 0xFF, 0x30, 0x47, 0xF3, 0x4E, 0x00, 0x00,
+        0x20, 0xFF, 0x6F, 0xF5, 0x60, 0x00, 0x00, 0x00,
+        0x20, 0xFF, 0xF9, 0xE7, 0x8F, 0x00, 0x00, 0x00,
+        0x20, 0xFF, 0x72, 0x3F, 0xFC, 0x3F, 0x00, 0x00,
+        0x20, 0xFF, 0x30, 0x00, 0x95, 0xDE, 0x0C, 0x00,
+        0x20, 0xFF, 0x30, 0x00, 0x0E, 0xE1, 0x97, 0x00,
+        0x20, 0xFF, 0x30, 0x00, 0x00, 0x4A, 0xFE, 0x46,
+        0x10, 0x80, 0x18, 0x00, 0x00, 0x00, 0x65, 0x63,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x4C 'L'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0xE1, 0x9F, 0x9F, 0x9F, 0x9F, 0x3C,
+        0x00, 0x50, 0x80, 0x80, 0x80, 0x80, 0x80, 0x30,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x4D 'M'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x15, 0x30, 0x10, 0x00, 0x00, 0x11, 0x30, 0x15,
+        0x70, 0xFF, 0x8B, 0x00, 0x00, 0x90, 0xFF, 0x70,
+        0x70, 0xD1, 0xDC, 0x01, 0x02, 0xDE, 0xDE, 0x70,
+        0x70, 0xBF, 0xB3, 0x38, 0x3F, 0xB1, 0xCF, 0x70,
+        0x70, 0xBF, 0x5D, 0x8E, 0x97, 0x58, 0xCF, 0x70,
+        0x70, 0xBF, 0x0F, 0xDE, 0xE0, 0x0C, 0xCF, 0x70,
+        0x70, 0xBF, 0x00, 0xB0, 0xAC, 0x00, 0xCF, 0x70,
+        0x70, 0xBF, 0x00, 0x08, 0x08, 0x00, 0xCF, 0x70,
+        0x70, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x70,
+        0x70, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x70,
+        0x38, 0x60, 0x00, 0x00, 0x00, 0x00, 0x68, 0x38,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x4E 'N'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x06, 0x30, 0x1D, 0x00, 0x00, 0x09, 0x30, 0x06,
+        0x20, 0xFF, 0xD6, 0x01, 0x00, 0x30, 0xFF, 0x20,
+        0x20, 0xFF, 0xF5, 0x41, 0x00, 0x30, 0xFF, 0x20,
+        0x20, 0xFF, 0x9F, 0xA9, 0x00, 0x30, 0xFF, 0x20,
+        0x20, 0xFF, 0x40, 0xF0, 0x18, 0x30, 0xFF, 0x20,
+        0x20, 0xFF, 0x30, 0x9C, 0x7D, 0x30, 0xFF, 0x20,
+        0x20, 0xFF, 0x30, 0x34, 0xE1, 0x33, 0xFF, 0x20,
+        0x20, 0xFF, 0x30, 0x00, 0xCA, 0x7E, 0xFF, 0x20,
+        0x20, 0xFF, 0x30, 0x00, 0x62, 0xE2, 0xFF, 0x20,
+        0x20, 0xFF, 0x30, 0x00, 0x0A, 0xEE, 0xFF, 0x20,
+        0x10, 0x80, 0x18, 0x00, 0x00, 0x55, 0x80, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x4F 'O'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0F, 0x52, 0x52, 0x0F, 0x00, 0x00,
+        0x00, 0x2F, 0xEB, 0xCC, 0xCD, 0xEB, 0x2F, 0x00,
+        0x00, 0xBD, 0xA8, 0x00, 0x00, 0xA8, 0xBD, 0x00,
+        0x0D, 0xFC, 0x4F, 0x00, 0x00, 0x4F, 0xFC, 0x0D,
+        0x2F, 0xFF, 0x2B, 0x00, 0x00, 0x2B, 0xFF, 0x2F,
+        0x40, 0xFF, 0x20, 0x00, 0x00, 0x20, 0xFF, 0x40,
+        0x37, 0xFF, 0x25, 0x00, 0x00, 0x25, 0xFF, 0x37,
+        0x1A, 0xFF, 0x3F, 0x00, 0x00, 0x3F, 0xFF, 0x1A,
+        0x00, 0xDC, 0x7F, 0x00, 0x00, 0x7E, 0xDB, 0x00,
+        0x00, 0x61, 0xF5, 0x7A, 0x7B, 0xF5, 0x60, 0x00,
+        0x00, 0x00, 0x52, 0xA4, 0xA4, 0x4F, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x50 'P'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x24, 0x30, 0x30, 0x2B, 0x09, 0x00, 0x00,
+        0x00, 0xBF, 0xF1, 0xDF, 0xEC, 0xF5, 0x77, 0x00,
+        0x00, 0xBF, 0x8F, 0x00, 0x00, 0x6B, 0xFF, 0x2F,
+        0x00, 0xBF, 0x8F, 0x00, 0x00, 0x02, 0xFD, 0x60,
+        0x00, 0xBF, 0x8F, 0x00, 0x00, 0x22, 0xFF, 0x50,
+        0x00, 0xBF, 0xC7, 0x80, 0x85, 0xDF, 0xD5, 0x09,
+        0x00, 0xBF, 0xD5, 0x9F, 0x97, 0x6B, 0x0E, 0x00,
+        0x00, 0xBF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x60, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x51 'Q'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0F, 0x52, 0x52, 0x0F, 0x00, 0x00,
+        0x00, 0x2F, 0xEB, 0xCC, 0xCD, 0xEB, 0x2F, 0x00,
+        0x00, 0xBD, 0xA8, 0x00, 0x00, 0xA8, 0xBD, 0x00,
+        0x0D, 0xFC, 0x4F, 0x00, 0x00, 0x4F, 0xFC, 0x0D,
+        0x2F, 0xFF, 0x2B, 0x00, 0x00, 0x2B, 0xFF, 0x2F,
+        0x40, 0xFF, 0x20, 0x00, 0x00, 0x20, 0xFF, 0x40,
+        0x37, 0xFF, 0x25, 0x00, 0x00, 0x25, 0xFF, 0x37,
+        0x1A, 0xFF, 0x3F, 0x00, 0x00, 0x3F, 0xFF, 0x1C,
+        0x00, 0xDB, 0x7F, 0x00, 0x00, 0x7E, 0xDE, 0x00,
+        0x00, 0x60, 0xF5, 0x7A, 0x7B, 0xF5, 0x61, 0x00,
+        0x00, 0x00, 0x50, 0xA4, 0xDC, 0xC2, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x1C, 0xDB, 0x71, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x02, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x52 'R'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x03, 0x30, 0x30, 0x30, 0x1E, 0x00, 0x00, 0x00,
+        0x10, 0xFF, 0xE7, 0xE0, 0xFA, 0xCD, 0x23, 0x00,
+        0x10, 0xFF, 0x40, 0x00, 0x11, 0xCC, 0xB7, 0x00,
+        0x10, 0xFF, 0x40, 0x00, 0x00, 0x79, 0xEA, 0x00,
+        0x10, 0xFF, 0x40, 0x00, 0x00, 0xAA, 0xC3, 0x00,
+        0x10, 0xFF, 0xC3, 0xAF, 0xCC, 0xC5, 0x2B, 0x00,
+        0x10, 0xFF, 0x87, 0x68, 0xB7, 0xC6, 0x0A, 0x00,
+        0x10, 0xFF, 0x40, 0x00, 0x05, 0xD6, 0x7F, 0x00,
+        0x10, 0xFF, 0x40, 0x00, 0x00, 0x5A, 0xEF, 0x10,
+        0x10, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xDC, 0x80,
+        0x08, 0x80, 0x20, 0x00, 0x00, 0x00, 0x44, 0x70,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x53 'S'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x13, 0x51, 0x58, 0x2D, 0x01, 0x00,
+        0x00, 0x4C, 0xF3, 0xC8, 0xB8, 0xED, 0x88, 0x00,
+        0x03, 0xEA, 0x6D, 0x00, 0x00, 0x06, 0x2C, 0x00,
+        0x14, 0xFF, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0xE1, 0xBD, 0x3F, 0x08, 0x00, 0x00, 0x00,
+        0x00, 0x31, 0xC2, 0xFE, 0xF7, 0xAB, 0x1E, 0x00,
+        0x00, 0x00, 0x00, 0x15, 0x55, 0xCF, 0xCF, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF, 0x1A,
+        0x00, 0x14, 0x00, 0x00, 0x00, 0x3E, 0xFD, 0x10,
+        0x00, 0xEF, 0x95, 0x64, 0x77, 0xE2, 0xA3, 0x00,
+        0x00, 0x48, 0x8C, 0xAD, 0xA3, 0x64, 0x04, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x54 'T'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x21, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x21,
+        0xA4, 0xEF, 0xEF, 0xF9, 0xFA, 0xEF, 0xEF, 0xA4,
+        0x00, 0x00, 0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x50, 0x58, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x55 'U'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x03, 0x30, 0x0C, 0x00, 0x00, 0x0C, 0x30, 0x03,
+        0x10, 0xFF, 0x40, 0x00, 0x00, 0x40, 0xFF, 0x10,
+        0x10, 0xFF, 0x40, 0x00, 0x00, 0x40, 0xFF, 0x10,
+        0x10, 0xFF, 0x40, 0x00, 0x00, 0x40, 0xFF, 0x10,
+        0x10, 0xFF, 0x40, 0x00, 0x00, 0x40, 0xFF, 0x10,
+        0x10, 0xFF, 0x40, 0x00, 0x00, 0x40, 0xFF, 0x10,
+        0x10, 0xFF, 0x40, 0x00, 0x00, 0x40, 0xFF, 0x10,
+        0x08, 0xFF, 0x40, 0x00, 0x00, 0x40, 0xFF, 0x06,
+        0x00, 0xEE, 0x5D, 0x00, 0x00, 0x5D, 0xEE, 0x00,
+        0x00, 0x8D, 0xE4, 0x70, 0x70, 0xE4, 0x8C, 0x00,
+        0x00, 0x02, 0x61, 0xA6, 0xA6, 0x61, 0x02, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x56 'V'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x1D, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x1D,
+        0x6E, 0xE7, 0x01, 0x00, 0x00, 0x01, 0xE7, 0x6E,
+        0x22, 0xFF, 0x2C, 0x00, 0x00, 0x2C, 0xFF, 0x22,
+        0x00, 0xD7, 0x70, 0x00, 0x00, 0x70, 0xD7, 0x00,
+        0x00, 0x8C, 0xB3, 0x00, 0x00, 0xB3, 0x8C, 0x00,
+        0x00, 0x42, 0xF2, 0x04, 0x04, 0xF3, 0x42, 0x00,
+        0x00, 0x05, 0xF1, 0x3B, 0x3C, 0xF1, 0x05, 0x00,
+        0x00, 0x00, 0xAB, 0x7F, 0x80, 0xAB, 0x00, 0x00,
+        0x00, 0x00, 0x61, 0xC1, 0xC3, 0x61, 0x00, 0x00,
+        0x00, 0x00, 0x18, 0xF7, 0xF8, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0x6F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x57 'W'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x30, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x30,
+        0xE4, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xE4,
+        0xBE, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xBE,
+        0x99, 0x97, 0x00, 0x60, 0x5E, 0x00, 0x97, 0x99,
+        0x73, 0xB6, 0x00, 0xE5, 0xE3, 0x00, 0xB6, 0x73,
+        0x4D, 0xD4, 0x1F, 0xD2, 0xD4, 0x1C, 0xD4, 0x4D,
+        0x26, 0xF2, 0x55, 0x98, 0x99, 0x54, 0xF2, 0x26,
+        0x05, 0xFA, 0x9B, 0x5E, 0x5F, 0x9A, 0xFA, 0x05,
+        0x00, 0xDA, 0xEC, 0x25, 0x26, 0xEB, 0xDA, 0x00,
+        0x00, 0xB2, 0xE9, 0x00, 0x00, 0xE9, 0xB2, 0x00,
+        0x00, 0x4C, 0x5F, 0x00, 0x00, 0x5F, 0x4C, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x58 'X'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x13, 0x30, 0x01, 0x00, 0x00, 0x00, 0x26, 0x1D,
+        0x16, 0xEE, 0x5D, 0x00, 0x00, 0x2A, 0xF9, 0x3C,
+        0x00, 0x67, 0xE5, 0x0D, 0x00, 0xBD, 0x97, 0x00,
+        0x00, 0x02, 0xC7, 0x87, 0x55, 0xE5, 0x0F, 0x00,
+        0x00, 0x00, 0x30, 0xF4, 0xE5, 0x52, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xCE, 0xE9, 0x05, 0x00, 0x00,
+        0x00, 0x00, 0x5B, 0xEA, 0xD0, 0x75, 0x00, 0x00,
+        0x00, 0x13, 0xE9, 0x60, 0x3E, 0xF2, 0x1C, 0x00,
+        0x00, 0x9D, 0xC1, 0x01, 0x00, 0xAA, 0xAA, 0x00,
+        0x41, 0xF9, 0x2A, 0x00, 0x00, 0x21, 0xF7, 0x45,
+        0x5D, 0x57, 0x00, 0x00, 0x00, 0x00, 0x56, 0x5D,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x59 'Y'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22,
+        0x5C, 0xEF, 0x14, 0x00, 0x00, 0x15, 0xF0, 0x5C,
+        0x01, 0xC6, 0x90, 0x00, 0x00, 0x93, 0xC5, 0x01,
+        0x00, 0x36, 0xF7, 0x24, 0x26, 0xF8, 0x35, 0x00,
+        0x00, 0x00, 0x9F, 0xAB, 0xAC, 0x9C, 0x00, 0x00,
+        0x00, 0x00, 0x18, 0xF1, 0xF0, 0x17, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xB0, 0xA2, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x58, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x5A 'Z'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x2A, 0x30, 0x30, 0x30, 0x30, 0x30, 0x15,
+        0x00, 0xD1, 0xEF, 0xEF, 0xEF, 0xF1, 0xFF, 0x6D,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xE7, 0x13,
+        0x00, 0x00, 0x00, 0x00, 0x21, 0xF5, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0xBC, 0xA4, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x64, 0xE7, 0x13, 0x00, 0x00,
+        0x00, 0x00, 0x1B, 0xEF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xAF, 0xA4, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x56, 0xE7, 0x13, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xE9, 0xD1, 0x9F, 0x9F, 0x9F, 0x9F, 0x5A,
+        0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x48,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x5B '['
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0x9F, 0x78, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0x71, 0x3C, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0xBE, 0x83, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0x40, 0x30, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x5C '\\'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0E, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x11, 0xF3, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x8B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x1B, 0xF7, 0x2A, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x9C, 0x9E, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x28, 0xF7, 0x1D, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAC, 0x8D, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x36, 0xF3, 0x12, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xBD, 0x7D, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x47, 0xEB, 0x09, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x6D, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xA0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x5D ']'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x78, 0x9F, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x3C, 0x71, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x83, 0xBE, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x30, 0x40, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x5E '^'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2F, 0xF1, 0xF1, 0x2F, 0x00, 0x00,
+        0x00, 0x15, 0xDF, 0x68, 0x6A, 0xDF, 0x15, 0x00,
+        0x06, 0xC0, 0x7C, 0x00, 0x00, 0x7C, 0xC0, 0x06,
+        0x28, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x28,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x5F '_'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        // 0x60 '`'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x05, 0x20, 0x05, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x01, 0xA4, 0x8F, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0xC0, 0x51, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x11, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x61 'a'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x56, 0xC5, 0xEB, 0xE3, 0x98, 0x0F, 0x00,
+        0x00, 0x60, 0x4A, 0x16, 0x26, 0xBE, 0x99, 0x00,
+        0x00, 0x00, 0x00, 0x0D, 0x10, 0x64, 0xD7, 0x00,
+        0x00, 0x49, 0xDB, 0xE8, 0xDF, 0xE9, 0xDF, 0x00,
+        0x09, 0xF1, 0x5F, 0x00, 0x00, 0x5A, 0xDF, 0x00,
+        0x1E, 0xFF, 0x17, 0x00, 0x00, 0x9C, 0xDF, 0x00,
+        0x02, 0xDA, 0xAF, 0x54, 0x8D, 0xDE, 0xDF, 0x00,
+        0x00, 0x1F, 0x93, 0xAC, 0x73, 0x2E, 0x70, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x62 'b'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x78, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x91, 0xC0, 0xED, 0xB1, 0x15, 0x00,
+        0x00, 0xBF, 0xF2, 0x44, 0x1D, 0xB8, 0xB5, 0x00,
+        0x00, 0xBF, 0x9B, 0x00, 0x00, 0x34, 0xFE, 0x13,
+        0x00, 0xBF, 0x75, 0x00, 0x00, 0x10, 0xFF, 0x30,
+        0x00, 0xBF, 0x7A, 0x00, 0x00, 0x15, 0xFF, 0x2C,
+        0x00, 0xBF, 0xB0, 0x00, 0x00, 0x48, 0xF6, 0x09,
+        0x00, 0xBF, 0xEF, 0x84, 0x5E, 0xDC, 0x8B, 0x00,
+        0x00, 0x60, 0x41, 0x80, 0xAC, 0x70, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x63 'c'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x35, 0xBA, 0xEB, 0xE0, 0x84, 0x00,
+        0x00, 0x25, 0xF4, 0x7E, 0x1A, 0x25, 0x78, 0x00,
+        0x00, 0x8C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xB8, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xB1, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x79, 0xD8, 0x05, 0x00, 0x00, 0x01, 0x00,
+        0x00, 0x0E, 0xD8, 0xBB, 0x5B, 0x65, 0xAC, 0x00,
+        0x00, 0x00, 0x0F, 0x79, 0xAA, 0x9F, 0x4D, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x64 'd'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x78, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xBF, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xBF, 0x00,
+        0x00, 0x15, 0xAE, 0xEC, 0xC3, 0x92, 0xBF, 0x00,
+        0x00, 0xB1, 0xB9, 0x1E, 0x42, 0xF1, 0xBF, 0x00,
+        0x10, 0xFD, 0x37, 0x00, 0x00, 0x99, 0xBF, 0x00,
+        0x30, 0xFF, 0x12, 0x00, 0x00, 0x73, 0xBF, 0x00,
+        0x2B, 0xFF, 0x16, 0x00, 0x00, 0x77, 0xBF, 0x00,
+        0x08, 0xF4, 0x4C, 0x00, 0x00, 0xAF, 0xBF, 0x00,
+        0x00, 0x88, 0xDD, 0x5F, 0x82, 0xF0, 0xBF, 0x00,
+        0x00, 0x03, 0x6E, 0xAC, 0x80, 0x42, 0x60, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x65 'e'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x03, 0x80, 0xDC, 0xEA, 0xAA, 0x15, 0x00,
+        0x00, 0x8B, 0xD4, 0x33, 0x1B, 0xA0, 0xBB, 0x00,
+        0x0B, 0xF8, 0x42, 0x00, 0x00, 0x14, 0xFF, 0x1A,
+        0x2D, 0xFF, 0xC6, 0xBF, 0xBF, 0xC8, 0xFF, 0x30,
+        0x29, 0xFF, 0x31, 0x20, 0x20, 0x20, 0x20, 0x06,
+        0x04, 0xEA, 0x54, 0x00, 0x00, 0x00, 0x01, 0x00,
+        0x00, 0x5F, 0xEF, 0x7B, 0x54, 0x7C, 0xC7, 0x00,
+        0x00, 0x00, 0x3C, 0x97, 0xAF, 0x8F, 0x49, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x66 'f'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x09, 0x73, 0x99, 0x8B, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0xCD, 0x65, 0x54, 0x00,
+        0x00, 0x00, 0x00, 0xC9, 0x66, 0x00, 0x00, 0x00,
+        0x00, 0x8F, 0xBF, 0xF3, 0xD7, 0xBF, 0xA7, 0x00,
+        0x00, 0x24, 0x30, 0xD8, 0x7E, 0x30, 0x2A, 0x00,
+        0x00, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x68, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x67 'g'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x15, 0xAE, 0xED, 0xC3, 0x75, 0x8F, 0x00,
+        0x00, 0xAF, 0xBC, 0x20, 0x3F, 0xEE, 0xBF, 0x00,
+        0x10, 0xFD, 0x38, 0x00, 0x00, 0x96, 0xBF, 0x00,
+        0x30, 0xFF, 0x12, 0x00, 0x00, 0x72, 0xBF, 0x00,
+        0x2A, 0xFF, 0x1A, 0x00, 0x00, 0x79, 0xBF, 0x00,
+        0x04, 0xEE, 0x5B, 0x00, 0x00, 0xB7, 0xBF, 0x00,
+        0x00, 0x70, 0xED, 0x80, 0x9D, 0xDF, 0xBF, 0x00,
+        0x00, 0x00, 0x4B, 0x8A, 0x5D, 0x74, 0xBB, 0x00,
+        0x00, 0x09, 0x00, 0x00, 0x00, 0xAD, 0x8A, 0x00,
+        0x00, 0x60, 0xD4, 0xA1, 0xBD, 0xD8, 0x17, 0x00,
+        0x00, 0x06, 0x39, 0x5A, 0x45, 0x07, 0x00, 0x00,
+        // 0x68 'h'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x78, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x82, 0xAF, 0xED, 0xC3, 0x1D, 0x00,
+        0x00, 0xBF, 0xE6, 0x43, 0x27, 0xC9, 0x9A, 0x00,
+        0x00, 0xBF, 0x91, 0x00, 0x00, 0x6A, 0xCB, 0x00,
+        0x00, 0xBF, 0x71, 0x00, 0x00, 0x60, 0xCF, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x60, 0xCF, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x60, 0xCF, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x60, 0xCF, 0x00,
+        0x00, 0x60, 0x38, 0x00, 0x00, 0x30, 0x68, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x69 'i'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x50, 0x6E, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x78, 0xA4, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x3C, 0xBF, 0xBF, 0x83, 0x00, 0x00, 0x00,
+        0x00, 0x0F, 0x30, 0x97, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x80, 0xAF, 0x00, 0x00, 0x00,
+        0x00, 0x62, 0x70, 0xB7, 0xD2, 0x70, 0x70, 0x07,
+        0x00, 0x70, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x6A 'j'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x14, 0x9F, 0x0A, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x1E, 0xEF, 0x0F, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x24, 0xBF, 0xBF, 0xBF, 0x0C, 0x00, 0x00,
+        0x00, 0x09, 0x30, 0x4A, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x20, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x20, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x20, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x20, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x20, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x20, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x41, 0xF7, 0x05, 0x00, 0x00,
+        0x00, 0x9B, 0xBF, 0xEF, 0x84, 0x00, 0x00, 0x00,
+        0x00, 0x34, 0x40, 0x2C, 0x00, 0x00, 0x00, 0x00,
+        // 0x6B 'k'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x50, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0xBF, 0x00, 0x00, 0x64, 0xA5, 0x0F,
+        0x00, 0x80, 0xBF, 0x00, 0x69, 0xE2, 0x24, 0x00,
+        0x00, 0x80, 0xBF, 0x78, 0xDB, 0x1E, 0x00, 0x00,
+        0x00, 0x80, 0xF5, 0xF1, 0xD5, 0x0A, 0x00, 0x00,
+        0x00, 0x80, 0xDD, 0x17, 0xC9, 0x9A, 0x00, 0x00,
+        0x00, 0x80, 0xBF, 0x00, 0x24, 0xF3, 0x56, 0x00,
+        0x00, 0x80, 0xBF, 0x00, 0x00, 0x61, 0xF0, 0x21,
+        0x00, 0x40, 0x60, 0x00, 0x00, 0x00, 0x6C, 0x4E,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x6C 'l'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xA4, 0xAF, 0xAF, 0x16, 0x00, 0x00, 0x00,
+        0x00, 0x3C, 0x4C, 0xFF, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0xFF, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0xFF, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0xFF, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0xFF, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0xFF, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x10, 0xFF, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0xF9, 0x3A, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xA6, 0xD2, 0x80, 0x58, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0x65, 0x80, 0x58, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x6D 'm'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x3C, 0xAB, 0xC9, 0xD9, 0x6C, 0xE4, 0xB9, 0x04,
+        0x50, 0xF2, 0x20, 0xB9, 0xC9, 0x1B, 0xE5, 0x3C,
+        0x50, 0xD0, 0x00, 0x88, 0x97, 0x00, 0xBF, 0x58,
+        0x50, 0xCF, 0x00, 0x80, 0x8F, 0x00, 0xBF, 0x60,
+        0x50, 0xCF, 0x00, 0x80, 0x8F, 0x00, 0xBF, 0x60,
+        0x50, 0xCF, 0x00, 0x80, 0x8F, 0x00, 0xBF, 0x60,
+        0x50, 0xCF, 0x00, 0x80, 0x8F, 0x00, 0xBF, 0x60,
+        0x28, 0x68, 0x00, 0x40, 0x48, 0x00, 0x60, 0x30,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x6E 'n'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x8F, 0x67, 0xAF, 0xED, 0xC3, 0x1D, 0x00,
+        0x00, 0xBF, 0xE6, 0x43, 0x27, 0xC9, 0x9A, 0x00,
+        0x00, 0xBF, 0x91, 0x00, 0x00, 0x6A, 0xCB, 0x00,
+        0x00, 0xBF, 0x71, 0x00, 0x00, 0x60, 0xCF, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x60, 0xCF, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x60, 0xCF, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x60, 0xCF, 0x00,
+        0x00, 0x60, 0x38, 0x00, 0x00, 0x30, 0x68, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x6F 'o'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0x99, 0xE5, 0xE5, 0x97, 0x0A, 0x00,
+        0x00, 0x98, 0xCF, 0x29, 0x29, 0xCF, 0x98, 0x00,
+        0x03, 0xF3, 0x53, 0x00, 0x00, 0x53, 0xF2, 0x03,
+        0x1A, 0xFF, 0x2C, 0x00, 0x00, 0x2C, 0xFF, 0x1A,
+        0x15, 0xFF, 0x33, 0x00, 0x00, 0x33, 0xFF, 0x15,
+        0x00, 0xE5, 0x68, 0x00, 0x00, 0x68, 0xE5, 0x00,
+        0x00, 0x71, 0xEB, 0x6A, 0x6A, 0xEB, 0x71, 0x00,
+        0x00, 0x00, 0x57, 0xA5, 0xA5, 0x57, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x70 'p'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x8F, 0x76, 0xC1, 0xEC, 0xAE, 0x15, 0x00,
+        0x00, 0xBF, 0xF1, 0x42, 0x1E, 0xB9, 0xAC, 0x00,
+        0x00, 0xBF, 0x98, 0x00, 0x00, 0x38, 0xFC, 0x0D,
+        0x00, 0xBF, 0x73, 0x00, 0x00, 0x13, 0xFF, 0x2D,
+        0x00, 0xBF, 0x77, 0x00, 0x00, 0x17, 0xFF, 0x29,
+        0x00, 0xBF, 0xAE, 0x00, 0x00, 0x4E, 0xF3, 0x07,
+        0x00, 0xBF, 0xF1, 0x82, 0x5F, 0xDD, 0x87, 0x00,
+        0x00, 0xBF, 0x7A, 0x83, 0xAC, 0x6E, 0x03, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x30, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x71 'q'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0x9C, 0xE5, 0xC3, 0x72, 0xA7, 0x00,
+        0x00, 0x95, 0xCE, 0x2D, 0x3E, 0xE8, 0xDF, 0x00,
+        0x02, 0xF2, 0x53, 0x00, 0x00, 0x86, 0xDF, 0x00,
+        0x19, 0xFF, 0x2D, 0x00, 0x00, 0x61, 0xDF, 0x00,
+        0x17, 0xFF, 0x32, 0x00, 0x00, 0x64, 0xDF, 0x00,
+        0x00, 0xE8, 0x62, 0x00, 0x00, 0x96, 0xDF, 0x00,
+        0x00, 0x79, 0xE5, 0x60, 0x72, 0xEE, 0xDF, 0x00,
+        0x00, 0x01, 0x6B, 0xAD, 0x8F, 0x70, 0xDF, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xDF, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xDF, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x46, 0x00,
+        // 0x72 'r'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x78, 0x6D, 0x82, 0xE5, 0xE0, 0x50,
+        0x00, 0x00, 0x9F, 0xE6, 0x94, 0x34, 0x41, 0x48,
+        0x00, 0x00, 0x9F, 0xC9, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x9F, 0x92, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x9F, 0x8F, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x9F, 0x8F, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x9F, 0x8F, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x50, 0x48, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x73 's'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x09, 0x96, 0xE4, 0xEC, 0xC5, 0x2E, 0x00,
+        0x00, 0x75, 0xD2, 0x25, 0x14, 0x4B, 0x2E, 0x00,
+        0x00, 0x8B, 0xBB, 0x02, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x2D, 0xE5, 0xE4, 0xAA, 0x63, 0x03, 0x00,
+        0x00, 0x00, 0x07, 0x3D, 0x80, 0xF1, 0x78, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xAB, 0x00,
+        0x00, 0x87, 0x88, 0x55, 0x69, 0xEB, 0x62, 0x00,
+        0x00, 0x35, 0x89, 0xAC, 0xA1, 0x52, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x74 't'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x27, 0xCF, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00, 0x00,
+        0x18, 0xBF, 0xCB, 0xFF, 0xBF, 0xBF, 0x83, 0x00,
+        0x06, 0x30, 0x57, 0xFF, 0x30, 0x30, 0x21, 0x00,
+        0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x2D, 0xFF, 0x07, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xE7, 0xAD, 0x71, 0x4D, 0x00,
+        0x00, 0x00, 0x00, 0x1E, 0x72, 0x80, 0x58, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x75 'u'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x8F, 0x54, 0x00, 0x00, 0x48, 0x9B, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x60, 0xCF, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x60, 0xCF, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x60, 0xCF, 0x00,
+        0x00, 0xBF, 0x70, 0x00, 0x00, 0x63, 0xCF, 0x00,
+        0x00, 0xAE, 0x8B, 0x00, 0x00, 0x90, 0xCF, 0x00,
+        0x00, 0x6C, 0xED, 0x6D, 0x7C, 0xDD, 0xCF, 0x00,
+        0x00, 0x03, 0x79, 0xAC, 0x77, 0x36, 0x68, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x76 'v'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x29, 0xBB, 0x09, 0x00, 0x00, 0x09, 0xBB, 0x29,
+        0x02, 0xE4, 0x53, 0x00, 0x00, 0x53, 0xE4, 0x02,
+        0x00, 0x8A, 0xAC, 0x00, 0x00, 0xAC, 0x8A, 0x00,
+        0x00, 0x31, 0xF6, 0x0D, 0x0F, 0xF6, 0x31, 0x00,
+        0x00, 0x00, 0xD5, 0x5D, 0x5D, 0xD5, 0x00, 0x00,
+        0x00, 0x00, 0x7A, 0xB5, 0xB7, 0x7A, 0x00, 0x00,
+        0x00, 0x00, 0x21, 0xF9, 0xF9, 0x21, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6E, 0x6E, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x77 'w'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xAD, 0x32, 0x00, 0x00, 0x00, 0x00, 0x32, 0xAD,
+        0xB4, 0x75, 0x00, 0x00, 0x00, 0x00, 0x75, 0xB4,
+        0x78, 0xAA, 0x00, 0x61, 0x60, 0x00, 0xAA, 0x78,
+        0x3C, 0xE2, 0x00, 0xCB, 0xC9, 0x00, 0xE2, 0x3C,
+        0x08, 0xF8, 0x36, 0xB6, 0xB6, 0x34, 0xF8, 0x08,
+        0x00, 0xC4, 0xB2, 0x6C, 0x6D, 0xB2, 0xC4, 0x00,
+        0x00, 0x87, 0xFF, 0x22, 0x22, 0xFF, 0x87, 0x00,
+        0x00, 0x2E, 0x75, 0x00, 0x00, 0x75, 0x2E, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x78 'x'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x09, 0xAE, 0x45, 0x00, 0x00, 0x48, 0xAE, 0x09,
+        0x00, 0x51, 0xE6, 0x17, 0x19, 0xE8, 0x51, 0x00,
+        0x00, 0x00, 0x8F, 0xB9, 0xBA, 0x8F, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0xDA, 0xDA, 0x06, 0x00, 0x00,
+        0x00, 0x00, 0x43, 0xEB, 0xED, 0x43, 0x00, 0x00,
+        0x00, 0x18, 0xE7, 0x55, 0x56, 0xE7, 0x18, 0x00,
+        0x03, 0xBC, 0x99, 0x00, 0x00, 0x9A, 0xBC, 0x03,
+        0x28, 0x7D, 0x0A, 0x00, 0x00, 0x0A, 0x7D, 0x28,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x79 'y'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x22, 0xBE, 0x12, 0x00, 0x00, 0x02, 0xB0, 0x3F,
+        0x00, 0xD2, 0x6C, 0x00, 0x00, 0x42, 0xF1, 0x0B,
+        0x00, 0x70, 0xCB, 0x00, 0x00, 0xA1, 0x99, 0x00,
+        0x00, 0x12, 0xF8, 0x2E, 0x0C, 0xF3, 0x36, 0x00,
+        0x00, 0x00, 0xA5, 0x8D, 0x60, 0xD2, 0x00, 0x00,
+        0x00, 0x00, 0x42, 0xEA, 0xC3, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xDB, 0xF9, 0x14, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9D, 0xAD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x11, 0xED, 0x49, 0x00, 0x00, 0x00,
+        0x00, 0x9B, 0xE1, 0xB9, 0x01, 0x00, 0x00, 0x00,
+        0x00, 0x34, 0x38, 0x03, 0x00, 0x00, 0x00, 0x00,
+        // 0x7A 'z'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x60, 0xBF, 0xBF, 0xBF, 0xBF, 0x8F, 0x00,
+        0x00, 0x18, 0x30, 0x30, 0x35, 0xDB, 0x8F, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x92, 0xC6, 0x06, 0x00,
+        0x00, 0x00, 0x00, 0x5F, 0xE6, 0x19, 0x00, 0x00,
+        0x00, 0x00, 0x33, 0xF0, 0x39, 0x00, 0x00, 0x00,
+        0x00, 0x15, 0xE0, 0x66, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9E, 0xE6, 0x80, 0x80, 0x80, 0x60, 0x00,
+        0x00, 0x58, 0x80, 0x80, 0x80, 0x80, 0x60, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x7B '{'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x03, 0x5E, 0x8D, 0x59, 0x00,
+        0x00, 0x00, 0x00, 0x5D, 0xEC, 0x67, 0x2D, 0x00,
+        0x00, 0x00, 0x00, 0x8C, 0xAA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x91, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0C, 0xCD, 0x81, 0x00, 0x00, 0x00,
+        0x00, 0x86, 0xFA, 0xDB, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x14, 0xD3, 0x7C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x92, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x9F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8D, 0xA8, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x63, 0xE8, 0x53, 0x24, 0x00,
+        0x00, 0x00, 0x00, 0x05, 0x70, 0xA3, 0x63, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x7C '|'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x5A, 0x5A, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x5A, 0x5A, 0x00, 0x00, 0x00,
+        // 0x7D '}'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x59, 0x8D, 0x5D, 0x01, 0x00, 0x00, 0x00,
+        0x00, 0x2D, 0x67, 0xEC, 0x5A, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAA, 0x88, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x81, 0xCA, 0x0A, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x10, 0xDB, 0xFA, 0x86, 0x00,
+        0x00, 0x00, 0x00, 0x7C, 0xD0, 0x14, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0x8F, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xA8, 0x89, 0x00, 0x00, 0x00,
+        0x00, 0x24, 0x56, 0xE8, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x63, 0xA2, 0x6E, 0x03, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x7E '~'
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x03, 0x59, 0x8D, 0x67, 0x10, 0x00, 0x0C, 0x2D,
+        0x6A, 0xB9, 0x86, 0xB5, 0xF3, 0xC6, 0xEA, 0x51,
+        0x10, 0x00, 0x00, 0x00, 0x1B, 0x4B, 0x1D, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    };
+
+} // image
+} // mtsai
+
+#endif
@@ -0,0 +1,143 @@
+#include "image/frame.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+namespace mtsai
+{
+namespace image
+{
+    namespace
+    {
+        struct GstFormat
+        {
+            const char* name;
+            uint32_t fourcc;
+        };
+
+        const GstFormat kGstFormats[] = {
+            { "NV12",  FOURCC_NV12  },
+            { "UYVY",  FOURCC_UYVY  },
+            { "YUY2",  FOURCC_YUYV  },
+            { "RGB",   FOURCC_RGB24 },
+            { "BGR",   FOURCC_BGR24 },
+            { "grbg",  FOURCC_GRBG8 },
+            { "GRAY8", FOURCC_GREY  }
+        };
+    }
+
+    size_t FrameRowBytes(uint32_t fourcc, uint32_t width, uint32_t plane)
+    {
+        switch(fourcc) {
+        case FOURCC_NV12:
+            // the CbCr plane has one pair per two pixels, as wide as the luma
+            return plane < 2 ? width : 0;
+        case FOURCC_UYVY:
+        case FOURCC_YUYV:
+            return plane == 0 ? (size_t)width * 2 : 0;
+        case FOURCC_RGB24:
+        case FOURCC_BGR24:
+            return plane == 0 ? (size_t)width * 3 : 0;
+        case FOURCC_GRBG8:
+        case FOURCC_GREY:
+            return plane == 0 ? width : 0;
+        default:
+            return 0;
+        }
+    }
+
+    bool DescribeFrame(uint32_t fourcc, uint32_t width, uint32_t height, size_t stride, FrameDescriptor* frame)
+    {
+        const size_t row = FrameRowBytes(fourcc, width, 0);
+
+        if(!frame || row == 0 || height == 0 || (stride != 0 && stride < row)) {
+            return false;
+        }
+        if(stride == 0) {
+            stride = row;
+        }
+
+        frame->fourcc = fourcc;
+        frame->width = width;
+        frame->height = height;
+        frame->planes[0].offset = 0;
+        frame->planes[0].stride = stride;
+
+        if(fourcc == FOURCC_NV12) {
+            // an odd last luma row still has a chroma row of its own
+            frame->planeCount = 2;
+            frame->planes[1].offset = stride * height;
+            frame->planes[1].stride = stride;
+            frame->size = stride * height + stride * ((height + 1) / 2);
+        } else {
+            frame->planeCount = 1;
+            frame->planes[1] = FramePlane();
+            frame->size = stride * height;
+        }
+        return true;
+    }
+
+    bool IsPackedFrame(const FrameDescriptor& frame)
+    {
+        size_t offset = 0;
+
+        for(uint32_t p = 0; p < frame.planeCount; p++) {
+            const size_t row = FrameRowBytes(frame.fourcc, frame.width, p);
+            const size_t rows = (frame.fourcc == FOURCC_NV12 && p == 1) ? (frame.height + 1) / 2 : frame.height;
+
+            if(row == 0 || frame.planes[p].stride != row || frame.planes[p].offset != offset) {
+                return false;
+            }
+            offset += row * rows;
+        }
+        return frame.planeCount > 0;
+    }
+
+    uint32_t FourccFromGstFormat(const char* format)
+    {
+        if(!format) {
+            return 0;
+        }
+
+        for(const GstFormat& f : kGstFormats) {
+            if(!strcmp(format, f.name)) {
+                return f.fourcc;
+            }
+        }
+        return 0;
+    }
+
+    const char* GstFormatFromFourcc(uint32_t fourcc)
+    {
+        for(const GstFormat& f : kGstFormats) {
+            if(f.fourcc == fourcc) {
+                return f.name;
+            }
+        }
+        return nullptr;
+    }
+
+    void FourccToString(uint32_t fourcc, char str[5])
+    {
+        for(int i = 0; i < 4; i++) {
+            const char c = (char)((fourcc >> (i * 8)) & 0xFF);
+            str[i] = (c >= 32 && c < 127) ? c : '?';
+        }
+        str[4] = 0;
+    }
+
+    uint64_t FrameClockNow()
+    {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    uint32_t NewFrameSourceId()
+    {
+        static std::atomic<uint32_t> next(1);
+        return next++;
+    }
+
+} // image
+} // mtsai
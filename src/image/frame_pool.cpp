@@ -0,0 +1,189 @@
+#include "image/frame_pool.h"
+
+#include <cstring>
+#include <sys/mman.h>
+
+#include "cudaMappedMemory.h"
+
+namespace mtsai
+{
+namespace image
+{
+    namespace
+    {
+        const size_t kHugePage = 2 << 20;
+
+        size_t roundUp(size_t size, size_t align)
+        {
+            return (size + align - 1) / align * align;
+        }
+    }
+
+    const char* FrameMemoryName(FrameMemory memory)
+    {
+        switch(memory) {
+        case FRAME_MEMORY_MAPPED:   return "mapped";
+        case FRAME_MEMORY_HUGEPAGE: return "hugepage";
+        case FRAME_MEMORY_EXTERNAL: return "external";
+        default:                    return "?";
+        }
+    }
+
+    FramePool::FramePool(FrameMemory memory, uint32_t count)
+        : memory_(memory), capacity_(0), slots_(count), allocations_(0), frees_(0)
+    {
+    }
+
+    FramePool::~FramePool()
+    {
+        Release();
+    }
+
+    bool FramePool::allocBlock(Block* block, size_t size)
+    {
+        if(memory_ == FRAME_MEMORY_MAPPED) {
+            if(!cudaAllocMapped(&block->cpu, &block->cuda, size)) {
+                block->cpu = nullptr;
+                block->cuda = nullptr;
+                return false;
+            }
+            block->bytes = size;
+            allocations_++;
+            return true;
+        }
+
+        // explicit huge pages when the system reserved some, else transparent
+        // huge pages on a 2 MB rounded mapping
+        const size_t length = roundUp(size, kHugePage);
+        void* cpu = MAP_FAILED;
+#ifdef MAP_HUGETLB
+        cpu = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        block->huge = (cpu != MAP_FAILED);
+#endif
+        if(cpu == MAP_FAILED) {
+            cpu = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if(cpu == MAP_FAILED) {
+                return false;
+            }
+#ifdef MADV_HUGEPAGE
+            madvise(cpu, length, MADV_HUGEPAGE);
+#endif
+        }
+
+        // fault the pages in now rather than on the first frame
+        memset(cpu, 0, length);
+
+        block->cpu = cpu;
+        block->cuda = nullptr;
+        block->bytes = size;
+        block->mapped = length;
+        allocations_++;
+        return true;
+    }
+
+    void FramePool::freeBlock(Block* block)
+    {
+        if(block->release) {
+            block->release(block->handle);
+        }
+        else if(block->mapped) {
+            munmap(block->cpu, block->mapped);
+            frees_++;
+        }
+        else if(block->cpu) {
+            cudaFreeMapped(block->cpu);
+            frees_++;
+        }
+        *block = Block();
+    }
+
+    bool FramePool::Reserve(size_t size)
+    {
+        // still fits and does not waste more than half a slot: keep it
+        if(size > 0 && size <= capacity_ && size >= capacity_ / 2) {
+            return true;
+        }
+
+        for(Block& block : slots_) {
+            if(block.cpu) {
+                retired_.push_back(block);
+            }
+            block = Block();
+        }
+        capacity_ = 0;
+
+        if(size == 0) {
+            return false;
+        }
+        if(memory_ == FRAME_MEMORY_EXTERNAL) {
+            capacity_ = size;
+            return true;
+        }
+
+        for(Block& block : slots_) {
+            if(!allocBlock(&block, size)) {
+                for(Block& allocated : slots_) {
+                    freeBlock(&allocated);
+                }
+                return false;
+            }
+        }
+        capacity_ = size;
+        return true;
+    }
+
+    bool FramePool::Attach(uint32_t n, void* cpu, void* cuda, size_t size, void* handle, FrameReleaseFn release)
+    {
+        if(memory_ != FRAME_MEMORY_EXTERNAL || n >= slots_.size()) {
+            return false;
+        }
+
+        freeBlock(&slots_[n]);
+
+        Block& block = slots_[n];
+        block.cpu = cpu;
+        block.cuda = cuda;
+        block.bytes = size;
+        block.handle = handle;
+        block.release = release;
+        return true;
+    }
+
+    void FramePool::Recycle()
+    {
+        for(Block& block : retired_) {
+            freeBlock(&block);
+        }
+        retired_.clear();
+    }
+
+    void FramePool::Release()
+    {
+        for(Block& block : slots_) {
+            freeBlock(&block);
+        }
+        capacity_ = 0;
+        Recycle();
+    }
+
+    FramePoolStats FramePool::Stats() const
+    {
+        FramePoolStats stats;
+        stats.slotBytes = 0;
+        stats.retiredBytes = 0;
+        stats.allocations = allocations_;
+        stats.frees = frees_;
+        stats.hugePages = 0;
+
+        for(const Block& block : slots_) {
+            stats.slotBytes += block.bytes;
+            stats.hugePages += block.huge ? 1 : 0;
+        }
+        for(const Block& block : retired_) {
+            stats.retiredBytes += block.bytes;
+        }
+        return stats;
+    }
+
+} // image
+} // mtsai
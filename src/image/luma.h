@@ -0,0 +1,76 @@
+/*
+ * Luma sampling shared by the motion stages
+ */
+#ifndef MTSAI_IMAGE_LUMA_H
+#define MTSAI_IMAGE_LUMA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "image/motion_estimate.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace mtsai
+{
+namespace image
+{
+    /*
+     * 2x2 average of two luma rows into one half resolution row,
+     * (a + b + c + d + 2) / 4
+     */
+    inline void downsampleLumaRow(const uint8_t* r0, const uint8_t* r1, uint8_t* dst, size_t count, LumaLayout layout)
+    {
+        const size_t step   = (layout == LUMA_PLANAR) ? 1 : 2;
+        const size_t offset = (layout == LUMA_UYVY) ? 1 : 0;
+        size_t x = 0;
+
+#if defined(__SSE2__)
+        const __m128i lowByte = _mm_set1_epi16(0x00FF);
+        const __m128i two     = _mm_set1_epi16(2);
+
+        if(layout == LUMA_PLANAR) {
+            for(; x + 8 <= count; x += 8) {
+                const __m128i a = _mm_loadu_si128((const __m128i*)(r0 + x * 2));
+                const __m128i b = _mm_loadu_si128((const __m128i*)(r1 + x * 2));
+
+                __m128i sum = _mm_add_epi16(_mm_and_si128(a, lowByte), _mm_srli_epi16(a, 8));
+                sum = _mm_add_epi16(sum, _mm_add_epi16(_mm_and_si128(b, lowByte), _mm_srli_epi16(b, 8)));
+                sum = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+
+                _mm_storel_epi64((__m128i*)(dst + x), _mm_packus_epi16(sum, sum));
+            }
+        } else {
+            const __m128i ones = _mm_set1_epi16(1);
+            const __m128i two32 = _mm_set1_epi32(2);
+
+            // 32 bytes, 16 luma samples, 8 outputs per step
+            for(; x + 8 <= count; x += 8) {
+                __m128i sum[2];
+                for(int h = 0; h < 2; h++) {
+                    const __m128i a = _mm_loadu_si128((const __m128i*)(r0 + x * 4 + h * 16));
+                    const __m128i b = _mm_loadu_si128((const __m128i*)(r1 + x * 4 + h * 16));
+                    const __m128i ya = offset ? _mm_srli_epi16(a, 8) : _mm_and_si128(a, lowByte);
+                    const __m128i yb = offset ? _mm_srli_epi16(b, 8) : _mm_and_si128(b, lowByte);
+
+                    // horizontal pairs as 32 bit sums
+                    sum[h] = _mm_add_epi32(_mm_madd_epi16(ya, ones), _mm_madd_epi16(yb, ones));
+                    sum[h] = _mm_srli_epi32(_mm_add_epi32(sum[h], two32), 2);
+                }
+                const __m128i packed = _mm_packs_epi32(sum[0], sum[1]);
+                _mm_storel_epi64((__m128i*)(dst + x), _mm_packus_epi16(packed, packed));
+            }
+        }
+#endif
+        for(; x < count; x++) {
+            const size_t i = offset + x * 2 * step;
+            dst[x] = (uint8_t)((r0[i] + r0[i + step] + r1[i] + r1[i + step] + 2) >> 2);
+        }
+    }
+
+} // image
+} // mtsai
+
+#endif
@@ -0,0 +1,222 @@
+#include "image/motion_estimate.h"
+#include "luma.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace mtsai
+{
+namespace image
+{
+    namespace
+    {
+        // SAD cost of one half resolution pixel of displacement
+        const int kMotionCost = 16;
+
+        const int kMaxThreads = 8;
+
+#if defined(__SSE2__)
+        // 8x8 block as four registers of two rows each
+        inline void loadBlock(const uint8_t* src, size_t pitch, __m128i* rows)
+        {
+            for(int r = 0; r < 4; r++, src += pitch * 2) {
+                rows[r] = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)src),
+                                             _mm_loadl_epi64((const __m128i*)(src + pitch)));
+            }
+        }
+
+        inline int blockSad(const __m128i* block, const uint8_t* src, size_t pitch)
+        {
+            __m128i acc = _mm_setzero_si128();
+            for(int r = 0; r < 4; r++, src += pitch * 2) {
+                const __m128i v = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)src),
+                                                     _mm_loadl_epi64((const __m128i*)(src + pitch)));
+                acc = _mm_add_epi32(acc, _mm_sad_epu8(block[r], v));
+            }
+            return _mm_cvtsi128_si32(acc) + _mm_cvtsi128_si32(_mm_srli_si128(acc, 8));
+        }
+#else
+        inline int blockSad(const uint8_t* block, const uint8_t* src, size_t pitch)
+        {
+            int sad = 0;
+            for(int y = 0; y < MotionEstimator::kBlockSize; y++, block += pitch, src += pitch) {
+                for(int x = 0; x < MotionEstimator::kBlockSize; x++) {
+                    sad += abs(block[x] - src[x]);
+                }
+            }
+            return sad;
+        }
+#endif
+    }
+
+    MotionEstimator::MotionEstimator(int searchRange, int threads)
+    {
+        range_ = searchRange > 0 ? searchRange : 1;
+
+        if(threads <= 0) {
+            threads = (int)std::thread::hardware_concurrency();
+            threads = std::min(std::max(threads, 1), kMaxThreads);
+        }
+        threads_ = threads;
+        noise_ = 2;
+
+        width_ = 0;
+        height_ = 0;
+        primed_ = false;
+        moving_ = 0;
+    }
+
+    MotionEstimator::~MotionEstimator()
+    {
+    }
+
+    size_t MotionEstimator::FieldSize(size_t width, size_t height)
+    {
+        return (width / 2) * (height / 2) * 2;
+    }
+
+    void MotionEstimator::Reset()
+    {
+        primed_ = false;
+        moving_ = 0;
+    }
+
+    size_t MotionEstimator::estimateRows(const ImageView& frame, LumaLayout layout, float* field,
+                                         size_t row0, size_t row1)
+    {
+        const size_t W = width_;
+        const size_t H = height_;
+        const size_t bytesPerPixel = (layout == LUMA_PLANAR) ? 1 : 2;
+        const size_t pitch = frame.pitch ? frame.pitch : frame.width * bytesPerPixel;
+
+        // the last range also owns the rows below the whole blocks
+        const size_t y0 = row0 * kBlockSize;
+        const size_t y1 = (row1 == H / kBlockSize) ? H : row1 * kBlockSize;
+
+        for(size_t y = y0; y < y1; y++) {
+            const uint8_t* src = (const uint8_t*)frame.data + y * 2 * pitch;
+            downsampleLumaRow(src, src + pitch, cur_.data() + y * W, W, layout);
+        }
+
+        memset(field + y0 * W * 2, 0, (y1 - y0) * W * 2 * sizeof(float));
+
+        if(!primed_) {
+            return 0;
+        }
+
+        const int still = noise_ * kBlockSize * kBlockSize;
+        const int maxX = (int)(W - kBlockSize);
+        const int maxY = (int)(H - kBlockSize);
+        size_t moving = 0;
+
+        for(size_t by = row0; by < row1; by++) {
+            for(size_t bx = 0; bx < W / kBlockSize; bx++) {
+                const int x = (int)(bx * kBlockSize);
+                const int y = (int)(by * kBlockSize);
+                const uint8_t* cur = cur_.data() + y * W + x;
+
+#if defined(__SSE2__)
+                __m128i block[4];
+                loadBlock(cur, W, block);
+#else
+                const uint8_t* block = cur;
+#endif
+                const int sad0 = blockSad(block, prev_.data() + y * W + x, W);
+                if(sad0 <= still) continue;
+
+                // the content came from (x - dx, y - dy) of the previous frame
+                int best = sad0, bestX = 0, bestY = 0;
+                const int dy0 = std::max(-range_, y - maxY), dy1 = std::min(range_, y);
+                const int dx0 = std::max(-range_, x - maxX), dx1 = std::min(range_, x);
+
+                for(int dy = dy0; dy <= dy1; dy++) {
+                    const uint8_t* row = prev_.data() + (y - dy) * W;
+
+                    for(int dx = dx0; dx <= dx1; dx++) {
+                        const int penalty = kMotionCost * (abs(dx) + abs(dy));
+                        if(penalty >= best) continue;
+
+                        const int cost = blockSad(block, row + x - dx, W) + penalty;
+                        if(cost < best) {
+                            best = cost;
+                            bestX = dx;
+                            bestY = dy;
+                        }
+                    }
+                }
+
+                if(bestX == 0 && bestY == 0) continue;
+                moving++;
+
+                const float vx = (float)(bestX * 2);
+                const float vy = (float)(bestY * 2);
+                for(int r = 0; r < kBlockSize; r++) {
+                    float* v = field + ((y + r) * W + x) * 2;
+                    for(int c = 0; c < kBlockSize; c++) {
+                        v[c * 2]     = vx;
+                        v[c * 2 + 1] = vy;
+                    }
+                }
+            }
+        }
+        return moving;
+    }
+
+    bool MotionEstimator::Estimate(const ImageView& frame, LumaLayout layout, float* field)
+    {
+        if(!frame.data || !field || frame.width < 2 || frame.height < 2) {
+            return false;
+        }
+
+        const size_t W = frame.width / 2;
+        const size_t H = frame.height / 2;
+
+        if(W != width_ || H != height_) {
+            width_ = W;
+            height_ = H;
+            prev_.assign(W * H, 0);
+            cur_.assign(W * H, 0);
+            primed_ = false;
+        }
+
+        const size_t blockRows = H / kBlockSize;
+        const size_t chunks = std::max<size_t>(1, std::min<size_t>(threads_, blockRows));
+        std::vector<size_t> moving(chunks, 0);
+        std::vector<std::thread> workers;
+
+        for(size_t i = 0; i < chunks; i++) {
+            const size_t row0 = blockRows * i / chunks;
+            const size_t row1 = blockRows * (i + 1) / chunks;
+
+            // the calling thread takes the last range
+            if(i + 1 == chunks) {
+                moving[i] = estimateRows(frame, layout, field, row0, row1);
+            } else {
+                workers.emplace_back([this, &frame, layout, field, row0, row1, &moving, i]() {
+                    moving[i] = estimateRows(frame, layout, field, row0, row1);
+                });
+            }
+        }
+
+        for(std::thread& worker : workers) {
+            worker.join();
+        }
+
+        moving_ = 0;
+        for(size_t count : moving) {
+            moving_ += count;
+        }
+
+        prev_.swap(cur_);
+        primed_ = true;
+        return true;
+    }
+
+} // image
+} // mtsai
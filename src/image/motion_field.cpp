@@ -0,0 +1,201 @@
+#include "image/motion_field.h"
+
+#include <cmath>
+
+namespace mtsai
+{
+namespace image
+{
+    namespace
+    {
+        // tan(22.5 deg), sector boundary between an axis and a diagonal
+        const float kTanSector = 0.41421356f;
+
+        // sprites of cuda/cudaYUV.cu, indexed [column][row]
+        const uint8_t kArrowAxis[16][16] = {
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0 },
+            { 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0 },
+            { 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+        };
+
+        const uint8_t kArrowDiagonal[16][16] = {
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+        };
+
+        // green, amber, red
+        const uint8_t kSpeedColour[3][3] = { {0x00, 0xff, 0x00}, {0xff, 0xbe, 0x00}, {0xff, 0x00, 0x00} };
+
+        inline int speedColour(int speed)
+        {
+            return speed > 7 ? 2 : speed > 3 ? 1 : 0;
+        }
+
+        // sprite coordinate read for output pixel (px, py), the kernel's
+        // per direction flips, 16 falls outside the sprite
+        void spriteSource(int direction, int px, int py, int* mapx, int* mapy)
+        {
+            switch(direction) {
+            case MOTION_N:  *mapx = px;      *mapy = py;      break;
+            case MOTION_W:  *mapx = py;      *mapy = px;      break;
+            case MOTION_S:  *mapx = px;      *mapy = 16 - py; break;
+            case MOTION_E:  *mapx = py;      *mapy = 16 - px; break;
+            case MOTION_NW: *mapx = px;      *mapy = py;      break;
+            case MOTION_SE: *mapx = 16 - py; *mapy = 16 - px; break;
+            case MOTION_SW: *mapx = 16 - py; *mapy = px;      break;
+            case MOTION_NE: *mapx = py;      *mapy = 16 - px; break;
+            }
+        }
+    }
+
+    MotionFieldRenderer::MotionFieldRenderer()
+    {
+        // index: vx < 0, vy < 0, then 0 mostly vertical, 1 mostly horizontal, 2 diagonal
+        for(int i = 0; i < 16; i++) {
+            const bool left = (i & 8) != 0;
+            const bool up   = (i & 4) != 0;
+
+            switch(i & 3) {
+            case 0:  directionLut_[i] = up ? MOTION_N : MOTION_S; break;
+            case 1:  directionLut_[i] = left ? MOTION_W : MOTION_E; break;
+            case 2:  directionLut_[i] = up ? (left ? MOTION_NW : MOTION_NE) : (left ? MOTION_SW : MOTION_SE); break;
+            default: directionLut_[i] = MOTION_NONE; break;
+            }
+        }
+
+        for(int d = 0; d < 8; d++) {
+            const bool diagonal = (d == MOTION_NE || d == MOTION_SE || d == MOTION_SW || d == MOTION_NW);
+
+            for(int py = 0; py < kCellSize; py++) {
+                for(int px = 0; px < kCellSize; px++) {
+                    int mapx = 0, mapy = 0;
+                    spriteSource(d, px, py, &mapx, &mapy);
+
+                    if(mapx > 15 || mapy > 15) continue;
+                    if((diagonal ? kArrowDiagonal : kArrowAxis)[mapx][mapy]) {
+                        sprites_[d].push_back((uint16_t)(py * kCellSize + px));
+                    }
+                }
+            }
+        }
+    }
+
+    MotionFieldRenderer::~MotionFieldRenderer()
+    {
+    }
+
+    MotionDirection MotionFieldRenderer::Quantise(float vx, float vy) const
+    {
+        if(vx == 0.0f && vy == 0.0f) {
+            return MOTION_NONE;
+        }
+
+        const float ax = fabsf(vx);
+        const float ay = fabsf(vy);
+        const int sector = (ax < ay * kTanSector) ? 0 : (ay < ax * kTanSector) ? 1 : 2;
+
+        return directionLut_[(vx < 0.0f ? 8 : 0) | (vy < 0.0f ? 4 : 0) | sector];
+    }
+
+    size_t MotionFieldRenderer::Analyse(const float* field, size_t width, size_t height)
+    {
+        arrows_.clear();
+
+        if(!field) {
+            return 0;
+        }
+
+        // floats per field row, as cudaMotionFields
+        const size_t pitch = width / 2 * 2;
+        const size_t step  = kCellSize / 2;
+
+        for(size_t cy = 0; cy < height / kCellSize; cy++) {
+            for(size_t cx = 0; cx < width / kCellSize; cx++) {
+                const float* v = field + cy * step * pitch + cx * step * 2;
+                const float vx = v[0], vy = v[1];
+
+                if(vx == 0.0f && vy == 0.0f) continue;
+
+                const int speed = (int)((fabsf(vx) + fabsf(vy)) / 2);
+                if(speed <= 0) continue;
+
+                MotionArrow arrow;
+                arrow.x = (int32_t)(cx * kCellSize);
+                arrow.y = (int32_t)(cy * kCellSize);
+                arrow.direction = Quantise(vx, vy);
+                arrow.speed = speed;
+                arrows_.push_back(arrow);
+            }
+        }
+        return arrows_.size();
+    }
+
+    bool MotionFieldRenderer::Draw(const ImageView& image, PixelType type) const
+    {
+        if(!image.data) {
+            return false;
+        }
+
+        const size_t elem  = PixelSize(type);
+        const size_t pitch = image.pitch ? image.pitch : image.width * elem;
+
+        for(const MotionArrow& arrow : arrows_) {
+            if(arrow.direction == MOTION_NONE) continue;
+            if((size_t)arrow.x + kCellSize > image.width || (size_t)arrow.y + kCellSize > image.height) continue;
+
+            const uint8_t* rgb = kSpeedColour[speedColour(arrow.speed)];
+            uint8_t* cell = (uint8_t*)image.data + arrow.y * pitch + arrow.x * elem;
+
+            for(uint16_t offset : sprites_[arrow.direction]) {
+                uint8_t* px = cell + (offset / kCellSize) * pitch + (offset % kCellSize) * elem;
+
+                if(type == PIXEL_TYPE_RGBA8) {
+                    px[0] = rgb[0];
+                    px[1] = rgb[1];
+                    px[2] = rgb[2];
+                } else {
+                    float* f = (float*)px;
+                    f[0] = rgb[0];
+                    f[1] = rgb[1];
+                    f[2] = rgb[2];
+                }
+            }
+        }
+        return true;
+    }
+
+    bool MotionFieldRenderer::Render(const ImageView& image, PixelType type, const float* field)
+    {
+        Analyse(field, image.width, image.height);
+        return Draw(image, type);
+    }
+
+} // image
+} // mtsai
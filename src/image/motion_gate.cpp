@@ -0,0 +1,260 @@
+#include "image/motion_gate.h"
+#include "luma.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace mtsai
+{
+namespace image
+{
+    namespace
+    {
+        // pixels where |a - b| > threshold
+        uint32_t countChanged(const uint8_t* a, const uint8_t* b, size_t count, uint8_t threshold)
+        {
+            uint32_t changed = 0;
+            size_t i = 0;
+
+#if defined(__SSE2__)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i one  = _mm_set1_epi8(1);
+            const __m128i vthr = _mm_set1_epi8((char)threshold);
+            __m128i acc = zero;
+
+            for(; i + 16 <= count; i += 16) {
+                const __m128i va = _mm_loadu_si128((const __m128i*)(a + i));
+                const __m128i vb = _mm_loadu_si128((const __m128i*)(b + i));
+                const __m128i diff = _mm_or_si128(_mm_subs_epu8(va, vb), _mm_subs_epu8(vb, va));
+
+                // 1 where diff > threshold, summed by psadbw
+                const __m128i still = _mm_cmpeq_epi8(_mm_subs_epu8(diff, vthr), zero);
+                acc = _mm_add_epi64(acc, _mm_sad_epu8(_mm_andnot_si128(still, one), zero));
+            }
+            changed = (uint32_t)(_mm_cvtsi128_si32(acc) + _mm_cvtsi128_si32(_mm_srli_si128(acc, 8)));
+#endif
+            for(; i < count; i++) {
+                changed += (uint32_t)(abs(a[i] - b[i]) > threshold);
+            }
+            return changed;
+        }
+    }
+
+    MotionGate::MotionGate(const MotionGateParams& params)
+    {
+        params_ = params;
+        params_.tileSize = std::max(2, params_.tileSize / 2 * 2);
+        params_.threshold = std::min(std::max(params_.threshold, 0), 255);
+        params_.onFrames = std::max(params_.onFrames, 1);
+        params_.offFrames = std::max(params_.offFrames, 1);
+
+        width_ = 0;
+        height_ = 0;
+        halfWidth_ = 0;
+        halfHeight_ = 0;
+        tilesX_ = 0;
+        tilesY_ = 0;
+
+        skipped_ = 0;
+        processed_ = 0;
+        Reset();
+    }
+
+    MotionGate::~MotionGate()
+    {
+    }
+
+    void MotionGate::Reset()
+    {
+        primed_ = false;
+        active_ = false;
+        onCount_ = 0;
+        offCount_ = 0;
+        sinceProcess_ = 0;
+        decision_ = GATE_PROCESS;
+        activeTiles_ = 0;
+        regions_.clear();
+    }
+
+    void MotionGate::countTiles()
+    {
+        const size_t tile = params_.tileSize / 2;
+
+        std::fill(counts_.begin(), counts_.end(), 0);
+
+        for(size_t y = 0; y < halfHeight_; y++) {
+            const uint8_t* a = cur_.data() + y * halfWidth_;
+            const uint8_t* b = prev_.data() + y * halfWidth_;
+            uint32_t* counts = counts_.data() + (y / tile) * tilesX_;
+
+            for(size_t tx = 0; tx < tilesX_; tx++) {
+                const size_t x = tx * tile;
+                counts[tx] += countChanged(a + x, b + x, std::min(tile, halfWidth_ - x), (uint8_t)params_.threshold);
+            }
+        }
+
+        activeTiles_ = 0;
+
+        for(size_t ty = 0; ty < tilesY_; ty++) {
+            const size_t h = std::min(tile, halfHeight_ - ty * tile);
+
+            for(size_t tx = 0; tx < tilesX_; tx++) {
+                const size_t w = std::min(tile, halfWidth_ - tx * tile);
+                const size_t i = ty * tilesX_ + tx;
+
+                if(counts_[i] > 0 && counts_[i] >= params_.activity * (float)(w * h)) {
+                    age_[i] = 0;
+                    activeTiles_++;
+                } else if(age_[i] < 0xFFFF) {
+                    age_[i]++;
+                }
+            }
+        }
+    }
+
+    void MotionGate::buildRegions()
+    {
+        regions_.clear();
+        std::fill(labels_.begin(), labels_.end(), -1);
+
+        const int tile = params_.tileSize;
+        const int tilesX = (int)tilesX_;
+        const int tilesY = (int)tilesY_;
+        std::vector<int> stack;
+
+        for(int i = 0; i < tilesX * tilesY; i++) {
+            if(labels_[i] >= 0 || age_[i] >= params_.offFrames) continue;
+
+            // flood fill over 8-connected dirty tiles
+            int x0 = tilesX, y0 = tilesY, x1 = -1, y1 = -1;
+            labels_[i] = (int32_t)regions_.size();
+            stack.push_back(i);
+
+            while(!stack.empty()) {
+                const int t = stack.back();
+                const int tx = t % tilesX, ty = t / tilesX;
+                stack.pop_back();
+
+                x0 = std::min(x0, tx);
+                y0 = std::min(y0, ty);
+                x1 = std::max(x1, tx);
+                y1 = std::max(y1, ty);
+
+                for(int ny = std::max(ty - 1, 0); ny <= std::min(ty + 1, tilesY - 1); ny++) {
+                    for(int nx = std::max(tx - 1, 0); nx <= std::min(tx + 1, tilesX - 1); nx++) {
+                        const int n = ny * tilesX + nx;
+                        if(labels_[n] >= 0 || age_[n] >= params_.offFrames) continue;
+
+                        labels_[n] = labels_[i];
+                        stack.push_back(n);
+                    }
+                }
+            }
+
+            const int left   = std::max(x0 * tile - params_.margin, 0);
+            const int top    = std::max(y0 * tile - params_.margin, 0);
+            const int right  = std::min((x1 + 1) * tile + params_.margin, (int)width_);
+            const int bottom = std::min((y1 + 1) * tile + params_.margin, (int)height_);
+
+            Rect rect;
+            rect.x = left;
+            rect.y = top;
+            rect.width = right - left;
+            rect.height = bottom - top;
+            regions_.push_back(rect);
+        }
+    }
+
+    GateDecision MotionGate::Update(const ImageView& frame, LumaLayout layout)
+    {
+        if(!frame.data || frame.width < 2 || frame.height < 2) {
+            return decision_;
+        }
+
+        if(frame.width != width_ || frame.height != height_) {
+            const size_t tile = params_.tileSize / 2;
+
+            width_ = frame.width;
+            height_ = frame.height;
+            halfWidth_ = width_ / 2;
+            halfHeight_ = height_ / 2;
+            tilesX_ = (halfWidth_ + tile - 1) / tile;
+            tilesY_ = (halfHeight_ + tile - 1) / tile;
+
+            prev_.assign(halfWidth_ * halfHeight_, 0);
+            cur_.assign(halfWidth_ * halfHeight_, 0);
+            counts_.assign(tilesX_ * tilesY_, 0);
+            age_.assign(tilesX_ * tilesY_, 0xFFFF);
+            labels_.assign(tilesX_ * tilesY_, -1);
+            Reset();
+        }
+
+        const size_t bytesPerPixel = (layout == LUMA_PLANAR) ? 1 : 2;
+        const size_t pitch = frame.pitch ? frame.pitch : frame.width * bytesPerPixel;
+
+        for(size_t y = 0; y < halfHeight_; y++) {
+            const uint8_t* src = (const uint8_t*)frame.data + y * 2 * pitch;
+            downsampleLumaRow(src, src + pitch, cur_.data() + y * halfWidth_, halfWidth_, layout);
+        }
+
+        bool whole = false;
+
+        if(!primed_) {
+            // nothing to compare with yet, hand over the whole frame
+            std::fill(counts_.begin(), counts_.end(), 0);
+            activeTiles_ = 0;
+            primed_ = true;
+            whole = true;
+        } else {
+            countTiles();
+
+            const bool frameActive = activeTiles_ >= (size_t)std::max(params_.minTiles, 1);
+
+            if(!active_) {
+                onCount_ = frameActive ? onCount_ + 1 : 0;
+                if(onCount_ >= params_.onFrames) {
+                    active_ = true;
+                    offCount_ = 0;
+                }
+            } else {
+                offCount_ = frameActive ? 0 : offCount_ + 1;
+                if(offCount_ >= params_.offFrames) {
+                    active_ = false;
+                    onCount_ = 0;
+                }
+            }
+
+            sinceProcess_++;
+            if(!active_ && params_.refreshFrames > 0 && sinceProcess_ >= params_.refreshFrames) {
+                whole = true;
+            }
+        }
+
+        decision_ = (active_ || whole) ? GATE_PROCESS : GATE_SKIP;
+
+        if(decision_ == GATE_PROCESS) {
+            sinceProcess_ = 0;
+            processed_++;
+        } else {
+            skipped_++;
+        }
+
+        if(whole) {
+            Rect rect;
+            rect.width = (int)width_;
+            rect.height = (int)height_;
+            regions_.assign(1, rect);
+        } else {
+            buildRegions();
+        }
+
+        prev_.swap(cur_);
+        return decision_;
+    }
+
+} // image
+} // mtsai
@@ -0,0 +1,257 @@
+#include "image/overlay.h"
+
+#include <cmath>
+#include <cstdio>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace mtsai
+{
+namespace image
+{
+    namespace
+    {
+        // keeps the float -> int conversion defined for boxes far off screen
+        const float kCoordLimit = 1 << 24;
+
+        inline int32_t toPixel(float v, bool up)
+        {
+            v = v < -kCoordLimit ? -kCoordLimit : v > kCoordLimit ? kCoordLimit : v;
+            return (int32_t)(up ? ceilf(v) : floorf(v));
+        }
+
+        /*
+         * 8 bit blend, out = round((p * (255 - a) + c * a) / 255).
+         * The alpha lane gets weight 255 and no colour so it is kept as is.
+         */
+        void blendSpan8(uint8_t* px, size_t count, const PixelRGBA8& color)
+        {
+            const uint16_t a  = color.a;
+            const uint16_t ia = 255 - a;
+            const uint16_t inv[4] = { ia, ia, ia, 255 };
+            const uint16_t add[4] = { (uint16_t)(color.r * a + 128), (uint16_t)(color.g * a + 128),
+                                      (uint16_t)(color.b * a + 128), 128 };
+            size_t i = 0;
+
+#if defined(__SSE2__)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i vinv = _mm_setr_epi16(inv[0], inv[1], inv[2], inv[3], inv[0], inv[1], inv[2], inv[3]);
+            const __m128i vadd = _mm_setr_epi16(add[0], add[1], add[2], add[3], add[0], add[1], add[2], add[3]);
+
+            for(; i + 4 <= count; i += 4) {
+                uint8_t* p = px + i * 4;
+                const __m128i v = _mm_loadu_si128((const __m128i*)p);
+
+                __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), vinv), vadd);
+                __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), vinv), vadd);
+
+                // exact division by 255 for t < 65536 - 255
+                lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+                hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+
+                _mm_storeu_si128((__m128i*)p, _mm_packus_epi16(lo, hi));
+            }
+#endif
+            for(; i < count; i++) {
+                uint8_t* p = px + i * 4;
+                for(int c = 0; c < 4; c++) {
+                    const uint32_t t = p[c] * inv[c] + add[c];
+                    p[c] = (uint8_t)((t + (t >> 8)) >> 8);
+                }
+            }
+        }
+
+        // float blend, out = p * (1 - a / 255) + c * a / 255, alpha lane kept
+        void blendSpanF(float* px, size_t count, const PixelRGBA8& color)
+        {
+            const float a = color.a / 255.0f;
+            const float inv[4] = { 1.0f - a, 1.0f - a, 1.0f - a, 1.0f };
+            const float add[4] = { color.r * a, color.g * a, color.b * a, 0.0f };
+            size_t i = 0;
+
+#if defined(__SSE2__)
+            const __m128 vinv = _mm_loadu_ps(inv);
+            const __m128 vadd = _mm_loadu_ps(add);
+
+            for(; i < count; i++) {
+                float* p = px + i * 4;
+                _mm_storeu_ps(p, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(p), vinv), vadd));
+            }
+#endif
+            for(; i < count; i++) {
+                float* p = px + i * 4;
+                for(int c = 0; c < 4; c++) {
+                    p[c] = p[c] * inv[c] + add[c];
+                }
+            }
+        }
+    }
+
+    RectOverlay::RectOverlay(int tileSize)
+    {
+        tileSize_ = tileSize > 0 ? tileSize : 32;
+
+#ifdef HAVE_CUDA
+        devGeometry_ = nullptr;
+        devStart_    = nullptr;
+        devIndex_    = nullptr;
+        devGeometryCapacity_ = 0;
+        devTileCapacity_     = 0;
+        devPairCapacity_     = 0;
+#endif
+    }
+
+    RectOverlay::~RectOverlay()
+    {
+#ifdef HAVE_CUDA
+        cudaFree(devGeometry_);
+        cudaFree(devStart_);
+        cudaFree(devIndex_);
+#endif
+    }
+
+    void RectOverlay::buildGeometry(const OverlayBox* boxes, size_t count)
+    {
+        geometry_.resize(count);
+
+        for(size_t n = 0; n < count; n++) {
+            const OverlayBox& b = boxes[n];
+            Geometry& g = geometry_[n];
+
+            g.x0 = toPixel(b.left, true);
+            g.y0 = toPixel(b.top, true);
+            g.x1 = toPixel(b.right, false);
+            g.y1 = toPixel(b.bottom, false);
+            g.color = b.color;
+
+            // empty hollow part
+            g.ix0 = g.iy0 = 1;
+            g.ix1 = g.iy1 = 0;
+
+            if(b.style == OVERLAY_OUTLINE && g.x0 <= g.x1 && g.y0 <= g.y1) {
+                const int32_t t = b.thickness > 0 ? b.thickness : 1;
+
+                if(g.x1 - g.x0 + 1 > 2 * t && g.y1 - g.y0 + 1 > 2 * t) {
+                    g.ix0 = g.x0 + t;
+                    g.iy0 = g.y0 + t;
+                    g.ix1 = g.x1 - t;
+                    g.iy1 = g.y1 - t;
+                }
+            }
+        }
+    }
+
+    bool RectOverlay::Draw(const ImageView& image, PixelType type, const std::vector<OverlayBox>& boxes)
+    {
+        return Draw(image, type, boxes.data(), boxes.size());
+    }
+
+    bool RectOverlay::Draw(const ImageView& image, PixelType type, const OverlayBox* boxes, size_t count)
+    {
+        if(!image.data || image.width == 0 || image.height == 0 || (!boxes && count)) {
+            return false;
+        }
+
+        buildGeometry(boxes, count);
+
+        const size_t elem  = PixelSize(type);
+        const size_t pitch = image.pitch ? image.pitch : image.width * elem;
+        const int32_t w = (int32_t)image.width;
+        const int32_t h = (int32_t)image.height;
+
+        for(const Geometry& g : geometry_) {
+            const int32_t ya = g.y0 < 0 ? 0 : g.y0;
+            const int32_t yb = g.y1 >= h ? h - 1 : g.y1;
+
+            for(int32_t y = ya; y <= yb; y++) {
+                uint8_t* row = (uint8_t*)image.data + y * pitch;
+
+                // one span, or the left and right border around the hollow part
+                int32_t spans[2][2] = { { g.x0, g.x1 }, { 1, 0 } };
+                if(y >= g.iy0 && y <= g.iy1) {
+                    spans[0][1] = g.ix0 - 1;
+                    spans[1][0] = g.ix1 + 1;
+                    spans[1][1] = g.x1;
+                }
+
+                for(int s = 0; s < 2; s++) {
+                    const int32_t xa = spans[s][0] < 0 ? 0 : spans[s][0];
+                    const int32_t xb = spans[s][1] >= w ? w - 1 : spans[s][1];
+                    if(xa > xb) continue;
+
+                    if(type == PIXEL_TYPE_RGBA8) {
+                        blendSpan8(row + xa * elem, xb - xa + 1, g.color);
+                    } else {
+                        blendSpanF((float*)(row + xa * elem), xb - xa + 1, g.color);
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    size_t RectOverlay::Bin(const OverlayBox* boxes, size_t count, size_t width, size_t height)
+    {
+        buildGeometry(boxes, count);
+
+        const int32_t ts = tileSize_;
+        const int32_t w  = (int32_t)width;
+        const int32_t h  = (int32_t)height;
+        const int32_t tilesX = (w + ts - 1) / ts;
+        const int32_t tilesY = (h + ts - 1) / ts;
+
+        tileStart_.assign((size_t)tilesX * tilesY + 1, 0);
+        tileIndex_.clear();
+
+        // counting pass, then the same walk again to fill the lists
+        for(int pass = 0; pass < 2; pass++) {
+            for(size_t n = 0; n < geometry_.size(); n++) {
+                const Geometry& g = geometry_[n];
+
+                const int32_t xa = g.x0 < 0 ? 0 : g.x0;
+                const int32_t ya = g.y0 < 0 ? 0 : g.y0;
+                const int32_t xb = g.x1 >= w ? w - 1 : g.x1;
+                const int32_t yb = g.y1 >= h ? h - 1 : g.y1;
+                if(xa > xb || ya > yb) continue;
+
+                for(int32_t ty = ya / ts; ty <= yb / ts; ty++) {
+                    for(int32_t tx = xa / ts; tx <= xb / ts; tx++) {
+                        const int32_t px0 = tx * ts, py0 = ty * ts;
+                        const int32_t px1 = px0 + ts - 1, py1 = py0 + ts - 1;
+
+                        // tile entirely inside the hollow part of an outline
+                        if(px0 >= g.ix0 && px1 <= g.ix1 && py0 >= g.iy0 && py1 <= g.iy1) {
+                            continue;
+                        }
+
+                        const size_t tile = (size_t)ty * tilesX + tx;
+                        if(pass == 0) {
+                            tileStart_[tile + 1]++;
+                        } else {
+                            tileIndex_[tileStart_[tile]++] = (uint32_t)n;
+                        }
+                    }
+                }
+            }
+
+            if(pass == 0) {
+                for(size_t t = 1; t < tileStart_.size(); t++) {
+                    tileStart_[t] += tileStart_[t - 1];
+                }
+                tileIndex_.resize(tileStart_.back());
+            } else {
+                // the fill pass advanced every start to the next tile's start
+                for(size_t t = tileStart_.size() - 1; t > 0; t--) {
+                    tileStart_[t] = tileStart_[t - 1];
+                }
+                tileStart_[0] = 0;
+            }
+        }
+
+        return tileIndex_.size();
+    }
+
+} // image
+} // mtsai
@@ -0,0 +1,145 @@
+/*
+ * CUDA variant of the rectangle overlay, one block per screen tile
+ */
+#include "image/overlay.h"
+#include "cudaUtility.h"
+
+
+namespace mtsai
+{
+namespace image
+{
+    namespace
+    {
+        // same blend as blendSpan8() in overlay.cpp
+        __device__ inline uint8_t blend8(uint8_t p, uint8_t c, uint32_t a)
+        {
+            const uint32_t t = p * (255 - a) + c * a + 128;
+            return (uint8_t)((t + (t >> 8)) >> 8);
+        }
+
+        __device__ inline void blendPixel(uchar4& px, const PixelRGBA8& color)
+        {
+            px.x = blend8(px.x, color.r, color.a);
+            px.y = blend8(px.y, color.g, color.a);
+            px.z = blend8(px.z, color.b, color.a);
+        }
+
+        // same as blendSpanF(), kept unfused so both paths round alike
+        __device__ inline void blendPixel(float4& px, const PixelRGBA8& color)
+        {
+            const float a   = color.a / 255.0f;
+            const float inv = 1.0f - a;
+
+            px.x = __fadd_rn(__fmul_rn(px.x, inv), color.r * a);
+            px.y = __fadd_rn(__fmul_rn(px.y, inv), color.g * a);
+            px.z = __fadd_rn(__fmul_rn(px.z, inv), color.b * a);
+        }
+
+        template<typename T>
+        __global__ void gpuRectOverlay(uint8_t* image, size_t pitch, int width, int height, int tileSize,
+                                       const RectOverlay::Geometry* geometry,
+                                       const uint32_t* tileStart, const uint32_t* tileIndex)
+        {
+            const uint32_t tile  = blockIdx.y * gridDim.x + blockIdx.x;
+            const uint32_t first = tileStart[tile];
+            const uint32_t last  = tileStart[tile + 1];
+
+            if( first == last )
+                return;
+
+            const int tileX = blockIdx.x * tileSize;
+            const int tileY = blockIdx.y * tileSize;
+            const int endX  = min(tileX + tileSize, width);
+            const int endY  = min(tileY + tileSize, height);
+
+            for( int y = tileY + threadIdx.y; y < endY; y += blockDim.y )
+            {
+                T* row = (T*)(image + y * pitch);
+
+                for( int x = tileX + threadIdx.x; x < endX; x += blockDim.x )
+                {
+                    T px = row[x];
+
+                    for( uint32_t n = first; n < last; n++ )
+                    {
+                        const RectOverlay::Geometry g = geometry[tileIndex[n]];
+
+                        if( x < g.x0 || x > g.x1 || y < g.y0 || y > g.y1 )
+                            continue;
+
+                        if( x >= g.ix0 && x <= g.ix1 && y >= g.iy0 && y <= g.iy1 )
+                            continue;
+
+                        blendPixel(px, g.color);
+                    }
+
+                    row[x] = px;
+                }
+            }
+        }
+
+        template<typename T>
+        bool growDevice(void** ptr, size_t* capacity, size_t count)
+        {
+            if( count <= *capacity )
+                return true;
+
+            CUDA(cudaFree(*ptr));
+            *ptr = nullptr;
+            *capacity = 0;
+
+            if( CUDA_FAILED(cudaMalloc(ptr, count * sizeof(T))) )
+                return false;
+
+            *capacity = count;
+            return true;
+        }
+    }
+
+    bool RectOverlay::reserveDevice(size_t boxes, size_t tiles, size_t pairs)
+    {
+        return growDevice<Geometry>(&devGeometry_, &devGeometryCapacity_, boxes) &&
+               growDevice<uint32_t>(&devStart_, &devTileCapacity_, tiles) &&
+               growDevice<uint32_t>(&devIndex_, &devPairCapacity_, pairs);
+    }
+
+    bool RectOverlay::DrawCUDA(const ImageView& image, PixelType type, const OverlayBox* boxes, size_t count,
+                               cudaStream_t stream)
+    {
+        if( !image.data || image.width == 0 || image.height == 0 || (!boxes && count) )
+            return false;
+
+        if( Bin(boxes, count, image.width, image.height) == 0 )
+            return true;
+
+        if( !reserveDevice(geometry_.size(), tileStart_.size(), tileIndex_.size()) )
+            return false;
+
+        // pageable sources are staged before the calls return, the host lists can be reused
+        if( CUDA_FAILED(cudaMemcpyAsync(devGeometry_, geometry_.data(), geometry_.size() * sizeof(Geometry), cudaMemcpyHostToDevice, stream)) ||
+            CUDA_FAILED(cudaMemcpyAsync(devStart_, tileStart_.data(), tileStart_.size() * sizeof(uint32_t), cudaMemcpyHostToDevice, stream)) ||
+            CUDA_FAILED(cudaMemcpyAsync(devIndex_, tileIndex_.data(), tileIndex_.size() * sizeof(uint32_t), cudaMemcpyHostToDevice, stream)) )
+            return false;
+
+        const size_t pitch = image.pitch ? image.pitch : image.width * PixelSize(type);
+
+        const dim3 blockDim(32, 8);
+        const dim3 gridDim(iDivUp(image.width, tileSize_), iDivUp(image.height, tileSize_));
+
+        if( type == PIXEL_TYPE_RGBA8 )
+        {
+            gpuRectOverlay<uchar4><<<gridDim, blockDim, 0, stream>>>((uint8_t*)image.data, pitch, image.width, image.height, tileSize_,
+                                                                   (const Geometry*)devGeometry_, (const uint32_t*)devStart_, (const uint32_t*)devIndex_);
+        }
+        else
+        {
+            gpuRectOverlay<float4><<<gridDim, blockDim, 0, stream>>>((uint8_t*)image.data, pitch, image.width, image.height, tileSize_,
+                                                                   (const Geometry*)devGeometry_, (const uint32_t*)devStart_, (const uint32_t*)devIndex_);
+        }
+
+        return CUDA_SUCCESS(cudaGetLastError());
+    }
+
+} // image
+} // mtsai
@@ -0,0 +1,290 @@
+#include "image/preprocess.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace mtsai
+{
+namespace image
+{
+    namespace
+    {
+        /*
+         * Bilinear taps with centre-aligned sampling, a subsampled chroma
+         * plane (shift 1) is addressed at half the luma position.
+         */
+        template<typename Tap>
+        void buildTaps(std::vector<Tap>& taps, size_t dstSize, size_t srcSize, int shift)
+        {
+            const int32_t samples = (int32_t)(srcSize >> shift);
+            const float ratio = (float)srcSize / (float)dstSize;
+
+            taps.resize(dstSize);
+
+            for(size_t i = 0; i < dstSize; i++) {
+                float pos = ((i + 0.5f) * ratio) / (float)(1 << shift) - 0.5f;
+
+                pos = pos < 0.0f ? 0.0f : pos;
+                pos = pos > (float)(samples - 1) ? (float)(samples - 1) : pos;
+
+                const int32_t i0 = (int32_t)pos;
+                taps[i].i0 = i0;
+                taps[i].i1 = (i0 + 1 < samples) ? i0 + 1 : i0;
+                taps[i].w  = pos - (float)i0;
+            }
+        }
+
+        inline float lerp(float a, float b, float w)
+        {
+            return a + (b - a) * w;
+        }
+
+        inline int8_t saturateInt8(float v)
+        {
+            const long q = lrintf(v);
+            return (int8_t)(q < -128 ? -128 : q > 127 ? 127 : q);
+        }
+    }
+
+    Preprocessor::Preprocessor()
+        : initialized_(false), clampRGB_(false)
+    {
+    }
+
+    Preprocessor::Preprocessor(const PreprocessParams& params)
+        : initialized_(false), clampRGB_(false)
+    {
+        Init(params);
+    }
+
+    Preprocessor::~Preprocessor()
+    {
+    }
+
+    bool Preprocessor::Init(const PreprocessParams& params)
+    {
+        initialized_ = false;
+
+        if(params.srcWidth == 0 || params.srcHeight == 0 || params.dstWidth == 0 || params.dstHeight == 0) {
+            printf("preprocess -- invalid size %zux%zu -> %zux%zu\n",
+                   params.srcWidth, params.srcHeight, params.dstWidth, params.dstHeight);
+            return false;
+        }
+
+        if(params.output == TENSOR_INT8 && params.int8Scale <= 0.0f) {
+            printf("preprocess -- int8 output needs a positive scale\n");
+            return false;
+        }
+
+        const size_t w = params.srcWidth;
+        const size_t h = params.srcHeight;
+        int chromaShiftY = 0;
+
+        switch(params.format) {
+        case PIXEL_NV12:
+            if((w & 1) || (h & 1)) {
+                printf("preprocess -- NV12 needs even dimensions (%zux%zu)\n", w, h);
+                return false;
+            }
+            planes_[0] = {0,         1, w, false};
+            planes_[1] = {w * h,     2, w, true};
+            planes_[2] = {w * h + 1, 2, w, true};
+            chromaShiftY = 1;
+            break;
+        case PIXEL_UYVY:
+        case PIXEL_YUYV:
+        {
+            if(w & 1) {
+                printf("preprocess -- 4:2:2 needs an even width (%zu)\n", w);
+                return false;
+            }
+            const bool uyvy = (params.format == PIXEL_UYVY);
+            planes_[0] = {uyvy ? 1u : 0u, 2, w * 2, false};
+            planes_[1] = {uyvy ? 0u : 1u, 4, w * 2, true};
+            planes_[2] = {uyvy ? 2u : 3u, 4, w * 2, true};
+            break;
+        }
+        case PIXEL_RGB:
+        case PIXEL_BGR:
+        {
+            const bool rgb = (params.format == PIXEL_RGB);
+            planes_[0] = {rgb ? 0u : 2u, 3, w * 3, false};
+            planes_[1] = {1,             3, w * 3, false};
+            planes_[2] = {rgb ? 2u : 0u, 3, w * 3, false};
+            break;
+        }
+        default:
+            printf("preprocess -- unsupported pixel format %d\n", (int)params.format);
+            return false;
+        }
+
+        /*
+         * Component -> RGB, the colour core's matrix for params.colour so
+         * the fused output matches convert + resize + normalize.
+         */
+        memset(matrix_, 0, sizeof(matrix_));
+        memset(offset_, 0, sizeof(offset_));
+        clampRGB_ = false;
+
+        if(params.format == PIXEL_NV12 || params.format == PIXEL_UYVY || params.format == PIXEL_YUYV) {
+            GetYuvToRgbMatrix(params.colour, matrix_, offset_);
+            clampRGB_ = true;
+        } else {
+            matrix_[0] = matrix_[4] = matrix_[8] = 1.0f;
+        }
+
+        buildTaps(lumaX_,   params.dstWidth,  w, 0);
+        buildTaps(lumaY_,   params.dstHeight, h, 0);
+        buildTaps(chromaX_, params.dstWidth,  w, 1);
+        buildTaps(chromaY_, params.dstHeight, h, chromaShiftY);
+
+        params_ = params;
+        initialized_ = true;
+        return true;
+    }
+
+    size_t Preprocessor::GetOutputSize() const
+    {
+        const size_t elem = (params_.output == TENSOR_INT8) ? sizeof(int8_t) : sizeof(float);
+        return params_.dstWidth * params_.dstHeight * 3 * elem;
+    }
+
+    bool Preprocessor::Process(const uint8_t* src, void* dst)
+    {
+        if(!initialized_ || !src || !dst) {
+            return false;
+        }
+
+        for(size_t y = 0; y < params_.dstHeight; y++) {
+            processRow(src, dst, y);
+        }
+        return true;
+    }
+
+    void Preprocessor::processRow(const uint8_t* src, void* dst, size_t y)
+    {
+        const size_t width = params_.dstWidth;
+        const size_t planeSize = width * params_.dstHeight;
+        const bool int8 = (params_.output == TENSOR_INT8);
+
+        const uint8_t* row0[3];
+        const uint8_t* row1[3];
+        const Tap* tapsX[3];
+        float wy[3];
+
+        for(int k = 0; k < 3; k++) {
+            const Tap& ty = planes_[k].chroma ? chromaY_[y] : lumaY_[y];
+            row0[k]  = src + planes_[k].offset + ty.i0 * planes_[k].pitch;
+            row1[k]  = src + planes_[k].offset + ty.i1 * planes_[k].pitch;
+            tapsX[k] = planes_[k].chroma ? chromaX_.data() : lumaX_.data();
+            wy[k]    = ty.w;
+        }
+
+        // normalization folded per output plane: out = rgb * a + b
+        int   channel[3];
+        float normA[3];
+        float normB[3];
+
+        for(int c = 0; c < 3; c++) {
+            const float q = int8 ? 1.0f / params_.int8Scale : 1.0f;
+            channel[c] = params_.bgr ? 2 - c : c;
+            normA[c] = params_.scale[c] * q;
+            normB[c] = -params_.mean[c] * params_.scale[c] * q;
+        }
+
+        float*  outF[3];
+        int8_t* outI[3];
+        for(int c = 0; c < 3; c++) {
+            outF[c] = (float*)dst  + c * planeSize + y * width;
+            outI[c] = (int8_t*)dst + c * planeSize + y * width;
+        }
+
+        size_t x = 0;
+
+#if defined(__SSE2__)
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 k255 = _mm_set1_ps(255.0f);
+
+        for(; x + 4 <= width; x += 4) {
+            __m128 comp[3];
+
+            for(int k = 0; k < 3; k++) {
+                const Tap* t = tapsX[k] + x;
+                const size_t st = planes_[k].step;
+                const uint8_t* r0 = row0[k];
+                const uint8_t* r1 = row1[k];
+
+                const __m128 a = _mm_setr_ps(r0[t[0].i0 * st], r0[t[1].i0 * st], r0[t[2].i0 * st], r0[t[3].i0 * st]);
+                const __m128 b = _mm_setr_ps(r0[t[0].i1 * st], r0[t[1].i1 * st], r0[t[2].i1 * st], r0[t[3].i1 * st]);
+                const __m128 c = _mm_setr_ps(r1[t[0].i0 * st], r1[t[1].i0 * st], r1[t[2].i0 * st], r1[t[3].i0 * st]);
+                const __m128 d = _mm_setr_ps(r1[t[0].i1 * st], r1[t[1].i1 * st], r1[t[2].i1 * st], r1[t[3].i1 * st]);
+                const __m128 wx = _mm_setr_ps(t[0].w, t[1].w, t[2].w, t[3].w);
+
+                const __m128 top    = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), wx));
+                const __m128 bottom = _mm_add_ps(c, _mm_mul_ps(_mm_sub_ps(d, c), wx));
+                comp[k] = _mm_add_ps(top, _mm_mul_ps(_mm_sub_ps(bottom, top), _mm_set1_ps(wy[k])));
+            }
+
+            __m128 rgb[3];
+            for(int j = 0; j < 3; j++) {
+                __m128 v = _mm_mul_ps(comp[0], _mm_set1_ps(matrix_[j * 3]));
+                v = _mm_add_ps(v, _mm_mul_ps(comp[1], _mm_set1_ps(matrix_[j * 3 + 1])));
+                v = _mm_add_ps(v, _mm_mul_ps(comp[2], _mm_set1_ps(matrix_[j * 3 + 2])));
+                v = _mm_add_ps(v, _mm_set1_ps(offset_[j]));
+                rgb[j] = clampRGB_ ? _mm_min_ps(_mm_max_ps(v, zero), k255) : v;
+            }
+
+            for(int c = 0; c < 3; c++) {
+                const __m128 v = _mm_add_ps(_mm_mul_ps(rgb[channel[c]], _mm_set1_ps(normA[c])), _mm_set1_ps(normB[c]));
+
+                if(int8) {
+                    const __m128i q32 = _mm_cvtps_epi32(v);
+                    const __m128i q8  = _mm_packs_epi16(_mm_packs_epi32(q32, q32), _mm_setzero_si128());
+                    const int32_t packed = _mm_cvtsi128_si32(q8);
+                    memcpy(outI[c] + x, &packed, sizeof(packed));
+                } else {
+                    _mm_storeu_ps(outF[c] + x, v);
+                }
+            }
+        }
+#endif
+        for(; x < width; x++) {
+            float comp[3];
+
+            for(int k = 0; k < 3; k++) {
+                const Tap& t = tapsX[k][x];
+                const size_t st = planes_[k].step;
+
+                const float top    = lerp(row0[k][t.i0 * st], row0[k][t.i1 * st], t.w);
+                const float bottom = lerp(row1[k][t.i0 * st], row1[k][t.i1 * st], t.w);
+                comp[k] = lerp(top, bottom, wy[k]);
+            }
+
+            float rgb[3];
+            for(int j = 0; j < 3; j++) {
+                float v = comp[0] * matrix_[j * 3];
+                v = v + comp[1] * matrix_[j * 3 + 1];
+                v = v + comp[2] * matrix_[j * 3 + 2];
+                v = v + offset_[j];
+                rgb[j] = clampRGB_ ? fminf(fmaxf(v, 0.0f), 255.0f) : v;
+            }
+
+            for(int c = 0; c < 3; c++) {
+                const float v = rgb[channel[c]] * normA[c] + normB[c];
+
+                if(int8) {
+                    outI[c][x] = saturateInt8(v);
+                } else {
+                    outF[c][x] = v;
+                }
+            }
+        }
+    }
+
+} // image
+} // mtsai
@@ -0,0 +1,156 @@
+/*
+ * CUDA variant of the fused convert + resize + normalize stage
+ */
+#include "image/preprocess.h"
+#include "cudaUtility.h"
+
+
+namespace mtsai
+{
+namespace image
+{
+    namespace
+    {
+        struct PlaneArgs
+        {
+            size_t offset;
+            size_t step;
+            size_t pitch;
+            int shiftX;
+            int shiftY;
+        };
+
+        struct KernelArgs
+        {
+            PlaneArgs plane[3];
+            float matrix[9];
+            float offset[3];
+            float normA[3];
+            float normB[3];
+            int channel[3];
+            int clampRGB;
+            int int8;
+            int srcWidth;
+            int srcHeight;
+            int dstWidth;
+            int dstHeight;
+        };
+
+        // same tap placement as buildTaps() in preprocess.cpp
+        __device__ inline void tap(int i, int dstSize, int srcSize, int shift, int* i0, int* i1, float* w)
+        {
+            const int samples = srcSize >> shift;
+            const float ratio = (float)srcSize / (float)dstSize;
+
+            float pos = ((i + 0.5f) * ratio) / (float)(1 << shift) - 0.5f;
+            pos = fminf(fmaxf(pos, 0.0f), (float)(samples - 1));
+
+            *i0 = (int)pos;
+            *i1 = min(*i0 + 1, samples - 1);
+            *w  = pos - (float)*i0;
+        }
+
+        __global__ void gpuPreprocess(const uint8_t* src, void* dst, KernelArgs args)
+        {
+            const int x = blockIdx.x * blockDim.x + threadIdx.x;
+            const int y = blockIdx.y * blockDim.y + threadIdx.y;
+
+            if( x >= args.dstWidth || y >= args.dstHeight )
+                return;
+
+            float comp[3];
+
+            for( int k=0; k < 3; k++ )
+            {
+                const PlaneArgs& p = args.plane[k];
+                int x0, x1, y0, y1;
+                float wx, wy;
+
+                tap(x, args.dstWidth,  args.srcWidth,  p.shiftX, &x0, &x1, &wx);
+                tap(y, args.dstHeight, args.srcHeight, p.shiftY, &y0, &y1, &wy);
+
+                const uint8_t* r0 = src + p.offset + y0 * p.pitch;
+                const uint8_t* r1 = src + p.offset + y1 * p.pitch;
+
+                const float a = r0[x0 * p.step];
+                const float b = r0[x1 * p.step];
+                const float c = r1[x0 * p.step];
+                const float d = r1[x1 * p.step];
+
+                const float top    = a + (b - a) * wx;
+                const float bottom = c + (d - c) * wx;
+                comp[k] = top + (bottom - top) * wy;
+            }
+
+            float rgb[3];
+
+            for( int j=0; j < 3; j++ )
+            {
+                float v = comp[0] * args.matrix[j * 3] + comp[1] * args.matrix[j * 3 + 1] +
+                          comp[2] * args.matrix[j * 3 + 2] + args.offset[j];
+                rgb[j] = args.clampRGB ? fminf(fmaxf(v, 0.0f), 255.0f) : v;
+            }
+
+            const size_t planeSize = (size_t)args.dstWidth * args.dstHeight;
+            const size_t idx = (size_t)y * args.dstWidth + x;
+
+            for( int c=0; c < 3; c++ )
+            {
+                const float v = rgb[args.channel[c]] * args.normA[c] + args.normB[c];
+
+                if( args.int8 )
+                    ((int8_t*)dst)[c * planeSize + idx] = (int8_t)max(-128, min(127, __float2int_rn(v)));
+                else
+                    ((float*)dst)[c * planeSize + idx] = v;
+            }
+        }
+    }
+
+
+    bool Preprocessor::ProcessCUDA(const uint8_t* src, void* dst, cudaStream_t stream)
+    {
+        if( !initialized_ || !src || !dst )
+            return false;
+
+        KernelArgs args;
+        const bool int8 = (params_.output == TENSOR_INT8);
+
+        for( int k=0; k < 3; k++ )
+        {
+            args.plane[k].offset = planes_[k].offset;
+            args.plane[k].step   = planes_[k].step;
+            args.plane[k].pitch  = planes_[k].pitch;
+            args.plane[k].shiftX = planes_[k].chroma ? 1 : 0;
+            args.plane[k].shiftY = (planes_[k].chroma && params_.format == PIXEL_NV12) ? 1 : 0;
+        }
+
+        for( int n=0; n < 9; n++ )
+            args.matrix[n] = matrix_[n];
+
+        for( int c=0; c < 3; c++ )
+        {
+            const float q = int8 ? 1.0f / params_.int8Scale : 1.0f;
+
+            args.offset[c]  = offset_[c];
+            args.channel[c] = params_.bgr ? 2 - c : c;
+            args.normA[c]   = params_.scale[c] * q;
+            args.normB[c]   = -params_.mean[c] * params_.scale[c] * q;
+        }
+
+        args.clampRGB  = clampRGB_ ? 1 : 0;
+        args.int8      = int8 ? 1 : 0;
+        args.srcWidth  = params_.srcWidth;
+        args.srcHeight = params_.srcHeight;
+        args.dstWidth  = params_.dstWidth;
+        args.dstHeight = params_.dstHeight;
+
+        const dim3 blockDim(32, 8);
+        const dim3 gridDim(iDivUp(params_.dstWidth, blockDim.x), iDivUp(params_.dstHeight, blockDim.y));
+
+        gpuPreprocess<<<gridDim, blockDim, 0, stream>>>(src, dst, args);
+
+        return CUDA_SUCCESS(cudaGetLastError());
+    }
+
+} // image
+} // mtsai
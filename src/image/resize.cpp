@@ -0,0 +1,323 @@
+#include "image/resize.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace mtsai
+{
+namespace image
+{
+    namespace
+    {
+        inline void formatLayout(ResizeFormat format, int* channels, bool* isFloat)
+        {
+            switch(format) {
+            case RESIZE_GRAY8:  *channels = 1; *isFloat = false; break;
+            case RESIZE_RGB8:   *channels = 3; *isFloat = false; break;
+            case RESIZE_RGBA8:  *channels = 4; *isFloat = false; break;
+            case RESIZE_NV12:   *channels = 1; *isFloat = false; break;
+            case RESIZE_GRAYF:  *channels = 1; *isFloat = true;  break;
+            case RESIZE_RGBAF:  *channels = 4; *isFloat = true;  break;
+            }
+        }
+
+        inline uint8_t saturateU8(float v)
+        {
+            const long q = lrintf(v);
+            return (uint8_t)(q < 0 ? 0 : q > 255 ? 255 : q);
+        }
+
+        // Horizontal pass of one source row into float
+        template<typename T>
+        void filterRow(const T* src, float* dst, size_t dstWidth, int channels,
+                       const int32_t* start, const float* weights, int taps)
+        {
+#if defined(__SSE2__)
+            if(channels == 4) {
+                for(size_t x = 0; x < dstWidth; x++) {
+                    const T* px = src + start[x] * 4;
+                    const float* w = weights + x * taps;
+                    __m128 acc = _mm_setzero_ps();
+
+                    for(int t = 0; t < taps; t++, px += 4) {
+                        __m128 v;
+                        if(sizeof(T) == 1) {
+                            int32_t packed;
+                            memcpy(&packed, px, sizeof(packed));
+                            const __m128i zero = _mm_setzero_si128();
+                            v = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero));
+                        } else {
+                            v = _mm_loadu_ps((const float*)px);
+                        }
+                        acc = _mm_add_ps(acc, _mm_mul_ps(v, _mm_set1_ps(w[t])));
+                    }
+                    _mm_storeu_ps(dst + x * 4, acc);
+                }
+                return;
+            }
+#endif
+            for(size_t x = 0; x < dstWidth; x++) {
+                const T* px = src + start[x] * channels;
+                const float* w = weights + x * taps;
+
+                for(int c = 0; c < channels; c++) {
+                    float acc = 0.0f;
+                    for(int t = 0; t < taps; t++) {
+                        acc += (float)px[t * channels + c] * w[t];
+                    }
+                    dst[x * channels + c] = acc;
+                }
+            }
+        }
+
+        // Vertical pass over the ring rows
+        void blendRows(const float* const* rows, const float* weights, int taps,
+                       void* dst, size_t count, bool isFloat)
+        {
+            size_t i = 0;
+
+#if defined(__SSE2__)
+            for(; i + 4 <= count; i += 4) {
+                __m128 acc = _mm_setzero_ps();
+                for(int t = 0; t < taps; t++) {
+                    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(rows[t] + i), _mm_set1_ps(weights[t])));
+                }
+
+                if(isFloat) {
+                    _mm_storeu_ps((float*)dst + i, acc);
+                } else {
+                    const __m128i q32 = _mm_cvtps_epi32(acc);
+                    const __m128i q16 = _mm_packs_epi32(q32, q32);
+                    const int32_t packed = _mm_cvtsi128_si32(_mm_packus_epi16(q16, q16));
+                    memcpy((uint8_t*)dst + i, &packed, sizeof(packed));
+                }
+            }
+#endif
+            for(; i < count; i++) {
+                float acc = 0.0f;
+                for(int t = 0; t < taps; t++) {
+                    acc += rows[t][i] * weights[t];
+                }
+
+                if(isFloat) {
+                    ((float*)dst)[i] = acc;
+                } else {
+                    ((uint8_t*)dst)[i] = saturateU8(acc);
+                }
+            }
+        }
+    }
+
+    Resizer::Resizer()
+    {
+    }
+
+    Resizer::~Resizer()
+    {
+    }
+
+    size_t Resizer::GetCacheSize()
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        return cache_.size();
+    }
+
+    void Resizer::ClearCache()
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        cache_.clear();
+    }
+
+    std::shared_ptr<const Resizer::Axis> Resizer::getAxis(size_t srcSize, size_t dstSize, ResizeMode mode)
+    {
+        const bool area = (mode == RESIZE_AREA) && (srcSize > dstSize);
+        const uint64_t key = (uint64_t)srcSize | ((uint64_t)dstSize << 24) | ((uint64_t)area << 48);
+
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex_);
+            auto it = cache_.find(key);
+            if(it != cache_.end()) {
+                return it->second;
+            }
+        }
+
+        std::shared_ptr<Axis> axis = std::make_shared<Axis>();
+        const double scale = (double)srcSize / (double)dstSize;
+        const int32_t last = (int32_t)srcSize - 1;
+
+        if(area) {
+            // coverage of each source pixel by [i * scale, (i + 1) * scale)
+            int taps = (int)ceil(scale) + 1;
+            taps = taps > (int)srcSize ? (int)srcSize : taps;
+
+            axis->taps = taps;
+            axis->start.resize(dstSize);
+            axis->weights.assign(dstSize * taps, 0.0f);
+
+            for(size_t i = 0; i < dstSize; i++) {
+                const double x0 = i * scale;
+                const double x1 = x0 + scale;
+                int32_t first = (int32_t)floor(x0);
+                const int32_t start = (first + taps - 1 > last) ? last - taps + 1 : first;
+
+                axis->start[i] = start;
+                for(int32_t k = first; k < x1 && k <= last; k++) {
+                    const double cover = fmin(x1, k + 1.0) - fmax(x0, (double)k);
+                    if(cover > 0.0) {
+                        axis->weights[i * taps + (k - start)] = (float)(cover / scale);
+                    }
+                }
+            }
+        } else {
+            // centre aligned, same placement as the preprocessing stage
+            const int taps = (srcSize > 1) ? 2 : 1;
+
+            axis->taps = taps;
+            axis->start.resize(dstSize);
+            axis->weights.assign(dstSize * taps, 0.0f);
+
+            for(size_t i = 0; i < dstSize; i++) {
+                double pos = (i + 0.5) * scale - 0.5;
+                pos = pos < 0.0 ? 0.0 : pos > last ? last : pos;
+
+                int32_t i0 = (int32_t)pos;
+                double w = pos - i0;
+
+                if(taps == 1) {
+                    axis->start[i] = 0;
+                    axis->weights[i] = 1.0f;
+                    continue;
+                }
+                if(i0 == last) {
+                    i0 = last - 1;
+                    w = 1.0;
+                }
+                axis->start[i] = i0;
+                axis->weights[i * 2]     = (float)(1.0 - w);
+                axis->weights[i * 2 + 1] = (float)w;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        cache_[key] = axis;
+        return axis;
+    }
+
+    bool Resizer::resizePlane(const uint8_t* src, size_t srcPitch, const Rect& roi,
+                              uint8_t* dst, size_t dstPitch, size_t dstWidth, size_t dstHeight,
+                              int channels, bool isFloat, ResizeMode mode)
+    {
+        const size_t elem = isFloat ? sizeof(float) : sizeof(uint8_t);
+        const std::shared_ptr<const Axis> ax = getAxis(roi.width,  dstWidth,  mode);
+        const std::shared_ptr<const Axis> ay = getAxis(roi.height, dstHeight, mode);
+
+        const size_t rowLength = dstWidth * channels;
+        const int taps = ay->taps;
+
+        // horizontally filtered source rows, slot = source row % taps
+        std::vector<float> ring(rowLength * taps);
+        std::vector<int32_t> ringRow(taps, -1);
+        std::vector<const float*> rows(taps);
+
+        const uint8_t* origin = src + roi.y * srcPitch + roi.x * channels * elem;
+
+        for(size_t y = 0; y < dstHeight; y++) {
+            const int32_t first = ay->start[y];
+
+            for(int t = 0; t < taps; t++) {
+                const int32_t r = first + t;
+                const int slot = r % taps;
+                float* row = ring.data() + slot * rowLength;
+
+                if(ringRow[slot] != r) {
+                    const uint8_t* line = origin + r * srcPitch;
+                    if(isFloat) {
+                        filterRow((const float*)line, row, dstWidth, channels, ax->start.data(), ax->weights.data(), ax->taps);
+                    } else {
+                        filterRow(line, row, dstWidth, channels, ax->start.data(), ax->weights.data(), ax->taps);
+                    }
+                    ringRow[slot] = r;
+                }
+                rows[t] = row;
+            }
+
+            blendRows(rows.data(), ay->weights.data() + y * taps, taps, dst + y * dstPitch, rowLength, isFloat);
+        }
+        return true;
+    }
+
+    bool Resizer::Resize(const ImageView& src, const ImageView& dst, ResizeFormat format, ResizeMode mode)
+    {
+        Rect roi;
+        roi.width  = (int)src.width;
+        roi.height = (int)src.height;
+        return ResizeROI(src, roi, dst, format, mode);
+    }
+
+    bool Resizer::ResizeROI(const ImageView& src, const Rect& roi, const ImageView& dst,
+                            ResizeFormat format, ResizeMode mode)
+    {
+        if(!src.data || !dst.data || dst.width == 0 || dst.height == 0) {
+            return false;
+        }
+
+        if(roi.x < 0 || roi.y < 0 || roi.width <= 0 || roi.height <= 0 ||
+           (size_t)(roi.x + roi.width) > src.width || (size_t)(roi.y + roi.height) > src.height) {
+            printf("resize -- roi (%d,%d %dx%d) outside of %zux%zu\n",
+                   roi.x, roi.y, roi.width, roi.height, src.width, src.height);
+            return false;
+        }
+
+        int channels = 1;
+        bool isFloat = false;
+        formatLayout(format, &channels, &isFloat);
+
+        const size_t elem = isFloat ? sizeof(float) : sizeof(uint8_t);
+        const size_t srcPitch = src.pitch ? src.pitch : src.width * channels * elem;
+        const size_t dstPitch = dst.pitch ? dst.pitch : dst.width * channels * elem;
+
+        const uint8_t* s = (const uint8_t*)src.data;
+        uint8_t* d = (uint8_t*)dst.data;
+
+        if(format != RESIZE_NV12) {
+            return resizePlane(s, srcPitch, roi, d, dstPitch, dst.width, dst.height, channels, isFloat, mode);
+        }
+
+        // NV12, the CbCr plane is resized as a half size two channel image
+        if(((roi.x | roi.y | roi.width | roi.height) & 1) || ((dst.width | dst.height) & 1)) {
+            printf("resize -- NV12 needs even roi and destination sizes\n");
+            return false;
+        }
+
+        Rect chroma;
+        chroma.x      = roi.x / 2;
+        chroma.y      = roi.y / 2;
+        chroma.width  = roi.width / 2;
+        chroma.height = roi.height / 2;
+
+        return resizePlane(s, srcPitch, roi, d, dstPitch, dst.width, dst.height, 1, false, mode) &&
+               resizePlane(s + srcPitch * src.height, srcPitch, chroma,
+                           d + dstPitch * dst.height, dstPitch, dst.width / 2, dst.height / 2, 2, false, mode);
+    }
+
+    bool Resizer::ResizeBatch(const ImageView& src, const std::vector<Rect>& rois,
+                              const std::vector<ImageView>& dst, ResizeFormat format, ResizeMode mode)
+    {
+        if(rois.size() != dst.size()) {
+            return false;
+        }
+
+        bool ok = true;
+        for(size_t i = 0; i < rois.size(); i++) {
+            ok &= ResizeROI(src, rois[i], dst[i], format, mode);
+        }
+        return ok;
+    }
+
+} // image
+} // mtsai
@@ -0,0 +1,260 @@
+#include "image/text.h"
+#include "font_atlas.h"
+
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace mtsai
+{
+namespace image
+{
+    namespace
+    {
+        // round(v / 255) for v < 65536 - 255
+        inline uint32_t div255(uint32_t v)
+        {
+            v += 128;
+            return (v + (v >> 8)) >> 8;
+        }
+
+        /*
+         * 8 bit blend of one mask row, alpha = coverage * opacity / 255,
+         * out = round((p * (255 - alpha) + c * alpha) / 255), image alpha kept
+         */
+        void blendRow8(uint8_t* px, const uint8_t* mask, size_t count, const PixelRGBA8& color)
+        {
+            const uint32_t opacity = color.a;
+            size_t i = 0;
+
+#if defined(__SSE2__)
+            const __m128i zero  = _mm_setzero_si128();
+            const __m128i v128  = _mm_set1_epi16(128);
+            const __m128i v255  = _mm_set1_epi16(255);
+            const __m128i vop   = _mm_set1_epi16((short)opacity);
+            const __m128i vrgb  = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+            const __m128i vcol  = _mm_setr_epi16(color.r, color.g, color.b, 0, color.r, color.g, color.b, 0);
+
+            for(; i + 4 <= count; i += 4) {
+                int32_t cov;
+                memcpy(&cov, mask + i, sizeof(cov));
+
+                // blank part of the string
+                if(cov == 0) continue;
+
+                __m128i a = _mm_unpacklo_epi8(_mm_cvtsi32_si128(cov), zero);
+                if(opacity != 255) {
+                    a = _mm_add_epi16(_mm_mullo_epi16(a, vop), v128);
+                    a = _mm_srli_epi16(_mm_add_epi16(a, _mm_srli_epi16(a, 8)), 8);
+                }
+
+                // a0 a0 a0 0 a1 a1 a1 0 | a2 a2 a2 0 a3 a3 a3 0
+                const __m128i pairs = _mm_unpacklo_epi16(a, a);
+                const __m128i wlo = _mm_and_si128(_mm_unpacklo_epi32(pairs, pairs), vrgb);
+                const __m128i whi = _mm_and_si128(_mm_unpackhi_epi32(pairs, pairs), vrgb);
+
+                uint8_t* p = px + i * 4;
+                const __m128i v = _mm_loadu_si128((const __m128i*)p);
+
+                __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), _mm_sub_epi16(v255, wlo)),
+                                           _mm_add_epi16(_mm_mullo_epi16(vcol, wlo), v128));
+                __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), _mm_sub_epi16(v255, whi)),
+                                           _mm_add_epi16(_mm_mullo_epi16(vcol, whi), v128));
+
+                lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+                hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+
+                _mm_storeu_si128((__m128i*)p, _mm_packus_epi16(lo, hi));
+            }
+#endif
+            const uint8_t rgb[3] = { color.r, color.g, color.b };
+
+            for(; i < count; i++) {
+                if(!mask[i]) continue;
+
+                const uint32_t a = (opacity == 255) ? mask[i] : div255(mask[i] * opacity);
+                uint8_t* p = px + i * 4;
+
+                for(int c = 0; c < 3; c++) {
+                    p[c] = (uint8_t)div255(p[c] * (255 - a) + rgb[c] * a);
+                }
+            }
+        }
+
+        void blendRowF(float* px, const uint8_t* mask, size_t count, const PixelRGBA8& color)
+        {
+            const float opacity = color.a / (255.0f * 255.0f);
+
+            for(size_t i = 0; i < count; i++) {
+                if(!mask[i]) continue;
+
+                const float a = mask[i] * opacity;
+                float* p = px + i * 4;
+
+                p[0] = p[0] * (1.0f - a) + color.r * a;
+                p[1] = p[1] * (1.0f - a) + color.g * a;
+                p[2] = p[2] * (1.0f - a) + color.b * a;
+            }
+        }
+    }
+
+    TextOverlay::TextOverlay(int scale)
+    {
+        scale_ = scale > 0 ? scale : 1;
+        frame_ = 0;
+        glyphsRasterised_ = 0;
+    }
+
+    TextOverlay::~TextOverlay()
+    {
+    }
+
+    const uint8_t* TextOverlay::GetGlyph(char c)
+    {
+        if(c < kFontFirst || c > kFontLast) {
+            return NULL;
+        }
+        return kFontAtlas + (c - kFontFirst) * kGlyphWidth * kGlyphHeight;
+    }
+
+    int TextOverlay::GetGlyphWidth() const
+    {
+        return kGlyphWidth * scale_;
+    }
+
+    int TextOverlay::GetGlyphHeight() const
+    {
+        return kGlyphHeight * scale_;
+    }
+
+    size_t TextOverlay::GetTextWidth(const std::string& text) const
+    {
+        return text.size() * GetGlyphWidth();
+    }
+
+    void TextOverlay::rasteriseGlyph(uint8_t* dst, size_t pitch, char c)
+    {
+        const uint8_t* glyph = GetGlyph(c);
+        const int w = GetGlyphWidth();
+        const int h = GetGlyphHeight();
+
+        glyphsRasterised_++;
+
+        for(int y = 0; y < h; y++, dst += pitch) {
+            if(!glyph) {
+                memset(dst, 0, w);
+                continue;
+            }
+
+            const uint8_t* src = glyph + (y / scale_) * kGlyphWidth;
+            if(scale_ == 1) {
+                memcpy(dst, src, kGlyphWidth);
+                continue;
+            }
+            for(int x = 0; x < w; x++) {
+                dst[x] = src[x / scale_];
+            }
+        }
+    }
+
+    void TextOverlay::rasterise(Entry& entry, const std::string& text)
+    {
+        const size_t pitch = GetTextWidth(text);
+        const size_t cell  = GetGlyphWidth();
+
+        // same length, only the cells that changed
+        const bool partial = (entry.text.size() == text.size()) && !entry.mask.empty();
+
+        if(!partial) {
+            entry.mask.assign(pitch * GetGlyphHeight(), 0);
+        }
+
+        for(size_t i = 0; i < text.size(); i++) {
+            if(partial && entry.text[i] == text[i]) continue;
+            rasteriseGlyph(entry.mask.data() + i * cell, pitch, text[i]);
+        }
+
+        entry.text = text;
+    }
+
+    void TextOverlay::Add(const std::string& text, int x, int y, const PixelRGBA8& color)
+    {
+        if(text.empty()) {
+            return;
+        }
+
+        Command cmd;
+        cmd.text  = text;
+        cmd.x     = x;
+        cmd.y     = y;
+        cmd.color = color;
+        commands_.push_back(cmd);
+    }
+
+    bool TextOverlay::Draw(const ImageView& image, PixelType type, const std::string& text,
+                           int x, int y, const PixelRGBA8& color)
+    {
+        Add(text, x, y, color);
+        return Render(image, type);
+    }
+
+    bool TextOverlay::Render(const ImageView& image, PixelType type)
+    {
+        if(!image.data || image.width == 0 || image.height == 0) {
+            commands_.clear();
+            return false;
+        }
+
+        frame_++;
+
+        const size_t elem  = PixelSize(type);
+        const size_t pitch = image.pitch ? image.pitch : image.width * elem;
+        const int w = (int)image.width;
+        const int h = (int)image.height;
+
+        for(const Command& cmd : commands_) {
+            Entry& entry = cache_[std::make_pair(cmd.x, cmd.y)];
+            if(entry.text != cmd.text || entry.mask.empty()) {
+                rasterise(entry, cmd.text);
+            }
+            entry.lastFrame = frame_;
+
+            const int maskW = (int)GetTextWidth(cmd.text);
+            const int maskH = GetGlyphHeight();
+
+            // clip to the image
+            const int x0 = cmd.x < 0 ? 0 : cmd.x;
+            const int y0 = cmd.y < 0 ? 0 : cmd.y;
+            const int x1 = cmd.x + maskW > w ? w : cmd.x + maskW;
+            const int y1 = cmd.y + maskH > h ? h : cmd.y + maskH;
+            if(x0 >= x1 || y0 >= y1) continue;
+
+            for(int y = y0; y < y1; y++) {
+                const uint8_t* mask = entry.mask.data() + (y - cmd.y) * maskW + (x0 - cmd.x);
+                uint8_t* row = (uint8_t*)image.data + y * pitch + x0 * elem;
+
+                if(type == PIXEL_TYPE_RGBA8) {
+                    blendRow8(row, mask, x1 - x0, cmd.color);
+                } else {
+                    blendRowF((float*)row, mask, x1 - x0, cmd.color);
+                }
+            }
+        }
+
+        commands_.clear();
+
+        // strings that went away
+        for(auto it = cache_.begin(); it != cache_.end();) {
+            if(frame_ - it->second.lastFrame >= (uint64_t)kCacheFrames) {
+                it = cache_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        return true;
+    }
+
+} // image
+} // mtsai
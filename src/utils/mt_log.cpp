@@ -0,0 +1,294 @@
+#include "utils/mt_log.h"
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+namespace mtsai
+{
+namespace utils
+{
+    namespace
+    {
+        const size_t kRingSize = 1024;      // power of two
+        const size_t kLineSize = 256;
+
+        uint64_t steadyNow()
+        {
+            return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        LogLevel levelFromEnv()
+        {
+            const char* env = getenv("MT_LOG_LEVEL");
+            if(!env || env[0] < '0' || env[0] > '4') {
+                return LOG_LEVEL_INFO;
+            }
+            return (LogLevel)(env[0] - '0');
+        }
+
+        void stderrSink(const LogRecord& record, void*)
+        {
+            fprintf(stderr, "[%12.6f] %c %s: %s\n", record.time * 1e-9, LogLevelName(record.level)[0],
+                    record.category, record.text);
+        }
+
+        struct Slot
+        {
+            std::atomic<size_t> sequence;
+            LogLevel level;
+            const char* category;
+            uint64_t time;
+            char text[kLineSize];
+        };
+
+        /*
+         * Bounded multi producer / single consumer ring: a producer claims a
+         * position with a CAS on head_, fills the slot and publishes it by
+         * bumping the slot sequence. The drain thread is the only consumer.
+         */
+        class LogRing
+        {
+        public:
+            LogRing() : level_(levelFromEnv()), written_(0), dropped_(0), suppressed_(0), head_(0), tail_(0),
+                        sink_(stderrSink), user_(nullptr), stop_(false)
+            {
+                for(size_t i = 0; i < kRingSize; i++) {
+                    slots_[i].sequence.store(i, std::memory_order_relaxed);
+                }
+                thread_ = std::thread(&LogRing::drainLoop, this);
+            }
+
+            ~LogRing()
+            {
+                stop_ = true;
+                thread_.join();
+                drain();
+                fflush(stderr);
+            }
+
+            Slot* claim()
+            {
+                size_t pos = head_.load(std::memory_order_relaxed);
+
+                while(true) {
+                    Slot* slot = &slots_[pos & (kRingSize - 1)];
+                    const size_t seq = slot->sequence.load(std::memory_order_acquire);
+
+                    if(seq == pos) {
+                        if(head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                            return slot;
+                        }
+                    } else if(seq < pos) {
+                        dropped_++;     // full, the drain thread is behind
+                        return nullptr;
+                    } else {
+                        pos = head_.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            void publish(Slot* slot)
+            {
+                const size_t pos = slot->sequence.load(std::memory_order_relaxed);
+                slot->sequence.store(pos + 1, std::memory_order_release);
+            }
+
+            // writes every published slot, drain thread or LogFlush() under sinkMutex_
+            size_t drain()
+            {
+                std::lock_guard<std::mutex> lock(sinkMutex_);
+                size_t count = 0;
+
+                while(true) {
+                    Slot* slot = &slots_[tail_ & (kRingSize - 1)];
+                    if(slot->sequence.load(std::memory_order_acquire) != tail_ + 1) {
+                        break;
+                    }
+
+                    LogRecord record;
+                    record.level = slot->level;
+                    record.category = slot->category;
+                    record.time = slot->time;
+                    record.text = slot->text;
+                    sink_(record, user_);
+
+                    slot->sequence.store(tail_ + kRingSize, std::memory_order_release);
+                    tail_++;
+                    count++;
+                }
+
+                written_ += count;
+                return count;
+            }
+
+            void setSink(LogSink sink, void* user)
+            {
+                std::lock_guard<std::mutex> lock(sinkMutex_);
+                sink_ = sink ? sink : stderrSink;
+                user_ = sink ? user : nullptr;
+            }
+
+            std::atomic<int> level_;
+            std::atomic<uint64_t> written_;
+            std::atomic<uint64_t> dropped_;
+            std::atomic<uint64_t> suppressed_;
+
+        private:
+            void drainLoop()
+            {
+                while(!stop_) {
+                    if(drain() == 0) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                    }
+                }
+            }
+
+            Slot slots_[kRingSize];
+            std::atomic<size_t> head_;
+            size_t tail_;
+
+            std::mutex sinkMutex_;
+            LogSink sink_;
+            void* user_;
+
+            std::atomic<bool> stop_;
+            std::thread thread_;
+        };
+
+        LogRing& ring()
+        {
+            static LogRing instance;
+            return instance;
+        }
+
+        void push(LogLevel level, const char* category, uint64_t time, const char* format, va_list args)
+        {
+            LogRing& r = ring();
+            Slot* slot = r.claim();
+            if(!slot) {
+                return;
+            }
+
+            slot->level = level;
+            slot->category = category;
+            slot->time = time;
+            vsnprintf(slot->text, kLineSize, format, args);
+            r.publish(slot);
+        }
+
+        void pushf(LogLevel level, const char* category, uint64_t time, const char* format, ...)
+        {
+            va_list args;
+            va_start(args, format);
+            push(level, category, time, format, args);
+            va_end(args);
+        }
+    }
+
+    const char* LogLevelName(LogLevel level)
+    {
+        switch(level) {
+        case LOG_LEVEL_ERROR:   return "ERROR";
+        case LOG_LEVEL_WARNING: return "WARNING";
+        case LOG_LEVEL_INFO:    return "INFO";
+        case LOG_LEVEL_DEBUG:   return "DEBUG";
+        case LOG_LEVEL_TRACE:   return "TRACE";
+        default:                return "?";
+        }
+    }
+
+    LogCategory::LogCategory(const char* name, uint32_t ratePerSecond)
+        : name_(name), level_(-1), rate_(ratePerSecond), window_(0), count_(0), dropped_(0)
+    {
+    }
+
+    bool LogCategory::Enabled(LogLevel level) const
+    {
+        const int own = level_.load(std::memory_order_relaxed);
+        const int limit = (own >= 0) ? own : ring().level_.load(std::memory_order_relaxed);
+        return (int)level <= limit;
+    }
+
+    bool LogCategory::Admit(uint64_t now, uint64_t* suppressed)
+    {
+        *suppressed = 0;
+
+        const uint32_t rate = rate_.load(std::memory_order_relaxed);
+        if(rate == 0) {
+            return true;
+        }
+
+        const uint64_t second = now / 1000000000ull;
+        uint64_t window = window_.load(std::memory_order_relaxed);
+
+        // first line of a new second resets the window and reports the drops
+        if(second != window && window_.compare_exchange_strong(window, second)) {
+            count_ = 0;
+            *suppressed = dropped_.exchange(0);
+        }
+
+        if(count_.fetch_add(1, std::memory_order_relaxed) < rate) {
+            return true;
+        }
+        dropped_++;
+        return false;
+    }
+
+    void SetLogLevel(LogLevel level)
+    {
+        ring().level_ = (int)level;
+    }
+
+    LogLevel GetLogLevel()
+    {
+        return (LogLevel)ring().level_.load();
+    }
+
+    void LogWrite(LogCategory& category, LogLevel level, const char* format, ...)
+    {
+        const uint64_t now = steadyNow();
+        uint64_t suppressed = 0;
+        const bool admitted = category.Admit(now, &suppressed);
+
+        if(suppressed > 0) {
+            ring().suppressed_ += suppressed;
+            pushf(LOG_LEVEL_WARNING, category.Name(), now, "%llu lines suppressed by the rate limit",
+                  (unsigned long long)suppressed);
+        }
+        if(!admitted) {
+            return;
+        }
+
+        va_list args;
+        va_start(args, format);
+        push(level, category.Name(), now, format, args);
+        va_end(args);
+    }
+
+    void SetLogSink(LogSink sink, void* user)
+    {
+        ring().setSink(sink, user);
+    }
+
+    void LogFlush()
+    {
+        ring().drain();
+    }
+
+    LogStats GetLogStats()
+    {
+        LogRing& r = ring();
+        LogStats stats;
+        stats.written = r.written_;
+        stats.dropped = r.dropped_;
+        stats.suppressed = r.suppressed_;
+        return stats;
+    }
+
+} // utils
+} // mtsai
@@ -0,0 +1,391 @@
+/*
+Loopback RTP ingest benchmark
+
+A generator thread sends synthetic RFC 4175 raw video (YCbCr-4:2:2, 8 bit) to
+127.0.0.1 and the frames are received by GstCamera with
+"udpsrc ! rtpvrawdepay ! appsink".
+
+The legacy rtpStream receiver is not measured: camera/rtpStream.cpp is only
+compiled with the camera/config.h of a jetson-inference style build, which
+this tree does not ship.
+
+Every line starts with one pgroup holding the frame index, so the consumer can
+tell how much of the delivered frame really belongs to the newest frame
+(completeness) and when the last packet of that frame was sent (latency).
+
+usage:
+    bench_rtp_ingest [--width 640] [--height 480] [--fps 30] [--seconds 10]
+                     [--loss 0.0] [--reorder 0.0] [--port 5004] [--jitter-ms 0]
+
+equivalent gstreamer sender (no loss/reorder):
+gst-launch-1.0 videotestsrc ! video/x-raw, format=UYVY, width=640, height=480, framerate=30/1 ! rtpvrawpay ! udpsink host=127.0.0.1 port=5004
+*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <sstream>
+#include <algorithm>
+
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "gst_camera.h"
+#include "gst_camera_param.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int RTP_HEADER_SIZE   = 12;
+static const int RTP_PAYLOAD_VRAW  = 96;
+static const int RTP_MAX_SEGMENT   = 1200; // payload bytes per packet, keep below MTU
+static const int SEND_TIME_HISTORY = 1024; // frames of send timestamps kept for latency
+
+struct BenchParam
+{
+    int width       = 640;
+    int height      = 480;
+    int fps         = 30;
+    int seconds     = 10;
+    double loss     = 0.0;
+    double reorder  = 0.0;
+    int port        = 5004;
+    int jitterMs    = 0;
+};
+
+struct BenchResult
+{
+    std::string name;
+    unsigned long frames     = 0;
+    unsigned long complete   = 0;
+    unsigned long timeouts   = 0;
+    double completenessSum   = 0.0;
+    std::vector<double> latencyMs;
+};
+
+// Send time of the marker packet for each frame index
+static std::atomic<int64_t> frameSendTime[SEND_TIME_HISTORY];
+static std::atomic<bool> running{true};
+
+
+/*
+ * RFC 4175 packetizer
+ */
+class VrawGenerator
+{
+public:
+    VrawGenerator(const BenchParam& param) : param_(param), seq_(0), rng_(1234) {}
+
+    bool Open()
+    {
+        sock_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if(sock_ < 0) {
+            printf("generator -- failed to create socket\n");
+            return false;
+        }
+        int sndbuf = 8 * 1024 * 1024;
+        setsockopt(sock_, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+
+        memset(&dest_, 0, sizeof(dest_));
+        dest_.sin_family = AF_INET;
+        dest_.sin_port = htons(param_.port);
+        dest_.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        return true;
+    }
+
+    void Close()
+    {
+        if(sock_ >= 0) {
+            close(sock_);
+            sock_ = -1;
+        }
+    }
+
+    void Run()
+    {
+        const auto period = std::chrono::nanoseconds(1000000000LL / param_.fps);
+        auto next = Clock::now();
+        uint32_t frame = 0;
+
+        while(running) {
+            sendFrame(frame);
+            frame += 1;
+            next += period;
+            std::this_thread::sleep_until(next);
+        }
+        flushHeld();
+    }
+
+    unsigned long SentPackets() const    { return sent_; }
+    unsigned long DroppedPackets() const { return dropped_; }
+    uint32_t SentFrames() const          { return frames_; }
+
+private:
+    void sendFrame(uint32_t frame)
+    {
+        const int lineBytes = param_.width * 2; // 4 bytes per pgroup of 2 pixels
+        const uint32_t timestamp = frame * (90000 / param_.fps);
+        std::vector<uint8_t> line(lineBytes);
+
+        for(int y=0; y<param_.height; ++y) {
+            // pgroup 0 carries the frame index, the rest a per line pattern
+            memset(line.data(), (frame + y) & 0xff, lineBytes);
+            memcpy(line.data(), &frame, sizeof(frame));
+
+            for(int offset=0; offset<lineBytes; offset+=RTP_MAX_SEGMENT) {
+                const int length = std::min(RTP_MAX_SEGMENT, lineBytes - offset);
+                const bool last = (y == param_.height - 1) && (offset + length == lineBytes);
+                buildPacket(timestamp, y, offset / 2, &line[offset], length, last);
+                if(last) {
+                    flushHeld();
+                }
+                emitPacket(last);
+                if(last) {
+                    frameSendTime[frame % SEND_TIME_HISTORY] =
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+                }
+            }
+        }
+        frames_ = frame + 1;
+    }
+
+    void buildPacket(uint32_t timestamp, int line, int pixelOffset, const uint8_t* data, int length, bool marker)
+    {
+        packet_.resize(RTP_HEADER_SIZE + 2 + 6 + length);
+        uint8_t* p = packet_.data();
+
+        p[0] = 0x80;                                        // V=2
+        p[1] = (marker ? 0x80 : 0x00) | RTP_PAYLOAD_VRAW;
+        p[2] = (seq_ >> 8) & 0xff;
+        p[3] = seq_ & 0xff;
+        const uint32_t ts = htonl(timestamp);
+        const uint32_t ssrc = htonl(0x12345678);
+        memcpy(p + 4, &ts, 4);
+        memcpy(p + 8, &ssrc, 4);
+
+        // extended sequence number, then one line header (C=0)
+        p[12] = (seq_ >> 24) & 0xff;
+        p[13] = (seq_ >> 16) & 0xff;
+        p[14] = (length >> 8) & 0xff;
+        p[15] = length & 0xff;
+        p[16] = (line >> 8) & 0x7f;                         // F=0
+        p[17] = line & 0xff;
+        p[18] = (pixelOffset >> 8) & 0x7f;                  // C=0
+        p[19] = pixelOffset & 0xff;
+        memcpy(p + 20, data, length);
+
+        seq_ += 1;
+    }
+
+    void emitPacket(bool marker)
+    {
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        if(uniform(rng_) < param_.loss) {
+            dropped_ += 1;
+            return;
+        }
+        // Hold back this packet and send it after the next one
+        if(!marker && held_.empty() && uniform(rng_) < param_.reorder) {
+            held_ = packet_;
+            return;
+        }
+        sendRaw(packet_);
+        flushHeld();
+    }
+
+    void flushHeld()
+    {
+        if(!held_.empty()) {
+            sendRaw(held_);
+            held_.clear();
+        }
+    }
+
+    void sendRaw(const std::vector<uint8_t>& pkt)
+    {
+        sendto(sock_, pkt.data(), pkt.size(), 0, (const sockaddr*)&dest_, sizeof(dest_));
+        sent_ += 1;
+    }
+
+    BenchParam param_;
+    int sock_ = -1;
+    uint32_t seq_;
+    std::mt19937 rng_;
+    sockaddr_in dest_;
+    std::vector<uint8_t> packet_;
+    std::vector<uint8_t> held_;
+    unsigned long sent_ = 0;
+    unsigned long dropped_ = 0;
+    std::atomic<uint32_t> frames_{0};
+};
+
+
+/*
+ * Check one received UYVY frame against the generator pattern
+ */
+void checkFrame(const BenchParam& param, const uint8_t* frame, BenchResult* result)
+{
+    const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+    const int lineBytes = param.width * 2;
+
+    // The newest frame index found in the lines is the frame being delivered
+    uint32_t newest = 0;
+    for(int y=0; y<param.height; ++y) {
+        uint32_t index;
+        memcpy(&index, frame + y * lineBytes, sizeof(index));
+        newest = std::max(newest, index);
+    }
+
+    int lines = 0;
+    for(int y=0; y<param.height; ++y) {
+        uint32_t index;
+        memcpy(&index, frame + y * lineBytes, sizeof(index));
+        if(index == newest && frame[y * lineBytes + lineBytes - 1] == ((newest + y) & 0xff)) {
+            lines += 1;
+        }
+    }
+
+    const double completeness = (double)lines / param.height;
+    result->frames += 1;
+    result->completenessSum += completeness;
+    if(lines == param.height) {
+        result->complete += 1;
+    }
+
+    const int64_t sent = frameSendTime[newest % SEND_TIME_HISTORY];
+    if(sent > 0 && now >= sent) {
+        result->latencyMs.push_back((now - sent) / 1.0e6);
+    }
+}
+
+void runGstCamera(const BenchParam& param, BenchResult* result)
+{
+    std::ostringstream ss;
+    ss << "udpsrc port=" << param.port << " buffer-size=8388608 caps=\"application/x-rtp, media=(string)video, "
+       << "clock-rate=(int)90000, encoding-name=(string)RAW, sampling=(string)YCbCr-4:2:2, depth=(string)8, "
+       << "width=(string)" << param.width << ", height=(string)" << param.height << ", payload=(int)96\" ! ";
+    if(param.jitterMs > 0) {
+        ss << "rtpjitterbuffer latency=" << param.jitterMs << " ! ";
+    }
+    ss << "rtpvrawdepay ! appsink name=mysink sync=false";
+
+    GstCameraParam params;
+    params.launchStr_ = ss.str();
+
+    GstCamera camera;
+    if( !camera.Init(params) || !camera.Open() ) {
+        printf("GstCamera -- failed to open udpsrc pipeline\n");
+        return;
+    }
+
+    while(running) {
+        void* imgCPU = NULL;
+        if( !camera.Capture(&imgCPU, NULL, 500) ) {
+            result->timeouts += 1;
+            continue;
+        }
+        if(camera.GetWidth() != param.width || camera.GetHeight() != param.height) {
+            continue;
+        }
+        checkFrame(param, (const uint8_t*)imgCPU, result);
+    }
+}
+
+
+double percentile(std::vector<double> values, double p)
+{
+    if(values.empty()) {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    const size_t idx = std::min(values.size() - 1, (size_t)(p * (values.size() - 1) + 0.5));
+    return values[idx];
+}
+
+void printResult(const BenchParam& param, const BenchResult& result, uint32_t sentFrames)
+{
+    const double frameBytes = (double)param.width * param.height * 2;
+    const double fps = (double)result.frames / param.seconds;
+
+    printf("%-10s frames %6lu/%-6u  %7.2f fps  %8.2f MB/s  complete %6.2f%%  mean fill %6.2f%%  "
+           "latency p50 %7.2f ms  p99 %7.2f ms  timeouts %lu\n",
+           result.name.c_str(), result.frames, sentFrames, fps, fps * frameBytes / 1.0e6,
+           result.frames ? 100.0 * result.complete / result.frames : 0.0,
+           result.frames ? 100.0 * result.completenessSum / result.frames : 0.0,
+           percentile(result.latencyMs, 0.50), percentile(result.latencyMs, 0.99),
+           result.timeouts);
+}
+
+bool parseArgs(int argc, char const *argv[], BenchParam* param)
+{
+    for(int i=1; i<argc; ++i) {
+        const std::string arg = argv[i];
+        if(i + 1 >= argc) {
+            printf("missing value for %s\n", arg.c_str());
+            return false;
+        }
+        const char* value = argv[++i];
+        if(arg == "--width")          param->width = atoi(value);
+        else if(arg == "--height")    param->height = atoi(value);
+        else if(arg == "--fps")       param->fps = atoi(value);
+        else if(arg == "--seconds")   param->seconds = atoi(value);
+        else if(arg == "--loss")      param->loss = atof(value);
+        else if(arg == "--reorder")   param->reorder = atof(value);
+        else if(arg == "--port")      param->port = atoi(value);
+        else if(arg == "--jitter-ms") param->jitterMs = atoi(value);
+        else {
+            printf("unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    if(param->width < 2 || param->width % 2 != 0 || param->height < 1 || param->fps < 1 || param->seconds < 1) {
+        printf("invalid geometry/rate\n");
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char const *argv[])
+{
+    BenchParam param;
+    if( !parseArgs(argc, argv, &param) ) {
+        return 1;
+    }
+    printf("bench_rtp_ingest: %dx%d @ %d fps, %d s, loss %.3f, reorder %.3f, port %d\n",
+           param.width, param.height, param.fps, param.seconds, param.loss, param.reorder, param.port);
+
+    for(int i=0; i<SEND_TIME_HISTORY; ++i) {
+        frameSendTime[i] = 0;
+    }
+
+    BenchResult gstResult;
+    gstResult.name = "GstCamera";
+    std::thread gstThread(runGstCamera, param, &gstResult);
+
+    // give the receivers time to bind and reach PLAYING
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    VrawGenerator generator(param);
+    if( !generator.Open() ) {
+        return 1;
+    }
+    std::thread genThread(&VrawGenerator::Run, &generator);
+
+    std::this_thread::sleep_for(std::chrono::seconds(param.seconds));
+    running = false;
+    genThread.join();
+
+    gstThread.join();
+    generator.Close();
+
+    printf("generator  frames %u  packets %lu  dropped %lu\n",
+           generator.SentFrames(), generator.SentPackets(), generator.DroppedPackets());
+    printResult(param, gstResult, generator.SentFrames());
+    return 0;
+}
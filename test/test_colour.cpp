@@ -0,0 +1,233 @@
+/*
+ * Checks the shared colour core: fixed point YCbCr -> RGB against the
+ * double precision ITU formulas for every matrix and range, reference
+ * colours, the RGB -> YCbCr round trip and the colorimetry parser
+ */
+#include "image/colour.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace mtsai::image;
+
+static const double kKr[3] = { 0.299, 0.2126, 0.2627 };
+static const double kKb[3] = { 0.114, 0.0722, 0.0593 };
+
+static ColourSpace makeColour(int matrix, int range)
+{
+    ColourSpace colour;
+    colour.matrix = (ColourMatrix)matrix;
+    colour.range = (ColourRange)range;
+    return colour;
+}
+
+static void referenceRgb(const ColourSpace& colour, int y, int cb, int cr, double* rgb)
+{
+    const double kr = kKr[colour.matrix], kb = kKb[colour.matrix];
+    const bool full = (colour.range == COLOUR_RANGE_FULL);
+    const double l  = (y - (full ? 0.0 : 16.0)) / (full ? 255.0 : 219.0);
+    const double pb = (cb - 128.0) / (full ? 255.0 : 224.0);
+    const double pr = (cr - 128.0) / (full ? 255.0 : 224.0);
+
+    rgb[0] = l + 2.0 * (1.0 - kr) * pr;
+    rgb[2] = l + 2.0 * (1.0 - kb) * pb;
+    rgb[1] = (l - kr * rgb[0] - kb * rgb[2]) / (1.0 - kr - kb);
+    for(int j = 0; j < 3; j++) {
+        rgb[j] = std::min(std::max(rgb[j] * 255.0, 0.0), 255.0);
+    }
+}
+
+// every YCbCr triplet on a coarse grid, at most 1 off the exact result
+static bool checkAccuracy(const ColourSpace& colour)
+{
+    const YuvToRgbCoeffs& k = GetYuvToRgbCoeffs(colour);
+    double worst = 0.0;
+
+    for(int y = 0; y < 256; y += 3) {
+        for(int cb = 0; cb < 256; cb += 5) {
+            for(int cr = 0; cr < 256; cr += 5) {
+                uint8_t rgb[3];
+                double ref[3];
+
+                YuvToRgb(k, y, cb, cr, &rgb[0], &rgb[1], &rgb[2]);
+                referenceRgb(colour, y, cb, cr, ref);
+                for(int j = 0; j < 3; j++) {
+                    worst = std::max(worst, fabs(rgb[j] - ref[j]));
+                }
+            }
+        }
+    }
+
+    const bool ok = worst <= 1.0;
+    printf("%-15s yuv -> rgb max diff %.3f  %s\n", ColourSpaceName(colour), worst, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+// RGB -> YCbCr -> RGB with full resolution chroma
+static bool checkRoundTrip(const ColourSpace& colour)
+{
+    const YuvToRgbCoeffs& to = GetYuvToRgbCoeffs(colour);
+    const RgbToYuvCoeffs& from = GetRgbToYuvCoeffs(colour);
+    int worst = 0;
+
+    for(int r = 0; r < 256; r += 15) {
+        for(int g = 0; g < 256; g += 15) {
+            for(int b = 0; b < 256; b += 15) {
+                uint8_t y, cb, cr, rgb[3];
+
+                RgbToYuv(from, r, g, b, &y, &cb, &cr);
+                YuvToRgb(to, y, cb, cr, &rgb[0], &rgb[1], &rgb[2]);
+                worst = std::max(worst, std::max(abs(rgb[0] - r), std::max(abs(rgb[1] - g), abs(rgb[2] - b))));
+            }
+        }
+    }
+
+    // limited range quantises to fewer codes, the round trip loses more
+    const int tolerance = (colour.range == COLOUR_RANGE_FULL) ? 2 : 3;
+    const bool ok = worst <= tolerance;
+    printf("%-15s round trip max diff %d  %s\n", ColourSpaceName(colour), worst, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+static bool checkColours()
+{
+    struct Sample { int matrix, range, y, cb, cr, r, g, b; };
+
+    // black, white and the 75% bars of the BT.601 / BT.709 test signals
+    const Sample samples[] = {
+        { COLOUR_BT601,  COLOUR_RANGE_LIMITED,  16, 128, 128,   0,   0,   0 },
+        { COLOUR_BT601,  COLOUR_RANGE_LIMITED, 235, 128, 128, 255, 255, 255 },
+        { COLOUR_BT601,  COLOUR_RANGE_LIMITED,  65, 100, 212, 191,   0,   0 },
+        { COLOUR_BT601,  COLOUR_RANGE_FULL,      0, 128, 128,   0,   0,   0 },
+        { COLOUR_BT601,  COLOUR_RANGE_FULL,    255, 128, 128, 255, 255, 255 },
+        { COLOUR_BT709,  COLOUR_RANGE_LIMITED,  51, 109, 212, 191,   0,   0 },
+        { COLOUR_BT709,  COLOUR_RANGE_LIMITED, 133,  63,  52,   0, 191,   0 },
+        { COLOUR_BT709,  COLOUR_RANGE_LIMITED,  28, 212, 120,   0,   0, 191 },
+    };
+    bool ok = true;
+
+    for(const Sample& s : samples) {
+        uint8_t rgb[3];
+        YuvToRgb(GetYuvToRgbCoeffs(makeColour(s.matrix, s.range)), s.y, s.cb, s.cr, &rgb[0], &rgb[1], &rgb[2]);
+
+        if(abs(rgb[0] - s.r) > 1 || abs(rgb[1] - s.g) > 1 || abs(rgb[2] - s.b) > 1) {
+            printf("  %s (%d %d %d) -> (%d %d %d) expected (%d %d %d)\n",
+                   ColourSpaceName(makeColour(s.matrix, s.range)), s.y, s.cb, s.cr, rgb[0], rgb[1], rgb[2], s.r, s.g, s.b);
+            ok = false;
+        }
+    }
+
+    printf("reference colours %s\n", ok ? "ok" : "FAILED");
+    return ok;
+}
+
+// the float matrix is the same conversion without rounding
+static bool checkMatrix(const ColourSpace& colour)
+{
+    const YuvToRgbCoeffs& k = GetYuvToRgbCoeffs(colour);
+    float matrix[9], offset[3];
+    double worst = 0.0;
+
+    GetYuvToRgbMatrix(colour, matrix, offset);
+
+    for(int i = 0; i < 4096; i++) {
+        const int y = rand() & 0xFF, cb = rand() & 0xFF, cr = rand() & 0xFF;
+        uint8_t rgb[3];
+
+        YuvToRgb(k, y, cb, cr, &rgb[0], &rgb[1], &rgb[2]);
+        for(int j = 0; j < 3; j++) {
+            float v = matrix[j * 3] * y + matrix[j * 3 + 1] * cb + matrix[j * 3 + 2] * cr + offset[j];
+            v = std::min(std::max(v, 0.0f), 255.0f);
+            worst = std::max(worst, fabs(v - rgb[j]));
+        }
+    }
+
+    const bool ok = worst <= 0.5 + 1e-3;
+    printf("%-15s float matrix max diff %.3f  %s\n", ColourSpaceName(colour), worst, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+static bool checkUYVYRow()
+{
+    const size_t width = 64;
+    const RgbToYuvCoeffs& k = GetRgbToYuvCoeffs(ColourSpace());
+    std::vector<uint8_t> rgb(width * 3), uyvy(width * 2);
+    bool ok = true;
+
+    for(size_t i = 0; i < rgb.size(); i++) {
+        rgb[i] = (uint8_t)(rand() & 0xFF);
+    }
+    RGBtoUYVYRow(rgb.data(), 3, uyvy.data(), width, k);
+
+    for(size_t x = 0; x < width && ok; x += 2) {
+        const uint8_t* p0 = &rgb[x * 3];
+        const uint8_t* p1 = &rgb[(x + 1) * 3];
+        uint8_t y0, y1, cb, cr, unused;
+
+        RgbToYuv(k, p0[0], p0[1], p0[2], &y0, &unused, &unused);
+        RgbToYuv(k, p1[0], p1[1], p1[2], &y1, &unused, &unused);
+        RgbToYuv(k, (p0[0] + p1[0] + 1) >> 1, (p0[1] + p1[1] + 1) >> 1, (p0[2] + p1[2] + 1) >> 1, &unused, &cb, &cr);
+
+        const uint8_t* q = &uyvy[x * 2];
+        ok = (q[0] == cb && q[1] == y0 && q[2] == cr && q[3] == y1);
+    }
+
+    printf("RGB -> UYVY row %s\n", ok ? "ok" : "FAILED");
+    return ok;
+}
+
+static bool checkColorimetry()
+{
+    struct Case { const char* caps; bool valid; int matrix, range; };
+
+    const Case cases[] = {
+        { "bt601",       true,  COLOUR_BT601,  COLOUR_RANGE_LIMITED },
+        { "bt709",       true,  COLOUR_BT709,  COLOUR_RANGE_LIMITED },
+        { "bt2020",      true,  COLOUR_BT2020, COLOUR_RANGE_LIMITED },
+        { "sRGB",        true,  COLOUR_BT709,  COLOUR_RANGE_FULL    },
+        { "jpeg",        true,  COLOUR_BT601,  COLOUR_RANGE_FULL    },
+        { "1:4:0:0",     true,  COLOUR_BT601,  COLOUR_RANGE_FULL    },
+        { "2:3:5:1",     true,  COLOUR_BT709,  COLOUR_RANGE_LIMITED },
+        { "0:1:0:0",     false, COLOUR_BT709,  COLOUR_RANGE_FULL    },      // RGB matrix, keeps the previous
+        { "smpte-what",  false, COLOUR_BT709,  COLOUR_RANGE_FULL    },
+    };
+    bool ok = true;
+
+    for(const Case& c : cases) {
+        ColourSpace colour = makeColour(COLOUR_BT709, COLOUR_RANGE_FULL);
+        const bool valid = ParseColorimetry(c.caps, &colour);
+
+        if(valid != c.valid || colour.matrix != c.matrix || colour.range != c.range) {
+            printf("  colorimetry \"%s\" -> %s (%d)\n", c.caps, ColourSpaceName(colour), valid);
+            ok = false;
+        }
+    }
+
+    printf("colorimetry parser %s\n", ok ? "ok" : "FAILED");
+    return ok;
+}
+
+int main(int argc, char const *argv[])
+{
+    bool ok = true;
+
+    srand(1234);
+
+    for(int m = COLOUR_BT601; m <= COLOUR_BT2020; m++) {
+        for(int r = COLOUR_RANGE_LIMITED; r <= COLOUR_RANGE_FULL; r++) {
+            ok &= checkAccuracy(makeColour(m, r));
+            ok &= checkRoundTrip(makeColour(m, r));
+            ok &= checkMatrix(makeColour(m, r));
+        }
+    }
+    ok &= checkColours();
+    ok &= checkUYVYRow();
+    ok &= checkColorimetry();
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}
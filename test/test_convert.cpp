@@ -0,0 +1,351 @@
+/*
+ * Checks the CPU conversion backend against host transcriptions of the
+ * CUDA kernels in cuda/cudaYUV-NV12.cu and cuda/cudaRGB-NV12.cu, the YUV
+ * formats against the scalar math of image/colour.h
+ */
+#include "image/convert.h"
+#include "utils/mt_utils.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using mtsai::image::ColourSpace;
+using mtsai::image::ConvertBackend;
+using mtsai::image::YuvToRgbCoeffs;
+
+// per pixel YUV math of image/colour.h, the SIMD rows must match it exactly
+static void storeYuv(const YuvToRgbCoeffs& k, int y, int cb, int cr, float* out)
+{
+    uint8_t r, g, b;
+    mtsai::image::YuvToRgb(k, y, cb, cr, &r, &g, &b);
+
+    out[0] = r;
+    out[1] = g;
+    out[2] = b;
+    out[3] = 1.0f;
+}
+
+static void refNV12(const uint8_t* src, float* dst, uint32_t width, uint32_t height, const ColourSpace& colour)
+{
+    const YuvToRgbCoeffs& k = mtsai::image::GetYuvToRgbCoeffs(colour);
+    const uint32_t pitch = width;
+    const uint32_t chromaOffset = pitch * height;
+
+    for(uint32_t y = 0; y < height; y++) {
+        for(uint32_t x = 0; x < width; x += 2) {
+            uint32_t chromaCb = src[chromaOffset + (y >> 1) * pitch + x];
+            uint32_t chromaCr = src[chromaOffset + (y >> 1) * pitch + x + 1];
+
+            if((y & 1) && (y >> 1) < ((height >> 1) - 1)) {
+                chromaCb = (chromaCb + src[chromaOffset + ((y >> 1) + 1) * pitch + x    ] + 1) >> 1;
+                chromaCr = (chromaCr + src[chromaOffset + ((y >> 1) + 1) * pitch + x + 1] + 1) >> 1;
+            }
+
+            for(uint32_t i = 0; i < 2; i++) {
+                storeYuv(k, src[y * pitch + x + i], chromaCb, chromaCr, dst + (y * width + x + i) * 4);
+            }
+        }
+    }
+}
+
+static void refUYVY(const uint8_t* src, float* dst, uint32_t width, uint32_t height, const ColourSpace& colour)
+{
+    const YuvToRgbCoeffs& k = mtsai::image::GetYuvToRgbCoeffs(colour);
+    const uint32_t pitch = width * 2;
+
+    for(uint32_t y = 0; y < height; y++) {
+        for(uint32_t x = 0; x < width; x += 2) {
+            const uint8_t* p = src + y * pitch + x * 2;
+
+            for(uint32_t i = 0; i < 2; i++) {
+                storeYuv(k, p[1 + i * 2], p[0], p[2], dst + (y * width + x + i) * 4);
+            }
+        }
+    }
+}
+
+static void refRGB(const uint8_t* src, float* dst, uint32_t width, uint32_t height)
+{
+    for(uint32_t pixel = 0; pixel < width * height; pixel++) {
+        dst[pixel * 4]     = src[pixel * 3];
+        dst[pixel * 4 + 1] = src[pixel * 3 + 1];
+        dst[pixel * 4 + 2] = src[pixel * 3 + 2];
+        dst[pixel * 4 + 3] = 0.0f;
+    }
+}
+
+// the kernel reads past the image on the borders, only the interior is compared
+static void refBayer(const uint8_t* srcImage, float* dst, uint32_t width, uint32_t height)
+{
+    for(uint32_t y = 0; y < height - 1; y++) {
+        for(uint32_t x = 1; x < width - 1; x++) {
+            const int pixel = y * width + x;
+            const bool pixelOdd = ((pixel) % 2) ? true : false;
+            const bool lineOdd = (int)floor((double)(pixel / width)) % 2 ? false : true;
+            float* out = dst + pixel * 4;
+            int r, g, b;
+
+            if ((lineOdd) && (pixelOdd)) {
+                r = srcImage[pixel-1] + srcImage[pixel+1] /2;
+                g = srcImage[pixel];
+                b = srcImage[pixel+width];
+            } else if ((lineOdd) && (!pixelOdd)) {
+                r = srcImage[pixel];
+                g = srcImage[pixel-1] + srcImage[pixel+1] /2;
+                b = srcImage[pixel+width-1] + srcImage[pixel+width+1] / 2;
+            } else if ((!lineOdd) && (pixelOdd)) {
+                g = srcImage[pixel+1] + srcImage[pixel-1] / 2;
+                r = srcImage[pixel+width-1] + srcImage[pixel+width+1] / 2;
+                b = srcImage[pixel];
+            } else {
+                b = srcImage[pixel+1] + srcImage[pixel-1] / 2;
+                r = srcImage[pixel+width] + srcImage[pixel+width] / 2;
+                g = srcImage[pixel];
+            }
+
+            out[0] = r;
+            out[1] = g;
+            out[2] = b;
+            out[3] = 0.0f;
+        }
+    }
+}
+
+static bool compare(const char* name, const float* ref, const float* out,
+                    uint32_t width, uint32_t height, uint32_t border, float tolerance)
+{
+    size_t mismatches = 0;
+    float worst = 0.0f;
+
+    for(uint32_t y = 0; y < height - border; y++) {
+        for(uint32_t x = border; x < width - border; x++) {
+            for(uint32_t c = 0; c < 4; c++) {
+                const size_t i = (y * width + x) * 4 + c;
+                const float diff = fabsf(ref[i] - out[i]);
+
+                if(diff > tolerance) {
+                    if(mismatches++ < 4) {
+                        printf("  %s (%u,%u).%u ref %f got %f\n", name, x, y, c, ref[i], out[i]);
+                    }
+                }
+                worst = diff > worst ? diff : worst;
+            }
+        }
+    }
+
+    printf("%-8s %4ux%-4u max diff %g  %s\n", name, width, height, worst, mismatches ? "FAILED" : "ok");
+    return mismatches == 0;
+}
+
+// 8 bit output is the float output rounded and saturated, alpha 255
+static bool compare8(const char* name, const float* ref, const uint8_t* out, uint32_t width, uint32_t height)
+{
+    size_t mismatches = 0;
+
+    for(size_t i = 0; i < (size_t)width * height * 4; i++) {
+        const long q = (i % 4 == 3) ? 255 : lrintf(ref[i]);
+        const long expect = q < 0 ? 0 : q > 255 ? 255 : q;
+
+        if(out[i] != expect && mismatches++ < 4) {
+            printf("  %s [%zu] ref %f got %u\n", name, i, ref[i], out[i]);
+        }
+    }
+
+    printf("%-8s %4ux%-4u rgba8  %s\n", name, width, height, mismatches ? "FAILED" : "ok");
+    return mismatches == 0;
+}
+
+static bool testRGBA8(ConvertBackend* backend, uint32_t width, uint32_t height)
+{
+    std::vector<uint8_t> src(width * height * 3 + 16);
+    std::vector<float> ref(width * height * 4);
+    std::vector<uint8_t> out8(width * height * 4);
+    std::vector<float> outF(width * height * 4);
+    bool ok = true;
+
+    for(size_t i = 0; i < src.size(); i++) {
+        src[i] = (uint8_t)(rand() & 0xFF);
+    }
+
+    ok &= backend->NV12toRGBAf(src.data(), ref.data(), width, height);
+    ok &= backend->NV12toRGBA((const uint8_t*)src.data(), (mtsai::image::PixelRGBA8*)out8.data(), width, height);
+    ok &= compare8("NV12", ref.data(), out8.data(), width, height);
+
+    ok &= backend->UYVYtoRGBAf(src.data(), ref.data(), width, height);
+    ok &= backend->UYVYtoRGBA(src.data(), out8.data(), mtsai::image::PIXEL_TYPE_RGBA8, width, height, ColourSpace());
+    ok &= compare8("UYVY", ref.data(), out8.data(), width, height);
+
+    ok &= backend->BayerGR8toRGBAf(src.data(), ref.data(), width, height);
+    ok &= backend->BayerGR8toRGBA(src.data(), out8.data(), mtsai::image::PIXEL_TYPE_RGBA8, width, height);
+    ok &= compare8("BayerGR8", ref.data(), out8.data(), width, height);
+
+    // inference boundary
+    ok &= backend->RGBA8toRGBAf(out8.data(), outF.data(), width, height);
+    size_t mismatches = 0;
+    for(size_t i = 0; i < outF.size(); i++) {
+        mismatches += (outF[i] != (float)out8[i]);
+    }
+    printf("%-8s %4ux%-4u -> f32 %s\n", "RGBA8", width, height, mismatches ? "FAILED" : "ok");
+
+    return ok && mismatches == 0;
+}
+
+// copies a packed frame into rows of stride bytes, NV12 chroma after a gap
+static void padFrame(const std::vector<uint8_t>& packed, uint32_t fourcc, uint32_t width, uint32_t height,
+                     size_t stride, std::vector<uint8_t>& padded, mtsai::image::FrameDescriptor* frame)
+{
+    const size_t row = mtsai::image::FrameRowBytes(fourcc, width, 0);
+
+    mtsai::image::DescribeFrame(fourcc, width, height, stride, frame);
+    if(fourcc == mtsai::image::FOURCC_NV12) {
+        frame->planes[1].offset += 64;
+        frame->planes[1].stride = stride + 16;
+    }
+
+    padded.assign(frame->planes[frame->planeCount - 1].offset + frame->planes[frame->planeCount - 1].stride * height, 0xA5);
+    for(uint32_t y = 0; y < height; y++) {
+        memcpy(&padded[y * stride], &packed[y * row], row);
+    }
+    if(fourcc == mtsai::image::FOURCC_NV12) {
+        for(uint32_t y = 0; y < height / 2; y++) {
+            memcpy(&padded[frame->planes[1].offset + y * frame->planes[1].stride], &packed[(height + y) * row], row);
+        }
+    }
+}
+
+// strided and reordered frames through ConvertFrame against the packed calls
+static bool testFrames(ConvertBackend* backend, uint32_t width, uint32_t height)
+{
+    using namespace mtsai::image;
+
+    std::vector<uint8_t> src(width * height * 3 + 16), swapped(src.size()), padded;
+    std::vector<uint8_t> ref(width * height * 4), out(width * height * 4);
+    FrameDescriptor frame;
+    bool ok = true;
+
+    for(size_t i = 0; i < src.size(); i++) {
+        src[i] = (uint8_t)(rand() & 0xFF);
+    }
+
+    struct Case { uint32_t fourcc; size_t bytesPerPixel; };
+    const Case cases[] = { { FOURCC_NV12, 1 }, { FOURCC_UYVY, 2 }, { FOURCC_YUYV, 2 },
+                           { FOURCC_RGB24, 3 }, { FOURCC_BGR24, 3 }, { FOURCC_GRBG8, 1 } };
+
+    for(const Case& c : cases) {
+        ColourSpace colour;
+        colour.matrix = COLOUR_BT709;
+
+        // YUYV and BGR hold the same pixels as UYVY and RGB with swapped bytes
+        swapped = src;
+        if(c.fourcc == FOURCC_YUYV) {
+            for(size_t i = 0; i + 1 < swapped.size(); i += 2) std::swap(swapped[i], swapped[i + 1]);
+        } else if(c.fourcc == FOURCC_BGR24) {
+            for(size_t i = 0; i + 2 < swapped.size(); i += 3) std::swap(swapped[i], swapped[i + 2]);
+        }
+
+        switch(c.fourcc) {
+        case FOURCC_NV12:   ok &= backend->NV12toRGBA(src.data(), ref.data(), PIXEL_TYPE_RGBA8, width, height, colour); break;
+        case FOURCC_GRBG8:  ok &= backend->BayerGR8toRGBA(src.data(), ref.data(), PIXEL_TYPE_RGBA8, width, height); break;
+        case FOURCC_UYVY:
+        case FOURCC_YUYV:   ok &= backend->UYVYtoRGBA(src.data(), ref.data(), PIXEL_TYPE_RGBA8, width, height, colour); break;
+        default:            ok &= backend->RGBtoRGBA(src.data(), ref.data(), PIXEL_TYPE_RGBA8, width, height); break;
+        }
+
+        padFrame(swapped, c.fourcc, width, height, width * c.bytesPerPixel + 13 + (c.bytesPerPixel & 1), padded, &frame);
+        frame.colour = colour;
+        std::fill(out.begin(), out.end(), 0);
+        ok &= backend->ConvertFrame(frame, padded.data(), out.data(), PIXEL_TYPE_RGBA8);
+
+        char name[5];
+        FourccToString(c.fourcc, name);
+        const bool same = (out == ref);
+        printf("%-8s %4ux%-4u stride %zu  %s\n", name, width, height, frame.planes[0].stride, same ? "ok" : "FAILED");
+        ok &= same;
+    }
+    return ok;
+}
+
+static bool testSize(ConvertBackend* backend, uint32_t width, uint32_t height)
+{
+    std::vector<uint8_t> src(width * height * 3 + 16);
+    std::vector<float> ref(width * height * 4);
+    float* out = (float*)backend->Alloc(width * height * 4 * sizeof(float));
+    bool ok = true;
+
+    for(size_t i = 0; i < src.size(); i++) {
+        src[i] = (uint8_t)(rand() & 0xFF);
+    }
+
+    // 4:2:x formats need even dimensions, checked for every matrix and range
+    for(int m = mtsai::image::COLOUR_BT601; m <= mtsai::image::COLOUR_BT2020 && !(width & 1) && !(height & 1); m++) {
+        for(int r = mtsai::image::COLOUR_RANGE_LIMITED; r <= mtsai::image::COLOUR_RANGE_FULL; r++) {
+            ColourSpace colour;
+            colour.matrix = (mtsai::image::ColourMatrix)m;
+            colour.range = (mtsai::image::ColourRange)r;
+
+            refNV12(src.data(), ref.data(), width, height, colour);
+            ok &= backend->NV12toRGBAf(src.data(), out, width, height, colour);
+            ok &= compare("NV12", ref.data(), out, width, height, 0, 0.0f);
+
+            refUYVY(src.data(), ref.data(), width, height, colour);
+            ok &= backend->UYVYtoRGBAf(src.data(), out, width, height, colour);
+            ok &= compare("UYVY", ref.data(), out, width, height, 0, 0.0f);
+        }
+    }
+
+    refRGB(src.data(), ref.data(), width, height);
+    ok &= backend->RGBtoRGBAf(src.data(), out, width, height);
+    ok &= compare("RGB", ref.data(), out, width, height, 0, 0.0f);
+
+    refBayer(src.data(), ref.data(), width, height);
+    ok &= backend->BayerGR8toRGBAf(src.data(), out, width, height);
+    ok &= compare("BayerGR8", ref.data(), out, width, height, 1, 0.0f);
+
+    backend->Free(out);
+    return ok;
+}
+
+int main(int argc, char const *argv[])
+{
+    ConvertBackend* backend = mtsai::image::GetCpuConvertBackend();
+    bool ok = true;
+
+    srand(1234);
+    printf("backend: %s\n", backend->Name());
+
+    ok &= testSize(backend, 640, 480);
+    ok &= testSize(backend, 34, 18);     // not a multiple of the vector width
+    ok &= testSize(backend, 6, 2);
+    ok &= testSize(backend, 37, 11);     // odd width flips the Bayer pixel parity per row
+    ok &= testRGBA8(backend, 640, 480);
+    ok &= testRGBA8(backend, 34, 18);
+    ok &= testFrames(backend, 640, 480);
+    ok &= testFrames(backend, 38, 18);
+
+    // throughput at 1080p
+    const uint32_t width = 1920, height = 1080;
+    std::vector<uint8_t> src(width * height * 3, 128);
+    float* out = (float*)backend->Alloc(width * height * 4 * sizeof(float));
+    const int iterations = 20;
+
+    double start = mtsai::utils::cpuSecond();
+    for(int i = 0; i < iterations; i++) {
+        backend->NV12toRGBAf(src.data(), out, width, height);
+    }
+    printf("NV12 1080p: %.2f ms\n", (mtsai::utils::cpuSecond() - start) * 1000.0 / iterations);
+
+    start = mtsai::utils::cpuSecond();
+    for(int i = 0; i < iterations; i++) {
+        backend->UYVYtoRGBAf(src.data(), out, width, height);
+    }
+    printf("UYVY 1080p: %.2f ms\n", (mtsai::utils::cpuSecond() - start) * 1000.0 / iterations);
+
+    backend->Free(out);
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}
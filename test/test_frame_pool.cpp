@@ -0,0 +1,110 @@
+/*
+ * Checks the frame buffer pool: slots sized by Reserve(), reuse for sizes
+ * that still fit, retire and recycle on a resolution change, huge page
+ * slots, external memory released on re-attach, memory staying bounded over
+ * many reconnects, and everything freed on teardown
+ */
+#include "image/frame_pool.h"
+
+#include <cstdio>
+#include <cstring>
+
+using namespace mtsai::image;
+
+static int released = 0;
+
+static void countRelease(void* handle)
+{
+    released++;
+    delete[] (uint8_t*)handle;
+}
+
+int main(int argc, char const *argv[])
+{
+    bool ok = true;
+    const size_t vga = 640 * 480 * 3 / 2;
+    const size_t hd = 1920 * 1080 * 3 / 2;
+
+    // sizes that fit keep the slots, a larger one retires them
+    {
+        FramePool pool(FRAME_MEMORY_MAPPED, 4);
+        bool sized = pool.Reserve(vga) && pool.Capacity() == vga && pool.CPU(3) != nullptr;
+        memset(pool.CPU(3), 0x80, vga);
+
+        sized &= pool.Reserve(vga - 1024) && pool.Stats().allocations == 4;
+        printf("reserve %zu bytes, same caps again allocates nothing  %s\n", vga, sized ? "ok" : "FAILED");
+        ok &= sized;
+
+        void* old = pool.CPU(0);
+        const bool grown = pool.Reserve(hd) && pool.Capacity() == hd && pool.Stats().retiredBytes == 4 * vga &&
+                           pool.Stats().slotBytes == 4 * hd && pool.CPU(0) != old;
+        pool.Recycle();
+        const bool recycled = pool.Stats().retiredBytes == 0 && pool.Stats().frees == 4;
+        printf("resolution change retires the old slots, recycle frees them  %s\n", grown && recycled ? "ok" : "FAILED");
+        ok &= grown && recycled;
+
+        // smaller than half the slot: reallocated, not kept
+        const bool shrunk = pool.Reserve(vga) && pool.Capacity() == vga && pool.Stats().allocations == 12;
+        printf("much smaller frame gets smaller slots  %s\n", shrunk ? "ok" : "FAILED");
+        ok &= shrunk;
+
+        pool.Release();
+        const FramePoolStats stats = pool.Stats();
+        const bool empty = !pool.Ready() && stats.slotBytes == 0 && stats.retiredBytes == 0 &&
+                           stats.allocations == stats.frees;
+        printf("release frees everything (%llu allocations, %llu frees)  %s\n", (unsigned long long)stats.allocations,
+               (unsigned long long)stats.frees, empty ? "ok" : "FAILED");
+        ok &= empty;
+    }
+
+    // huge page slots, explicit pages only when the system has some reserved
+    {
+        FramePool pool(FRAME_MEMORY_HUGEPAGE, 2);
+        const bool reserved = pool.Reserve(hd) && pool.CPU(0) != nullptr && pool.CUDA(0) == nullptr &&
+                              ((uintptr_t)pool.CPU(1) % 4096) == 0;
+        if(reserved) {
+            memset(pool.CPU(1), 0x10, hd);
+        }
+        printf("hugepage slots (%u on MAP_HUGETLB)  %s\n", pool.Stats().hugePages, reserved ? "ok" : "FAILED");
+        ok &= reserved;
+    }
+
+    // external memory goes back to its owner when the slot is reused or the pool goes
+    {
+        released = 0;
+        {
+            FramePool pool(FRAME_MEMORY_EXTERNAL, 3);
+            pool.Reserve(vga);
+            for(uint32_t i = 0; i < 7; i++) {
+                uint8_t* data = new uint8_t[64];
+                pool.Attach(i % 3, data, nullptr, 64, data, countRelease);
+            }
+            ok &= released == 4;
+        }
+        const bool returned = released == 7;
+        printf("external buffers released on re-attach and teardown  %s\n", returned ? "ok" : "FAILED");
+        ok &= returned;
+    }
+
+    // reconnect loop alternating caps: memory stays at one ring plus one retired ring
+    {
+        FramePool pool(FRAME_MEMORY_MAPPED, 4);
+        size_t peak = 0;
+
+        for(int i = 0; i < 200; i++) {
+            pool.Reserve((i / 10) % 2 ? hd : vga);
+            const FramePoolStats stats = pool.Stats();
+            peak = stats.slotBytes + stats.retiredBytes > peak ? stats.slotBytes + stats.retiredBytes : peak;
+            pool.Recycle();
+        }
+
+        const FramePoolStats stats = pool.Stats();
+        const bool bounded = peak <= 4 * (vga + hd) && stats.allocations - stats.frees == 4;
+        printf("200 reconnects, peak %zu bytes, %llu live allocations  %s\n", peak,
+               (unsigned long long)(stats.allocations - stats.frees), bounded ? "ok" : "FAILED");
+        ok &= bounded;
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,143 @@
+/*
+ * Checks the caps layout cache: layout of raw and bayer caps, no reparse
+ * for the same or equal caps, a new layout on a resolution change, caps
+ * without a size rejected, video meta applied per buffer, and the per frame
+ * cost of a cached lookup against parsing the caps every frame
+ */
+#include "gst_caps.h"
+
+#include <gst/video/video.h>
+
+#include <chrono>
+#include <cstdio>
+
+using namespace mtsai::gst;
+using namespace mtsai::image;
+
+static double nsPerCall(std::chrono::steady_clock::time_point start, int calls)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / calls;
+}
+
+int main(int argc, char *argv[])
+{
+    bool ok = true;
+
+    gst_init(&argc, &argv);
+
+    CapsLayout layout;
+    GstCaps* nv12 = gst_caps_from_string("video/x-raw,format=NV12,width=640,height=480,framerate=30/1");
+
+    // first caps are parsed, GstVideoInfo gives the plane layout
+    {
+        const CapsUpdate update = layout.Update(nv12);
+        const FrameDescriptor& frame = layout.Layout();
+
+        const bool parsed = update == CAPS_CHANGED && frame.fourcc == FOURCC_NV12 && frame.width == 640 &&
+                            frame.height == 480 && frame.planeCount == 2 && frame.planes[0].stride == 640 &&
+                            frame.planes[1].offset == 640 * 480 && frame.size == 640 * 480 * 3 / 2;
+        printf("NV12 640x480 layout  %s\n", parsed ? "ok" : "FAILED");
+        ok &= parsed;
+    }
+
+    // same object and an equal copy are not parsed again
+    {
+        GstCaps* copy = gst_caps_from_string("video/x-raw,format=NV12,width=640,height=480,framerate=30/1");
+
+        const bool same = layout.Update(nv12) == CAPS_SAME && layout.Update(copy) == CAPS_SAME &&
+                          layout.Update(nv12) == CAPS_SAME && layout.Parses() == 1;
+        printf("same and equal caps cached (%llu parses)  %s\n", (unsigned long long)layout.Parses(), same ? "ok" : "FAILED");
+        ok &= same;
+        gst_caps_unref(copy);
+    }
+
+    // renegotiated to another resolution
+    {
+        GstCaps* hd = gst_caps_from_string("video/x-raw,format=UYVY,width=1280,height=720");
+        const CapsUpdate update = layout.Update(hd);
+        const FrameDescriptor& frame = layout.Layout();
+
+        const bool changed = update == CAPS_CHANGED && layout.Parses() == 2 && frame.fourcc == FOURCC_UYVY &&
+                             frame.width == 1280 && frame.planeCount == 1 && frame.planes[0].stride == 2560 &&
+                             frame.size == 1280 * 720 * 2;
+        printf("resolution change to UYVY 1280x720  %s\n", changed ? "ok" : "FAILED");
+        ok &= changed;
+        gst_caps_unref(hd);
+    }
+
+    // bayer has no GstVideoInfo, packed rows from the fourcc
+    {
+        GstCaps* bayer = gst_caps_from_string("video/x-bayer,format=grbg,width=64,height=48");
+        const CapsUpdate update = layout.Update(bayer);
+        const FrameDescriptor& frame = layout.Layout();
+
+        const bool parsed = update == CAPS_CHANGED && frame.fourcc == FOURCC_GRBG8 && frame.planes[0].stride == 64 &&
+                            frame.size == 64 * 48;
+        printf("bayer grbg layout  %s\n", parsed ? "ok" : "FAILED");
+        ok &= parsed;
+        gst_caps_unref(bayer);
+    }
+
+    // no size: rejected, and the same caps are not parsed again
+    {
+        GstCaps* bad = gst_caps_from_string("video/x-raw,format=NV12");
+        const uint64_t parses = layout.Parses();
+
+        const bool rejected = layout.Update(bad) == CAPS_INVALID && !layout.Valid() &&
+                              layout.Update(bad) == CAPS_INVALID && layout.Parses() == parses + 1 &&
+                              layout.Update(NULL) == CAPS_INVALID;
+        printf("caps without width/height  %s\n", rejected ? "ok" : "FAILED");
+        ok &= rejected;
+        gst_caps_unref(bad);
+    }
+
+    // padded rows from the video meta override the caps layout
+    {
+        layout.Update(nv12);
+        FrameDescriptor frame = layout.Layout();
+
+        GstBuffer* buffer = gst_buffer_new_allocate(NULL, 704 * 480 * 3 / 2, NULL);
+        gsize offset[GST_VIDEO_MAX_PLANES] = {0, 704 * 480};
+        gint stride[GST_VIDEO_MAX_PLANES] = {704, 704};
+        gst_buffer_add_video_meta_full(buffer, GST_VIDEO_FRAME_FLAG_NONE, GST_VIDEO_FORMAT_NV12, 640, 480, 2, offset, stride);
+
+        const bool applied = ApplyVideoMeta(buffer, &frame) && frame.planes[0].stride == 704 &&
+                             frame.planes[1].offset == 704 * 480;
+        printf("video meta strides  %s\n", applied ? "ok" : "FAILED");
+        ok &= applied;
+        gst_buffer_unref(buffer);
+    }
+
+    // per frame cost, cached lookup against the old parse of every sample
+    {
+        const int calls = 200000;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        int same = 0;
+        for(int i = 0; i < calls; i++) {
+            same += layout.Update(nv12) == CAPS_SAME;
+        }
+        const double cached = nsPerCall(start, calls);
+
+        start = std::chrono::steady_clock::now();
+        int width = 0, height = 0;
+        for(int i = 0; i < calls; i++) {
+            const GstStructure* structure = gst_caps_get_structure(nv12, 0);
+            gst_structure_get_int(structure, "width", &width);
+            gst_structure_get_int(structure, "height", &height);
+            GstVideoInfo info;
+            gst_video_info_from_caps(&info, nv12);
+        }
+        const double parsed = nsPerCall(start, calls);
+
+        const bool faster = same == calls && cached < parsed;
+        printf("per frame: %.1f ns cached, %.1f ns parsed (%dx%d)  %s\n", cached, parsed, width, height,
+               faster ? "ok" : "FAILED");
+        ok &= faster;
+    }
+
+    gst_caps_unref(nv12);
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,96 @@
+/*
+ * Checks the pre-event clip ring on a GstCamera: a trigger writes a
+ * finished mp4 that starts at a keyframe about preSeconds_ before it and
+ * runs postSeconds_ past it
+ */
+#include "gst_camera.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+static bool hasElement(const char* name)
+{
+    GstElementFactory* factory = gst_element_factory_find(name);
+    if(factory) {
+        gst_object_unref(factory);
+    }
+    return factory != NULL;
+}
+
+static std::string readFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+int main(int argc, char *argv[])
+{
+    bool ok = true;
+
+    gst_init(&argc, &argv);
+    if(!hasElement("x264enc") || !hasElement("avdec_h264")) {
+        printf("x264enc / avdec_h264 not installed, SKIPPED\n");
+        return 77;
+    }
+
+    const std::string location = "/tmp/test_gst_clip.mp4";
+    remove(location.c_str());
+
+    GstCameraParam params;
+    params.launchStr_ = "videotestsrc is-live=true ! video/x-raw,width=320,height=240,framerate=30/1 ! "
+                        "x264enc tune=zerolatency speed-preset=ultrafast key-int-max=15 ! h264parse ! "
+                        "avdec_h264 ! videoconvert ! video/x-raw,format=NV12 ! appsink name=mysink";
+    params.clip_.preSeconds_ = 2;
+    params.clip_.postSeconds_ = 1;
+
+    GstCamera camera;
+    if(!camera.Init(params) || !camera.Open()) {
+        printf("clip camera failed to start  FAILED\n");
+        return 1;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(3500));
+
+    const bool triggered = camera.TriggerClip(location);
+    printf("trigger after 3.5 s  %s\n", triggered ? "ok" : "FAILED");
+    ok &= triggered;
+
+    // 1 s after the trigger plus the mux
+    std::vector<mtsai::gst::ClipInfo> clips;
+    for(int i = 0; i < 50; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        clips = camera.Clips();
+        if(!clips.empty() && clips.back().state != mtsai::gst::CLIP_WRITING) {
+            break;
+        }
+    }
+
+    const bool done = !clips.empty() && clips.back().state == mtsai::gst::CLIP_DONE;
+    printf("clip written  %s\n", done ? "ok" : "FAILED");
+    ok &= done;
+
+    if(done) {
+        // a keyframe at most 2 s old, with a GOP of 0.5 s
+        const mtsai::gst::ClipInfo& clip = clips.back();
+        const bool preroll = clip.preroll >= 1500 * GST_MSECOND && clip.preroll <= 2600 * GST_MSECOND;
+        printf("%.2f s before the trigger  %s\n", clip.preroll / 1e9, preroll ? "ok" : "FAILED");
+        ok &= preroll;
+
+        const bool span = clip.duration >= clip.preroll + 900 * GST_MSECOND;
+        printf("%.2f s in total  %s\n", clip.duration / 1e9, span ? "ok" : "FAILED");
+        ok &= span;
+
+        const bool finished = readFile(location).find("moov") != std::string::npos;
+        printf("%s finished  %s\n", location.c_str(), finished ? "ok" : "FAILED");
+        ok &= finished;
+    }
+
+    camera.Close();
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}
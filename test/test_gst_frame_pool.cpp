@@ -0,0 +1,173 @@
+/*
+ * Checks the proposed appsink pool: upstream (videotestsrc / videoconvert)
+ * writes into our slots when the pool is offered and into its own buffers
+ * when it is not, the video meta strides, the pool staying at its buffer
+ * count over many frames, a caps change reconfiguring it, and a caps change
+ * while a frame is still held staying in our (renewed) pool
+ */
+#include "gst_frame_pool.h"
+
+#include <gst/app/gstappsink.h>
+#include <gst/video/video.h>
+
+#include <cstdio>
+#include <string>
+
+using namespace mtsai::gst;
+
+struct Run
+{
+    int frames = 0;
+    int ours = 0;
+    bool meta = false;
+};
+
+static Run pull(const std::string& description, GstBufferPool* pool, int count)
+{
+    Run run;
+    GstElement* pipeline = gst_parse_launch(description.c_str(), NULL);
+    GstElement* sink = gst_bin_get_by_name(GST_BIN(pipeline), "mysink");
+
+    if(pool) {
+        ProposeAllocation(sink, pool);
+    }
+    gst_element_set_state(pipeline, GST_STATE_PLAYING);
+
+    for(int i = 0; i < count; i++) {
+        GstSample* sample = gst_app_sink_try_pull_sample(GST_APP_SINK(sink), 2 * GST_SECOND);
+        if(!sample) {
+            break;
+        }
+
+        GstBuffer* buffer = gst_sample_get_buffer(sample);
+        void* cpu = NULL;
+        void* cuda = NULL;
+        GstMapInfo map;
+
+        if(FrameBufferSlot(buffer, pool, &cpu, &cuda) && gst_buffer_map(buffer, &map, GST_MAP_READ)) {
+            run.ours += (map.data == cpu);
+            gst_buffer_unmap(buffer, &map);
+        }
+        run.meta |= gst_buffer_get_video_meta(buffer) != NULL;
+        run.frames++;
+        gst_sample_unref(sample);
+    }
+
+    gst_element_set_state(pipeline, GST_STATE_NULL);
+    gst_object_unref(sink);
+    gst_object_unref(pipeline);
+    return run;
+}
+
+static int sampleWidth(GstSample* sample)
+{
+    GstVideoInfo info;
+    return gst_video_info_from_caps(&info, gst_sample_get_caps(sample)) ? GST_VIDEO_INFO_WIDTH(&info) : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    bool ok = true;
+
+    gst_init(&argc, &argv);
+
+    const std::string convert = "videotestsrc num-buffers=300 ! video/x-raw,format=I420,width=640,height=480 ! "
+                                "videoconvert ! video/x-raw,format=NV12,width=640,height=480 ! "
+                                "appsink name=mysink sync=false max-buffers=2";
+
+    // without the proposal videoconvert allocates its own buffers
+    {
+        const Run run = pull(convert, NULL, 300);
+        const bool own = run.frames == 300 && run.ours == 0;
+        printf("no proposal: %d frames, %d in our pool  %s\n", run.frames, run.ours, own ? "ok" : "FAILED");
+        ok &= own;
+    }
+
+    // with it every frame lands in a slot, and the pool never grows past its count
+    {
+        GstBufferPool* pool = NewFrameBufferPool(mtsai::image::FRAME_MEMORY_MAPPED, 8, 2);
+        const Run run = pull(convert, pool, 300);
+
+        const uint64_t allocations = FrameBufferAllocations(pool);
+        const bool direct = run.frames == 300 && run.ours == 300 && allocations <= 8;
+        printf("proposed pool: %d frames, %d in our pool, %llu buffers allocated  %s\n", run.frames, run.ours,
+               (unsigned long long)allocations, direct ? "ok" : "FAILED");
+        ok &= direct;
+
+        // a restart with other caps reconfigures the same pool
+        const Run hd = pull("videotestsrc num-buffers=60 ! video/x-raw,format=NV12,width=1280,height=720 ! "
+                            "appsink name=mysink sync=false max-buffers=2", pool, 60);
+        const bool reconfigured = hd.frames == 60 && hd.ours == 60;
+        printf("same pool at 1280x720: %d frames, %d in our pool  %s\n", hd.frames, hd.ours,
+               reconfigured ? "ok" : "FAILED");
+        ok &= reconfigured;
+        gst_object_unref(pool);
+    }
+
+    // padded strides need the video meta, offered along with the pool
+    {
+        GstBufferPool* pool = NewFrameBufferPool(mtsai::image::FRAME_MEMORY_HUGEPAGE, 8, 2);
+        const Run run = pull("videotestsrc num-buffers=30 ! video/x-raw,format=I420,width=642,height=482 ! "
+                             "videoconvert ! video/x-raw,format=NV12 ! appsink name=mysink sync=false max-buffers=2",
+                             pool, 30);
+        const bool meta = run.frames == 30 && run.ours == 30 && run.meta;
+        printf("odd size with video meta in hugepage slots  %s\n", meta ? "ok" : "FAILED");
+        ok &= meta;
+        gst_object_unref(pool);
+    }
+
+    // caps change with a frame held: upstream keeps writing into our slots
+    {
+        GstBufferPool* pool = NewFrameBufferPool(mtsai::image::FRAME_MEMORY_MAPPED, 8, 2);
+        GstElement* pipeline = gst_parse_launch("videotestsrc ! capsfilter name=caps "
+                                                "caps=video/x-raw,format=NV12,width=320,height=240 ! "
+                                                "appsink name=mysink sync=false max-buffers=2", NULL);
+        GstElement* caps = gst_bin_get_by_name(GST_BIN(pipeline), "caps");
+        GstElement* sink = gst_bin_get_by_name(GST_BIN(pipeline), "mysink");
+
+        ProposeAllocation(sink, pool);
+        gst_element_set_state(pipeline, GST_STATE_PLAYING);
+
+        GstSample* held = gst_app_sink_try_pull_sample(GST_APP_SINK(sink), 2 * GST_SECOND);
+        void* heldCPU = NULL;
+        void* cuda = NULL;
+        const bool heldOurs = held && FrameBufferSlot(gst_sample_get_buffer(held), pool, &heldCPU, &cuda);
+
+        GstCaps* vga = gst_caps_from_string("video/x-raw,format=NV12,width=640,height=480");
+        g_object_set(caps, "caps", vga, NULL);
+        gst_caps_unref(vga);
+
+        int frames = 0, ours = 0;
+        for(int i = 0; i < 60 && frames < 30; i++) {
+            GstSample* sample = gst_app_sink_try_pull_sample(GST_APP_SINK(sink), 2 * GST_SECOND);
+            if(!sample) {
+                break;
+            }
+
+            // frames queued before the change still come at the old size
+            void* cpu = NULL;
+            if(sampleWidth(sample) == 640) {
+                frames++;
+                ours += FrameBufferSlot(gst_sample_get_buffer(sample), pool, &cpu, &cuda) && cpu != heldCPU;
+            }
+            gst_sample_unref(sample);
+        }
+
+        const bool renewed = heldOurs && frames == 30 && ours == 30;
+        printf("caps change with a frame held: %d frames, %d in our pool  %s\n", frames, ours,
+               renewed ? "ok" : "FAILED");
+        ok &= renewed;
+
+        if(held) {
+            gst_sample_unref(held);
+        }
+        gst_element_set_state(pipeline, GST_STATE_NULL);
+        gst_object_unref(caps);
+        gst_object_unref(sink);
+        gst_object_unref(pipeline);
+        gst_object_unref(pool);
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,183 @@
+/*
+ * Checks the RTSP server over loopback: three rtspsrc clients on a frame
+ * mount share one encoder, a fourth is refused by the viewer limit, per
+ * client and per mount stats, the encoder going away with the last
+ * viewer, and a launch mount (test source) served next to it
+ */
+#include "gst_rtsp_server.h"
+#include "image/frame_pool.h"
+
+#include <gst/app/gstappsink.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace mtsai::image;
+
+struct Viewer
+{
+    GstElement* pipeline = NULL;
+    GstElement* sink = NULL;
+};
+
+static Viewer watch(int port, const std::string& path)
+{
+    Viewer viewer;
+    const std::string launch = "rtspsrc location=rtsp://127.0.0.1:" + std::to_string(port) + path +
+                               " protocols=tcp latency=0 ! rtpjpegdepay ! appsink name=out sync=false max-buffers=4 drop=true";
+    viewer.pipeline = gst_parse_launch(launch.c_str(), NULL);
+    viewer.sink = gst_bin_get_by_name(GST_BIN(viewer.pipeline), "out");
+    gst_element_set_state(viewer.pipeline, GST_STATE_PLAYING);
+    return viewer;
+}
+
+static int receive(Viewer& viewer, int count, GstClockTime timeout)
+{
+    int received = 0;
+    for(int i = 0; i < count; i++) {
+        GstSample* sample = gst_app_sink_try_pull_sample(GST_APP_SINK(viewer.sink), timeout);
+        if(!sample) {
+            break;
+        }
+        received++;
+        gst_sample_unref(sample);
+    }
+    return received;
+}
+
+static void stop(Viewer& viewer)
+{
+    gst_element_set_state(viewer.pipeline, GST_STATE_NULL);
+    gst_object_unref(viewer.sink);
+    gst_object_unref(viewer.pipeline);
+}
+
+static void release(void* user)
+{
+}
+
+int main(int argc, char *argv[])
+{
+    bool ok = true;
+
+    gst_init(&argc, &argv);
+
+    GstRtspServerParam params;
+    params.service_ = "0";
+    params.maxViewers_ = 3;
+    GstRtspServer server(params);
+
+    GstOutputParam frames;
+    frames.launchStr_ = "appsrc name=mysrc ! videoconvert ! jpegenc ! rtpjpegpay name=pay0 pt=26";
+    GstOutput* output = server.MountFrames("/out", frames);
+    server.Mount("/test", "videotestsrc is-live=true ! video/x-raw,width=320,height=240 ! jpegenc ! "
+                          "rtpjpegpay name=pay0 pt=26");
+
+    if(!output || !server.Start()) {
+        printf("server failed to start  FAILED\n");
+        return 1;
+    }
+    const int port = server.BoundPort();
+
+    // the producer pushes at 30 fps whether anyone watches or not
+    FramePool pool(FRAME_MEMORY_HUGEPAGE, 4);
+    pool.Reserve(320 * 240 * 3 / 2);
+    for(uint32_t n = 0; n < pool.Count(); n++) {
+        memset(pool.CPU(n), 0x80, pool.Capacity());
+    }
+    std::atomic<bool> running{true};
+    std::thread producer([&]() {
+        for(uint32_t n = 0; running; n++) {
+            FrameDescriptor frame;
+            DescribeFrame(FOURCC_NV12, 320, 240, 0, &frame);
+            frame.cpu = pool.CPU(n % pool.Count());
+            frame.sequence = n;
+            frame.captureTime = FrameClockNow();
+            output->Push(frame, release, NULL, 0);
+            std::this_thread::sleep_for(std::chrono::milliseconds(33));
+        }
+    });
+
+    // unwatched: every frame refused, nothing encoded
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    {
+        const GstRtspServerStats stats = server.Stats();
+        const bool idle = stats.mounts[0].medias == 0 && stats.mounts[0].frames.pushed == 0 &&
+                          stats.mounts[0].frames.dropped > 0;
+        printf("no viewers: %llu frames refused, no media  %s\n",
+               (unsigned long long)stats.mounts[0].frames.dropped, idle ? "ok" : "FAILED");
+        ok &= idle;
+    }
+
+    // three viewers on one encoder
+    std::vector<Viewer> viewers;
+    for(int i = 0; i < 3; i++) {
+        viewers.push_back(watch(port, "/out"));
+    }
+    int everyone = 0;
+    for(Viewer& viewer : viewers) {
+        everyone += receive(viewer, 20, 5 * GST_SECOND) == 20;
+    }
+    {
+        const GstRtspServerStats stats = server.Stats();
+        const GstRtspMountStats& mount = stats.mounts[0];
+        bool clients = stats.clients == 3;
+        for(const GstRtspClientStats& client : stats.clientStats) {
+            clients &= client.address == "127.0.0.1" && client.playing && client.paths.size() == 1 &&
+                       client.paths[0] == "/out";
+        }
+        const bool shared = everyone == 3 && mount.medias == 1 && mount.viewers == 3 && clients;
+        printf("3 viewers: %d got 20 frames, %llu media, %u viewers  %s\n", everyone,
+               (unsigned long long)mount.medias, mount.viewers, shared ? "ok" : "FAILED");
+        ok &= shared;
+    }
+
+    // a fourth one is over the limit
+    {
+        Viewer extra = watch(port, "/out");
+        const int received = receive(extra, 1, 2 * GST_SECOND);
+        stop(extra);
+
+        const GstRtspServerStats stats = server.Stats();
+        const bool refused = received == 0 && stats.mounts[0].refused == 1 && stats.mounts[0].viewers == 3;
+        printf("4th viewer refused  %s\n", refused ? "ok" : "FAILED");
+        ok &= refused;
+    }
+
+    // the launch mount serves next to it
+    {
+        Viewer test = watch(port, "/test");
+        const bool served = receive(test, 10, 5 * GST_SECOND) == 10;
+        stop(test);
+        printf("launch mount /test  %s\n", served ? "ok" : "FAILED");
+        ok &= served;
+    }
+
+    // the last viewer gone, the media and its encoder go too
+    for(Viewer& viewer : viewers) {
+        stop(viewer);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    {
+        const GstRtspServerStats stats = server.Stats();
+        const uint64_t pushed = stats.mounts[0].frames.pushed;
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        const bool released = server.Stats().mounts[0].frames.pushed == pushed && stats.mounts[0].viewers == 0 &&
+                              stats.mounts[0].peakViewers == 3;
+        printf("viewers gone: pushing stopped at %llu frames  %s\n", (unsigned long long)pushed,
+               released ? "ok" : "FAILED");
+        ok &= released;
+    }
+
+    running = false;
+    producer.join();
+    server.Stop();
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,140 @@
+/*
+ * Checks the GStreamer bootstrap and the launch template cache: one init
+ * from many threads, factory extraction from launch strings, placeholder
+ * expansion, sixteen prerolled pipelines from one shared template (timed),
+ * a bad element rejected on every call without being kept, and the bound
+ * on templates
+ */
+#include "gst_runtime.h"
+#include "gst_state.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace mtsai::gst;
+
+static bool sameList(const std::vector<std::string>& a, const std::vector<std::string>& b)
+{
+    return a == b;
+}
+
+static double msSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char const *argv[])
+{
+    bool ok = true;
+
+    // concurrent bootstrap
+    {
+        std::vector<std::thread> threads;
+        std::vector<int> results(16, 0);
+        for(size_t i = 0; i < results.size(); i++) {
+            threads.emplace_back([&, i]() { results[i] = Init() ? 1 : 0; });
+        }
+        for(std::thread& t : threads) {
+            t.join();
+        }
+
+        bool all = true;
+        for(int r : results) all &= (r == 1);
+        printf("init from %zu threads  %s\n", results.size(), all ? "ok" : "FAILED");
+        ok &= all;
+    }
+
+    // factories of launch strings
+    {
+        const std::vector<std::string> rtsp = LaunchFactories(
+            "rtspsrc location=\"rtsp://10.0.0.2:554/a!b\" latency=0 ! rtph264depay ! h264parse ! avdec_h264 ! "
+            "videoconvert ! video/x-raw, format=(string)BGR ! appsink name=mysink");
+        const std::vector<std::string> tee = LaunchFactories(
+            "videotestsrc ! tee name=t ! queue ! fakesink t. ! queue ! fakesink location=${path}");
+
+        const bool parsed =
+            sameList(rtsp, {"rtspsrc", "rtph264depay", "h264parse", "avdec_h264", "videoconvert", "appsink"}) &&
+            sameList(tee, {"videotestsrc", "tee", "queue", "fakesink", "queue", "fakesink"});
+        printf("launch factories  %s\n", parsed ? "ok" : "FAILED");
+        ok &= parsed;
+    }
+
+    LaunchTemplateCache& cache = LaunchTemplateCache::Instance();
+    const std::string tmpl = "videotestsrc pattern=${pattern} num-buffers=${count} ! "
+                             "video/x-raw,width=64,height=48 ! appsink name=mysink";
+
+    // expansion, missing value
+    {
+        LaunchValues values = { {"pattern", "ball"}, {"count", "10"} };
+        std::string launch, error;
+        const bool expanded = cache.Expand(tmpl, values, &launch, &error) &&
+                              launch == "videotestsrc pattern=ball num-buffers=10 ! video/x-raw,width=64,height=48 ! appsink name=mysink";
+
+        values.erase("count");
+        const bool missing = !cache.Expand(tmpl, values, &launch, &error) && error == "no value for ${count}";
+
+        printf("template expansion  %s\n", expanded && missing ? "ok" : "FAILED");
+        ok &= expanded && missing;
+    }
+
+    // many cameras, one template, each pipeline runs
+    {
+        cache.Clear();
+        std::vector<GstElement*> pipelines;
+        const char* patterns[] = { "smpte", "snow", "ball", "black" };
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for(int i = 0; i < 16; i++) {
+            LaunchValues values = { {"pattern", patterns[i % 4]}, {"count", "5"} };
+            pipelines.push_back(cache.Instantiate(tmpl, values));
+        }
+        const double built = msSince(start);
+
+        bool all = cache.Size() == 1;
+        for(GstElement* p : pipelines) all &= (p != NULL);
+
+        const std::vector<StateChange> changes = SetStateAll(pipelines, GST_STATE_PAUSED, DeadlineIn(5000));
+        for(const StateChange& c : changes) all &= c.Ok();
+
+        printf("16 pipelines from 1 template in %.1f ms, prerolled  %s\n", built, all ? "ok" : "FAILED");
+        ok &= all;
+
+        for(GstElement* p : pipelines) {
+            if(p) {
+                gst_element_set_state(p, GST_STATE_NULL);
+                gst_object_unref(p);
+            }
+        }
+    }
+
+    // unknown element fails at the template, not at preroll
+    {
+        std::string error;
+        const size_t sizes = cache.Size();
+        GstElement* a = cache.Instantiate("videotestsrc ! nosuchelement ! fakesink", LaunchValues(), &error);
+        GstElement* b = cache.Instantiate("videotestsrc ! nosuchelement ! fakesink", LaunchValues(), &error);
+
+        const bool rejected = !a && !b && error == "no element \"nosuchelement\"" &&
+                              cache.Size() == sizes;
+        printf("unknown element: %s  %s\n", error.c_str(), rejected ? "ok" : "FAILED");
+        ok &= rejected;
+    }
+
+    // values written into the launch string: one template each, bounded
+    {
+        std::string launch;
+        for(size_t i = 0; i < 2 * LaunchTemplateCache::kMaxTemplates; i++) {
+            cache.Expand("videotestsrc num-buffers=" + std::to_string(i) + " ! fakesink", LaunchValues(), &launch);
+        }
+        const bool bounded = cache.Size() == LaunchTemplateCache::kMaxTemplates;
+        printf("%zu literal launch strings, %zu templates kept  %s\n", 2 * LaunchTemplateCache::kMaxTemplates, cache.Size(),
+               bounded ? "ok" : "FAILED");
+        ok &= bounded;
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}
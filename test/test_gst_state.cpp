@@ -0,0 +1,119 @@
+/*
+ * Checks the awaited state changes: parallel start of live test pipelines
+ * against one deadline, ASYNC_DONE of a prerolling pipeline, an ERROR during
+ * preroll, a pipeline that never prerolls hitting its deadline, and NULL
+ */
+#include "gst_state.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace mtsai::gst;
+
+static GstElement* launch(const std::string& description)
+{
+    GError* err = NULL;
+    GstElement* pipeline = gst_parse_launch(description.c_str(), &err);
+    if(err) {
+        printf("failed to launch %s: %s\n", description.c_str(), err->message);
+        g_error_free(err);
+    }
+    return pipeline;
+}
+
+static void release(GstElement* pipeline)
+{
+    if(pipeline) {
+        gst_element_set_state(pipeline, GST_STATE_NULL);
+        gst_object_unref(pipeline);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    bool ok = true;
+
+    gst_init(&argc, &argv);
+
+    // live sources in parallel, all against one deadline
+    {
+        const int count = 8;
+        std::vector<GstElement*> pipelines;
+        for(int i = 0; i < count; i++) {
+            pipelines.push_back(launch("videotestsrc is-live=true ! video/x-raw,width=320,height=240,framerate=30/1 ! "
+                                       "appsink sync=true"));
+        }
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        const std::vector<StateChange> changes = SetStateAll(pipelines, GST_STATE_PLAYING, DeadlineIn(5000));
+        const double total = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        double slowest = 0.0, sum = 0.0;
+        bool all = true;
+        for(const StateChange& change : changes) {
+            all &= change.Ok() && change.reached == GST_STATE_PLAYING;
+            slowest = std::max(slowest, change.elapsedMs);
+            sum += change.elapsedMs;
+        }
+
+        // the total follows the slowest one, not the sum
+        const bool parallel = all && total < slowest + 100.0;
+        printf("%d live pipelines PLAYING in %.1f ms (slowest %.1f, sum %.1f)  %s\n",
+               count, total, slowest, sum, parallel ? "ok" : "FAILED");
+        ok &= parallel;
+
+        const std::vector<StateChange> stops = SetStateAll(pipelines, GST_STATE_NULL, DeadlineIn(5000));
+        bool stopped = true;
+        for(const StateChange& change : stops) {
+            stopped &= change.result == STATE_CHANGED && change.reached == GST_STATE_NULL;
+        }
+        printf("%d pipelines back to NULL  %s\n", count, stopped ? "ok" : "FAILED");
+        ok &= stopped;
+
+        for(GstElement* pipeline : pipelines) {
+            release(pipeline);
+        }
+    }
+
+    // prerolling pipeline completes with ASYNC_DONE
+    {
+        GstElement* pipeline = launch("videotestsrc num-buffers=100 ! fakesink sync=true");
+        const StateChange change = SetState(pipeline, GST_STATE_PAUSED, DeadlineIn(5000));
+
+        const bool prerolled = change.result == STATE_CHANGED && change.reached == GST_STATE_PAUSED;
+        printf("preroll to PAUSED: %s in %.1f ms  %s\n", StateResultName(change.result), change.elapsedMs,
+               prerolled ? "ok" : "FAILED");
+        ok &= prerolled;
+        release(pipeline);
+    }
+
+    // caps that can not negotiate (videoconvert does not scale) post an ERROR while prerolling
+    {
+        GstElement* pipeline = launch("videotestsrc ! video/x-raw,width=320,height=240 ! videoconvert ! "
+                                      "video/x-raw,width=640,height=480 ! fakesink");
+        const StateChange change = SetState(pipeline, GST_STATE_PLAYING, DeadlineIn(5000));
+
+        const bool failed = change.result == STATE_FAILED && !change.error.empty() && change.elapsedMs < 5000.0;
+        printf("not negotiated: %s after %.1f ms (%s)  %s\n", StateResultName(change.result), change.elapsedMs,
+               change.error.c_str(), failed ? "ok" : "FAILED");
+        ok &= failed;
+        release(pipeline);
+    }
+
+    // appsrc without data never prerolls, the deadline ends the wait
+    {
+        GstElement* pipeline = launch("appsrc ! fakesink");
+        const StateChange change = SetState(pipeline, GST_STATE_PAUSED, DeadlineIn(200));
+
+        const bool timedOut = change.result == STATE_TIMEOUT && !change && change.elapsedMs >= 190.0 && change.elapsedMs < 400.0;
+        printf("no preroll: %s after %.1f ms  %s\n", StateResultName(change.result), change.elapsedMs,
+               timedOut ? "ok" : "FAILED");
+        ok &= timedOut;
+        release(pipeline);
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,207 @@
+/*
+ * Checks the block matching motion estimator against a scalar full search,
+ * recovers known shifts from NV12 and packed 4:2:2 luma, and times 1080p
+ * with one and with all worker threads
+ */
+#include "image/motion_estimate.h"
+#include "image/motion_field.h"
+#include "utils/mt_utils.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace mtsai::image;
+
+// textured background, a square of its own texture moved by (dx, dy)
+static std::vector<uint8_t> makeLuma(int width, int height, int sx, int sy, int size, int dx, int dy)
+{
+    std::vector<uint8_t> luma(width * height);
+    srand(1);
+    for(size_t i = 0; i < luma.size(); i++) {
+        luma[i] = (uint8_t)(rand() & 0xFF);
+    }
+
+    srand(2);
+    std::vector<uint8_t> patch(size * size);
+    for(size_t i = 0; i < patch.size(); i++) {
+        patch[i] = (uint8_t)(rand() & 0xFF);
+    }
+
+    for(int y = 0; y < size; y++) {
+        for(int x = 0; x < size; x++) {
+            const int px = sx + dx + x, py = sy + dy + y;
+            if(px < 0 || py < 0 || px >= width || py >= height) continue;
+            luma[py * width + px] = patch[y * size + x];
+        }
+    }
+    return luma;
+}
+
+static std::vector<uint8_t> pack422(const std::vector<uint8_t>& luma, bool uyvy)
+{
+    std::vector<uint8_t> packed(luma.size() * 2);
+    for(size_t i = 0; i < luma.size(); i++) {
+        packed[i * 2 + (uyvy ? 1 : 0)] = luma[i];
+        packed[i * 2 + (uyvy ? 0 : 1)] = (uint8_t)(i * 37);
+    }
+    return packed;
+}
+
+// the estimator's algorithm written out plainly
+static void reference(const std::vector<uint8_t>& prevLuma, const std::vector<uint8_t>& curLuma,
+                      int width, int height, int range, int noise, std::vector<float>& field)
+{
+    const int W = width / 2, H = height / 2;
+    std::vector<uint8_t> prev(W * H), cur(W * H);
+
+    for(int y = 0; y < H; y++) {
+        for(int x = 0; x < W; x++) {
+            const int i = y * 2 * width + x * 2;
+            prev[y * W + x] = (prevLuma[i] + prevLuma[i + 1] + prevLuma[i + width] + prevLuma[i + width + 1] + 2) / 4;
+            cur[y * W + x]  = (curLuma[i] + curLuma[i + 1] + curLuma[i + width] + curLuma[i + width + 1] + 2) / 4;
+        }
+    }
+
+    field.assign(W * H * 2, 0.0f);
+
+    for(int by = 0; by + 8 <= H; by += 8) {
+        for(int bx = 0; bx + 8 <= W; bx += 8) {
+            auto sad = [&](int dx, int dy) {
+                int s = 0;
+                for(int y = 0; y < 8; y++)
+                    for(int x = 0; x < 8; x++)
+                        s += abs(cur[(by + y) * W + bx + x] - prev[(by + y - dy) * W + bx + x - dx]);
+                return s;
+            };
+
+            int best = sad(0, 0), bestX = 0, bestY = 0;
+            if(best <= noise * 64) continue;
+
+            for(int dy = -range; dy <= range; dy++) {
+                for(int dx = -range; dx <= range; dx++) {
+                    if(by - dy < 0 || by - dy + 8 > H || bx - dx < 0 || bx - dx + 8 > W) continue;
+                    const int cost = sad(dx, dy) + 16 * (abs(dx) + abs(dy));
+                    if(cost < best) {
+                        best = cost;
+                        bestX = dx;
+                        bestY = dy;
+                    }
+                }
+            }
+
+            for(int y = 0; y < 8; y++) {
+                for(int x = 0; x < 8; x++) {
+                    field[((by + y) * W + bx + x) * 2]     = (float)(bestX * 2);
+                    field[((by + y) * W + bx + x) * 2 + 1] = (float)(bestY * 2);
+                }
+            }
+        }
+    }
+}
+
+static bool check(int width, int height, int dx, int dy, LumaLayout layout, int threads)
+{
+    const int sx = width / 3, sy = height / 3, size = 96;
+    const std::vector<uint8_t> prevLuma = makeLuma(width, height, sx, sy, size, 0, 0);
+    const std::vector<uint8_t> curLuma  = makeLuma(width, height, sx, sy, size, dx, dy);
+
+    std::vector<uint8_t> prev = prevLuma, cur = curLuma;
+    if(layout != LUMA_PLANAR) {
+        prev = pack422(prevLuma, layout == LUMA_UYVY);
+        cur  = pack422(curLuma, layout == LUMA_UYVY);
+    }
+
+    MotionEstimator estimator(8, threads);
+    std::vector<float> field(MotionEstimator::FieldSize(width, height), -1.0f), expect;
+
+    ImageView view;
+    view.width = width;
+    view.height = height;
+
+    view.data = prev.data();
+    bool ok = estimator.Estimate(view, layout, field.data());
+
+    bool zero = true;
+    for(float v : field) zero &= (v == 0.0f);
+
+    view.data = cur.data();
+    ok &= estimator.Estimate(view, layout, field.data());
+
+    reference(prevLuma, curLuma, width, height, 8, estimator.GetNoiseThreshold(), expect);
+    const bool same = (field == expect);
+
+    // a block well inside the square moved with it
+    const int W = width / 2;
+    const int cx = (sx + dx + size / 2) / 2 / 8 * 8, cy = (sy + dy + size / 2) / 2 / 8 * 8;
+    const float* v = field.data() + (cy * W + cx) * 2;
+    const bool found = (v[0] == dx && v[1] == dy);
+
+    ok &= zero && same && found;
+    printf("shift (%3d, %3d) %dx%d %s %d threads  %zu moving blocks  %s\n", dx, dy, width, height,
+           layout == LUMA_PLANAR ? "planar" : layout == LUMA_YUYV ? "YUYV  " : "UYVY  ", threads,
+           estimator.GetMovingBlocks(), ok ? "ok" : "FAILED");
+    return ok;
+}
+
+int main(int argc, char const *argv[])
+{
+    bool ok = true;
+
+    ok &= check(640, 480, 6, -4, LUMA_PLANAR, 1);
+    ok &= check(640, 480, 6, -4, LUMA_PLANAR, 4);
+    ok &= check(640, 480, -10, 8, LUMA_YUYV, 3);
+    ok &= check(650, 362, 14, 2, LUMA_UYVY, 2);
+    ok &= check(650, 362, -16, -16, LUMA_PLANAR, 8);
+
+    // a still scene stays still, frame after frame
+    {
+        const std::vector<uint8_t> luma = makeLuma(320, 240, 0, 0, 0, 0, 0);
+        MotionEstimator estimator;
+        std::vector<float> field(MotionEstimator::FieldSize(320, 240));
+        ImageView view;
+        view.data = (void*)luma.data();
+        view.width = 320;
+        view.height = 240;
+
+        estimator.Estimate(view, LUMA_PLANAR, field.data());
+        estimator.Estimate(view, LUMA_PLANAR, field.data());
+        const bool still = (estimator.GetMovingBlocks() == 0);
+        printf("still scene  %s\n", still ? "ok" : "FAILED");
+        ok &= still;
+    }
+
+    // 1080p NV12 into the CPU arrow renderer
+    {
+        const int width = 1920, height = 1080, iterations = 20;
+        const std::vector<uint8_t> a = makeLuma(width, height, 600, 400, 256, 0, 0);
+        const std::vector<uint8_t> b = makeLuma(width, height, 600, 400, 256, 8, 4);
+        std::vector<float> field(MotionEstimator::FieldSize(width, height));
+
+        ImageView view;
+        view.width = width;
+        view.height = height;
+
+        for(int threads = 1; threads <= 2; threads++) {
+            MotionEstimator estimator(8, threads == 1 ? 1 : 0);
+            double start = mtsai::utils::cpuSecond();
+
+            for(int i = 0; i < iterations; i++) {
+                view.data = (void*)((i & 1) ? b.data() : a.data());
+                estimator.Estimate(view, LUMA_PLANAR, field.data());
+            }
+            printf("1080p luma, %d thread(s): %.3f ms per frame\n", estimator.GetThreads(),
+                   (mtsai::utils::cpuSecond() - start) * 1000.0 / iterations);
+        }
+
+        MotionFieldRenderer renderer;
+        const size_t arrows = renderer.Analyse(field.data(), width, height);
+        const bool drawn = arrows > 0 && arrows <= (256 / 16 + 2) * (256 / 16 + 2);
+        printf("%zu arrows over the moving square  %s\n", arrows, drawn ? "ok" : "FAILED");
+        ok &= drawn;
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,206 @@
+/*
+ * Checks the CPU motion field renderer against a transcription of the
+ * cudaMotionFields kernel (atan2 sectors, per pixel sprite lookup) and
+ * times both on a 1080p field
+ */
+#include "image/motion_field.h"
+#include "utils/mt_utils.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace mtsai::image;
+
+static const uint8_t arrow_left[16][16] = {
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0}, {0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0}, {0,0,0,1,1,1,1,1,1,1,1,1,1,1,0,0},
+    {0,0,1,1,1,1,1,1,1,1,1,1,1,1,0,0}, {0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
+};
+
+static const uint8_t arrow_inbetween[16][16] = {
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0}, {0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0},
+    {0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0}, {0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0},
+    {0,0,0,0,1,1,0,0,1,1,0,0,0,0,0,0}, {0,0,0,0,1,1,0,0,0,1,1,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
+};
+
+// the kernel's sector test, 22.5 degree half width, wrapping at 360
+static int sector(float vx, float vy)
+{
+    float angle = atan2f(vx, vy) * (180.0f / (float)M_PI);
+    if(angle < 0) angle += 360.0f;
+
+    const float n = 22.5f;
+    if(angle < n || angle >= 360 - n) return MOTION_S;
+    if(angle >= 180 - n && angle < 180 + n) return MOTION_N;
+    if(angle >= 90 - n && angle < 90 + n) return MOTION_E;
+    if(angle >= 270 - n && angle < 270 + n) return MOTION_W;
+    if(angle < 90) return MOTION_SE;
+    if(angle < 180) return MOTION_NE;
+    if(angle < 270) return MOTION_NW;
+    return MOTION_SW;
+}
+
+static uint8_t lookup(const uint8_t table[16][16], int mapx, int mapy)
+{
+    return (mapx > 15 || mapy > 15) ? 0 : table[mapx][mapy];
+}
+
+template<typename T>
+static void reference(T* image, const float* field, int width, int height)
+{
+    static const uint8_t colour[3][3] = { {0x00, 0xff, 0x00}, {0xff, 0xbe, 0x00}, {0xff, 0x00, 0x00} };
+    const int pitch = width / 2 * 2;
+
+    for(int y = 0; y < height / 16; y++) {
+        for(int x = 0; x < width / 16; x++) {
+            const float* motion = field + y * pitch * 8 + x * 16;
+            if(motion[0] == 0 && motion[1] == 0) continue;
+
+            const int speed = (int)((fabsf(motion[0]) + fabsf(motion[1])) / 2);
+            if(speed <= 0) continue;
+
+            const int direction = sector(motion[0], motion[1]);
+            const uint8_t* rgb = colour[speed > 7 ? 2 : speed > 3 ? 1 : 0];
+
+            for(int pixy = 0; pixy < 16; pixy++) {
+                for(int pixx = 0; pixx < 16; pixx++) {
+                    uint8_t on = 0;
+                    switch(direction) {
+                    case MOTION_N:  on = lookup(arrow_left, pixx, pixy); break;
+                    case MOTION_W:  on = lookup(arrow_left, pixy, pixx); break;
+                    case MOTION_S:  on = lookup(arrow_left, pixx, 16 - pixy); break;
+                    case MOTION_E:  on = lookup(arrow_left, pixy, 16 - pixx); break;
+                    case MOTION_NW: on = lookup(arrow_inbetween, pixx, pixy); break;
+                    case MOTION_SE: on = lookup(arrow_inbetween, 16 - pixy, 16 - pixx); break;
+                    case MOTION_SW: on = lookup(arrow_inbetween, 16 - pixy, pixx); break;
+                    case MOTION_NE: on = lookup(arrow_inbetween, pixy, 16 - pixx); break;
+                    }
+                    if(!on) continue;
+
+                    T* p = image + ((y * 16 + pixy) * width + x * 16 + pixx) * 4;
+                    p[0] = rgb[0];
+                    p[1] = rgb[1];
+                    p[2] = rgb[2];
+                }
+            }
+        }
+    }
+}
+
+static std::vector<float> randomField(int width, int height)
+{
+    std::vector<float> field((width / 2) * (height / 2) * 2);
+
+    for(size_t i = 0; i < field.size(); i += 2) {
+        // a third of the vectors still, the rest up to 12 pixels either way
+        if(rand() % 3 == 0) continue;
+        field[i]     = (rand() % 2401 - 1200) / 100.0f;
+        field[i + 1] = (rand() % 2401 - 1200) / 100.0f;
+    }
+    return field;
+}
+
+template<typename T>
+static bool check(PixelType type, int width, int height)
+{
+    const std::vector<float> field = randomField(width, height);
+    std::vector<T> image(width * height * 4), expect;
+
+    for(size_t i = 0; i < image.size(); i++) {
+        image[i] = (T)(rand() & 0xFF);
+    }
+    expect = image;
+
+    ImageView view;
+    view.data = image.data();
+    view.width = width;
+    view.height = height;
+
+    MotionFieldRenderer renderer;
+    const bool drawn = renderer.Render(view, type, field.data());
+    reference(expect.data(), field.data(), width, height);
+
+    size_t diff = 0;
+    for(size_t i = 0; i < image.size(); i++) {
+        diff += (image[i] != expect[i]);
+    }
+
+    const bool ok = drawn && diff == 0;
+    printf("motion field %s %dx%d  %zu arrows  %zu values differ  %s\n", sizeof(T) == 1 ? "u8 " : "f32",
+           width, height, renderer.GetArrows().size(), diff, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+int main(int argc, char const *argv[])
+{
+    bool ok = true;
+
+    srand(7);
+
+    // the 8 compass points and the sector edges, including the arc just
+    // below 360 degrees the kernel left undrawn
+    {
+        MotionFieldRenderer renderer;
+        const float t = tanf(22.5f * (float)M_PI / 180.0f);
+        const float probes[][2] = {
+            { 0, 1 }, { 1, 1 }, { 1, 0 }, { 1, -1 }, { 0, -1 }, { -1, -1 }, { -1, 0 }, { -1, 1 },
+            { -0.2f, 1 }, { 0.2f, 1 }, { t * 0.99f, 1 }, { t * 1.01f, 1 }, { 1, t * 0.99f }, { -1, -t * 1.01f },
+        };
+
+        int bad = 0;
+        for(const auto& v : probes) {
+            if(renderer.Quantise(v[0], v[1]) != sector(v[0], v[1])) {
+                printf("  (%g, %g) -> %d, expected %d\n", v[0], v[1], renderer.Quantise(v[0], v[1]), sector(v[0], v[1]));
+                bad++;
+            }
+        }
+        const bool still = renderer.Quantise(0.0f, 0.0f) == MOTION_NONE;
+        printf("direction sectors  %s\n", (!bad && still) ? "ok" : "FAILED");
+        ok &= !bad && still;
+    }
+
+    ok &= check<uint8_t>(PIXEL_TYPE_RGBA8, 640, 480);
+    ok &= check<uint8_t>(PIXEL_TYPE_RGBA8, 1000, 250);
+    ok &= check<float>(PIXEL_TYPE_RGBAF, 640, 480);
+
+    // 1080p, a full field every frame
+    {
+        const int width = 1920, height = 1080, iterations = 50;
+        const std::vector<float> field = randomField(width, height);
+        std::vector<uint8_t> image(width * height * 4, 80);
+        ImageView view;
+        view.data = image.data();
+        view.width = width;
+        view.height = height;
+
+        double start = mtsai::utils::cpuSecond();
+        for(int i = 0; i < iterations; i++) {
+            reference(image.data(), field.data(), width, height);
+        }
+        const double perPixel = (mtsai::utils::cpuSecond() - start) * 1000.0 / iterations;
+
+        MotionFieldRenderer renderer;
+        start = mtsai::utils::cpuSecond();
+        for(int i = 0; i < iterations; i++) {
+            renderer.Render(view, PIXEL_TYPE_RGBA8, field.data());
+        }
+        const double sprites = (mtsai::utils::cpuSecond() - start) * 1000.0 / iterations;
+
+        printf("1080p field, atan2 + per pixel lookup: %.3f ms, sector LUT + sprites: %.3f ms\n", perPixel, sprites);
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}
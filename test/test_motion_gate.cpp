@@ -0,0 +1,198 @@
+/*
+ * Checks the frame difference gate: tile counts against a scalar count,
+ * hysteresis on a moving square, a single frame flash and sensor noise,
+ * dirty regions, forced refresh, and the per frame cost at 1080p
+ */
+#include "image/motion_gate.h"
+#include "utils/mt_utils.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace mtsai::image;
+
+// flat grey scene with +-noise, a white square at (sx, sy) when size > 0
+static void makeFrame(std::vector<uint8_t>& luma, int width, int height, int noise, int sx, int sy, int size)
+{
+    luma.resize(width * height);
+    for(int y = 0; y < height; y++) {
+        for(int x = 0; x < width; x++) {
+            int v = 100 + (noise ? rand() % (noise * 2 + 1) - noise : 0);
+            if(size > 0 && x >= sx && x < sx + size && y >= sy && y < sy + size) v = 230;
+            luma[y * width + x] = (uint8_t)v;
+        }
+    }
+}
+
+static std::vector<uint32_t> referenceCounts(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b,
+                                             int width, int height, int tileSize, int threshold)
+{
+    const int W = width / 2, H = height / 2, tile = tileSize / 2;
+    const int tilesX = (W + tile - 1) / tile, tilesY = (H + tile - 1) / tile;
+    std::vector<uint32_t> counts(tilesX * tilesY, 0);
+
+    for(int y = 0; y < H; y++) {
+        for(int x = 0; x < W; x++) {
+            const int i = y * 2 * width + x * 2;
+            const int pa = (a[i] + a[i + 1] + a[i + width] + a[i + width + 1] + 2) / 4;
+            const int pb = (b[i] + b[i + 1] + b[i + width] + b[i + width + 1] + 2) / 4;
+            counts[(y / tile) * tilesX + x / tile] += (abs(pa - pb) > threshold);
+        }
+    }
+    return counts;
+}
+
+int main(int argc, char const *argv[])
+{
+    bool ok = true;
+
+    srand(5);
+
+    // SIMD tile counts, odd sized frame with partial tiles, planar and YUYV
+    {
+        const int width = 646, height = 362;
+        std::vector<uint8_t> a(width * height), b(width * height);
+        for(size_t i = 0; i < a.size(); i++) {
+            a[i] = (uint8_t)(rand() & 0xFF);
+            b[i] = (uint8_t)((i % 5) ? a[i] : rand() & 0xFF);
+        }
+
+        MotionGateParams params;
+        const std::vector<uint32_t> expect = referenceCounts(a, b, width, height, params.tileSize, params.threshold);
+
+        for(int packed = 0; packed < 2; packed++) {
+            MotionGate gate(params);
+            std::vector<uint8_t> pa = a, pb = b;
+
+            if(packed) {
+                pa.assign(a.size() * 2, 128);
+                pb.assign(b.size() * 2, 128);
+                for(size_t i = 0; i < a.size(); i++) {
+                    pa[i * 2] = a[i];
+                    pb[i * 2] = b[i];
+                }
+            }
+
+            ImageView view;
+            view.width = width;
+            view.height = height;
+            view.data = pa.data();
+            gate.Update(view, packed ? LUMA_YUYV : LUMA_PLANAR);
+            view.data = pb.data();
+            gate.Update(view, packed ? LUMA_YUYV : LUMA_PLANAR);
+
+            const bool same = (gate.GetTileCounts() == expect);
+            printf("tile counts %s %zux%zu tiles  %s\n", packed ? "YUYV  " : "planar", gate.GetTilesX(),
+                   gate.GetTilesY(), same ? "ok" : "FAILED");
+            ok &= same;
+        }
+    }
+
+    // a square moves from frame 10 to 29, a one frame flash at 50, noise throughout
+    {
+        const int width = 640, height = 480;
+        MotionGateParams params;
+        params.onFrames = 3;
+        params.offFrames = 5;
+        MotionGate gate(params);
+
+        std::vector<uint8_t> luma;
+        ImageView view;
+        view.width = width;
+        view.height = height;
+
+        std::vector<int> processed;
+        bool regionsCover = true;
+
+        for(int f = 0; f < 70; f++) {
+            if(f >= 10 && f < 30) {
+                makeFrame(luma, width, height, 3, 100 + (f - 10) * 8, 200, 64);
+            } else if(f >= 30) {
+                makeFrame(luma, width, height, 3, 100 + 19 * 8, 200, 64);
+            } else {
+                makeFrame(luma, width, height, 3, 0, 0, 0);
+            }
+            if(f == 50) {
+                makeFrame(luma, width, height, 3, 400, 50, 100);
+            }
+
+            view.data = luma.data();
+            if(gate.Update(view, LUMA_PLANAR) == GATE_PROCESS) {
+                processed.push_back(f);
+            }
+
+            // the square's leading edge is inside one of the regions
+            if(f >= 12 && f < 30) {
+                const int ex = 100 + (f - 10) * 8 + 60, ey = 230;
+                bool inside = false;
+                for(const Rect& r : gate.GetDirtyRegions()) {
+                    inside |= (ex >= r.x && ex < r.x + r.width && ey >= r.y && ey < r.y + r.height);
+                }
+                regionsCover &= inside;
+            }
+        }
+
+        // frame 0 primes, the square moves from 10 and the gate opens at 12,
+        // last difference at 29, it closes on the 5th quiet frame. The flash differs from
+        // both of its neighbours, 2 active frames, below onFrames
+        std::vector<int> expect = { 0 };
+        for(int f = 12; f < 34; f++) expect.push_back(f);
+
+        const bool gated = (processed == expect);
+        printf("moving square processed frames %d..%d, %zu of 70, flash and noise skipped  %s\n",
+               processed.size() > 1 ? processed[1] : -1, processed.back(), processed.size(), gated ? "ok" : "FAILED");
+        printf("dirty regions follow the square  %s\n", regionsCover ? "ok" : "FAILED");
+        ok &= gated && regionsCover;
+    }
+
+    // forced refresh on a still scene
+    {
+        MotionGateParams params;
+        params.refreshFrames = 10;
+        MotionGate gate(params);
+
+        std::vector<uint8_t> luma;
+        makeFrame(luma, 320, 240, 0, 0, 0, 0);
+        ImageView view;
+        view.data = luma.data();
+        view.width = 320;
+        view.height = 240;
+
+        int count = 0;
+        bool whole = true;
+        for(int f = 0; f < 31; f++) {
+            if(gate.Update(view, LUMA_PLANAR) == GATE_PROCESS) {
+                count++;
+                whole &= (gate.GetDirtyRegions().size() == 1 && gate.GetDirtyRegions()[0].width == 320);
+            }
+        }
+        const bool refreshed = (count == 4 && whole && gate.GetFramesSkipped() == 27);
+        printf("still scene refreshed %d times in 31 frames  %s\n", count, refreshed ? "ok" : "FAILED");
+        ok &= refreshed;
+    }
+
+    // 1080p NV12 luma
+    {
+        const int width = 1920, height = 1080, iterations = 50;
+        std::vector<uint8_t> a, b;
+        makeFrame(a, width, height, 3, 0, 0, 0);
+        makeFrame(b, width, height, 3, 800, 500, 128);
+
+        MotionGate gate;
+        ImageView view;
+        view.width = width;
+        view.height = height;
+
+        const double start = mtsai::utils::cpuSecond();
+        for(int i = 0; i < iterations; i++) {
+            view.data = (i & 1) ? b.data() : a.data();
+            gate.Update(view, LUMA_PLANAR);
+        }
+        printf("1080p gate update: %.3f ms per frame, %zu regions\n",
+               (mtsai::utils::cpuSecond() - start) * 1000.0 / iterations, gate.GetDirtyRegions().size());
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -16,7 +16,11 @@ int main(int argc, char const *argv[])
     }
 
     while(true) {
-        gstCamera.Capture();
+        void* imgCPU = NULL;
+        void* imgCUDA = NULL;
+        if( !gstCamera.Capture(&imgCPU, &imgCUDA, 1000) ) {
+            printf("failed to capture frame\n");
+        }
     }
 
     return 0;
@@ -0,0 +1,199 @@
+/*
+ * Checks the span / tile rectangle overlay against a per pixel loop over
+ * all boxes, and times both on a crowded 1080p frame
+ */
+#include "image/overlay.h"
+#include "utils/mt_utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace mtsai::image;
+
+// pixel (x, y) is drawn by box b
+static bool covers(const OverlayBox& b, int x, int y)
+{
+    const int x0 = (int)ceilf(b.left), x1 = (int)floorf(b.right);
+    const int y0 = (int)ceilf(b.top),  y1 = (int)floorf(b.bottom);
+
+    if(x < x0 || x > x1 || y < y0 || y > y1) {
+        return false;
+    }
+    if(b.style == OVERLAY_FILL) {
+        return true;
+    }
+
+    const int t = b.thickness > 0 ? b.thickness : 1;
+    return x < x0 + t || x > x1 - t || y < y0 + t || y > y1 - t;
+}
+
+template<typename T>
+static void reference(T* image, int width, int height, const std::vector<OverlayBox>& boxes)
+{
+    for(int y = 0; y < height; y++) {
+        for(int x = 0; x < width; x++) {
+            T* px = image + (y * width + x) * 4;
+
+            for(const OverlayBox& b : boxes) {
+                if(!covers(b, x, y)) continue;
+
+                const uint8_t color[3] = { b.color.r, b.color.g, b.color.b };
+                for(int c = 0; c < 3; c++) {
+                    if(sizeof(T) == 1) {
+                        px[c] = (T)((px[c] * (255 - b.color.a) + color[c] * b.color.a + 127) / 255);
+                    } else {
+                        const float a = b.color.a / 255.0f;
+                        px[c] = px[c] * (1.0f - a) + color[c] * a;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// shape of the old gpuRectOutlines kernel, every pixel tests every box
+static void perPixel(uint8_t* image, int width, int height, const std::vector<OverlayBox>& boxes)
+{
+    for(int y = 0; y < height; y++) {
+        for(int x = 0; x < width; x++) {
+            uint8_t* px = image + (y * width + x) * 4;
+
+            for(const OverlayBox& b : boxes) {
+                if(x >= b.left && x <= b.right && y >= b.top && y <= b.bottom) {
+                    px[0] = (uint8_t)((px[0] * (255 - b.color.a) + b.color.r * b.color.a) / 255);
+                    px[1] = (uint8_t)((px[1] * (255 - b.color.a) + b.color.g * b.color.a) / 255);
+                    px[2] = (uint8_t)((px[2] * (255 - b.color.a) + b.color.b * b.color.a) / 255);
+                }
+            }
+        }
+    }
+}
+
+static std::vector<OverlayBox> randomBoxes(int count, int width, int height)
+{
+    std::vector<OverlayBox> boxes(count);
+
+    for(OverlayBox& b : boxes) {
+        // some boxes hang off every edge
+        b.left   = (rand() % (width + 40)) - 20 + (rand() % 100) / 100.0f;
+        b.top    = (rand() % (height + 40)) - 20 + (rand() % 100) / 100.0f;
+        b.right  = b.left + rand() % (width / 3);
+        b.bottom = b.top + rand() % (height / 3);
+        b.color  = { (uint8_t)rand(), (uint8_t)rand(), (uint8_t)rand(), (uint8_t)(rand() % 256) };
+        b.style  = (rand() % 3) ? OVERLAY_OUTLINE : OVERLAY_FILL;
+        b.thickness = rand() % 6;
+    }
+    return boxes;
+}
+
+template<typename T>
+static bool check(PixelType type, int width, int height, int count, RectOverlay& overlay)
+{
+    const std::vector<OverlayBox> boxes = randomBoxes(count, width, height);
+    std::vector<T> image(width * height * 4), expect;
+
+    for(size_t i = 0; i < image.size(); i++) {
+        image[i] = (T)(rand() & 0xFF);
+    }
+    expect = image;
+
+    ImageView view;
+    view.data = image.data();
+    view.width = width;
+    view.height = height;
+
+    const bool drawn = overlay.Draw(view, type, boxes);
+    reference(expect.data(), width, height, boxes);
+
+    double worst = 0.0;
+    for(size_t i = 0; i < image.size(); i++) {
+        worst = std::max(worst, fabs((double)image[i] - (double)expect[i]));
+    }
+
+    const bool ok = drawn && worst <= (sizeof(T) == 1 ? 0.0 : 1e-3);
+    printf("draw %s %4dx%-4d %3d boxes  max diff %g  %s\n", sizeof(T) == 1 ? "u8 " : "f32",
+           width, height, count, worst, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+// every covered pixel must find its boxes, in order, in the list of its tile
+static bool checkBins(int width, int height, int count, RectOverlay& overlay)
+{
+    const std::vector<OverlayBox> boxes = randomBoxes(count, width, height);
+    overlay.Bin(boxes.data(), boxes.size(), width, height);
+
+    const int ts = overlay.GetTileSize();
+    const int tilesX = (width + ts - 1) / ts;
+    const std::vector<uint32_t>& start = overlay.GetTileStart();
+    const std::vector<uint32_t>& index = overlay.GetTileIndex();
+    size_t missing = 0;
+
+    for(int y = 0; y < height; y++) {
+        for(int x = 0; x < width; x++) {
+            const size_t tile = (y / ts) * tilesX + x / ts;
+            uint32_t k = start[tile];
+
+            for(size_t n = 0; n < boxes.size(); n++) {
+                if(!covers(boxes[n], x, y)) continue;
+
+                while(k < start[tile + 1] && index[k] != n) k++;
+                if(k == start[tile + 1]) {
+                    missing++;
+                    break;
+                }
+            }
+        }
+    }
+
+    printf("bin  %4dx%-4d %3d boxes -> %zu tile entries  %s\n", width, height, count, index.size(),
+           missing ? "FAILED" : "ok");
+    return missing == 0;
+}
+
+int main(int argc, char const *argv[])
+{
+    RectOverlay overlay;
+    bool ok = true;
+
+    srand(4321);
+
+    ok &= check<uint8_t>(PIXEL_TYPE_RGBA8, 320, 240, 40, overlay);
+    ok &= check<uint8_t>(PIXEL_TYPE_RGBA8, 97, 61, 25, overlay);
+    ok &= check<float>(PIXEL_TYPE_RGBAF, 320, 240, 40, overlay);
+    ok &= check<float>(PIXEL_TYPE_RGBAF, 97, 61, 25, overlay);
+    ok &= checkBins(320, 240, 60, overlay);
+    ok &= checkBins(97, 61, 25, overlay);
+
+    // crowded scene, outlines of 300 detections on 1080p
+    {
+        const int width = 1920, height = 1080, count = 300;
+        std::vector<OverlayBox> boxes = randomBoxes(count, width, height);
+        for(OverlayBox& b : boxes) {
+            b.style = OVERLAY_OUTLINE;
+            b.thickness = 2;
+        }
+
+        std::vector<uint8_t> image(width * height * 4, 64);
+        ImageView view;
+        view.data = image.data();
+        view.width = width;
+        view.height = height;
+
+        double start = mtsai::utils::cpuSecond();
+        perPixel(image.data(), width, height, boxes);
+        printf("per pixel loop, %d boxes: %.2f ms\n", count, (mtsai::utils::cpuSecond() - start) * 1000.0);
+
+        const int iterations = 20;
+        start = mtsai::utils::cpuSecond();
+        for(int i = 0; i < iterations; i++) {
+            overlay.Draw(view, PIXEL_TYPE_RGBA8, boxes);
+        }
+        printf("spans,          %d boxes: %.2f ms\n", count, (mtsai::utils::cpuSecond() - start) * 1000.0 / iterations);
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,221 @@
+/*
+ * Checks the fused convert + resize + normalize stage against a plain
+ * double precision reference, and times it against the separate passes
+ */
+#include "image/convert.h"
+#include "image/preprocess.h"
+#include "utils/mt_utils.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace mtsai::image;
+
+static const char* formatName(PixelFormat format)
+{
+    switch(format) {
+    case PIXEL_NV12: return "NV12";
+    case PIXEL_UYVY: return "UYVY";
+    case PIXEL_YUYV: return "YUYV";
+    case PIXEL_RGB:  return "RGB";
+    case PIXEL_BGR:  return "BGR";
+    }
+    return "?";
+}
+
+// component k of the source frame at sample (x, y) of its own plane
+static double fetch(const std::vector<uint8_t>& src, const PreprocessParams& p, int k, int x, int y)
+{
+    const size_t w = p.srcWidth, h = p.srcHeight;
+
+    switch(p.format) {
+    case PIXEL_NV12:
+        return k == 0 ? src[y * w + x] : src[w * h + y * w + x * 2 + (k - 1)];
+    case PIXEL_UYVY:
+        return k == 0 ? src[y * w * 2 + x * 2 + 1] : src[y * w * 2 + x * 4 + (k == 1 ? 0 : 2)];
+    case PIXEL_YUYV:
+        return k == 0 ? src[y * w * 2 + x * 2] : src[y * w * 2 + x * 4 + (k == 1 ? 1 : 3)];
+    case PIXEL_RGB:
+        return src[(y * w + x) * 3 + k];
+    case PIXEL_BGR:
+        return src[(y * w + x) * 3 + 2 - k];
+    }
+    return 0.0;
+}
+
+static double sample(const std::vector<uint8_t>& src, const PreprocessParams& p, int k, int dx, int dy)
+{
+    const bool chroma = (k > 0) && (p.format == PIXEL_NV12 || p.format == PIXEL_UYVY || p.format == PIXEL_YUYV);
+    const int shiftX = chroma ? 1 : 0;
+    const int shiftY = (chroma && p.format == PIXEL_NV12) ? 1 : 0;
+    const int sw = p.srcWidth >> shiftX;
+    const int sh = p.srcHeight >> shiftY;
+
+    double px = ((dx + 0.5) * p.srcWidth / p.dstWidth) / (1 << shiftX) - 0.5;
+    double py = ((dy + 0.5) * p.srcHeight / p.dstHeight) / (1 << shiftY) - 0.5;
+    px = std::min(std::max(px, 0.0), (double)(sw - 1));
+    py = std::min(std::max(py, 0.0), (double)(sh - 1));
+
+    const int x0 = (int)px, y0 = (int)py;
+    const int x1 = std::min(x0 + 1, sw - 1), y1 = std::min(y0 + 1, sh - 1);
+    const double wx = px - x0, wy = py - y0;
+
+    const double top    = fetch(src, p, k, x0, y0) * (1 - wx) + fetch(src, p, k, x1, y0) * wx;
+    const double bottom = fetch(src, p, k, x0, y1) * (1 - wx) + fetch(src, p, k, x1, y1) * wx;
+    return top * (1 - wy) + bottom * wy;
+}
+
+static void reference(const std::vector<uint8_t>& src, const PreprocessParams& p, std::vector<double>& out)
+{
+    out.resize(p.dstWidth * p.dstHeight * 3);
+
+    for(size_t y = 0; y < p.dstHeight; y++) {
+        for(size_t x = 0; x < p.dstWidth; x++) {
+            const double c0 = sample(src, p, 0, x, y);
+            const double c1 = sample(src, p, 1, x, y);
+            const double c2 = sample(src, p, 2, x, y);
+            double rgb[3];
+
+            if(p.format == PIXEL_RGB || p.format == PIXEL_BGR) {
+                rgb[0] = c0; rgb[1] = c1; rgb[2] = c2;
+            } else {
+                // E'Y and E'Pb / E'Pr of the colour space, back to R'G'B'
+                const double kr = (p.colour.matrix == COLOUR_BT709) ? 0.2126 : (p.colour.matrix == COLOUR_BT2020) ? 0.2627 : 0.299;
+                const double kb = (p.colour.matrix == COLOUR_BT709) ? 0.0722 : (p.colour.matrix == COLOUR_BT2020) ? 0.0593 : 0.114;
+                const bool full = (p.colour.range == COLOUR_RANGE_FULL);
+                const double l  = (c0 - (full ? 0.0 : 16.0)) / (full ? 255.0 : 219.0);
+                const double pb = (c1 - 128.0) / (full ? 255.0 : 224.0);
+                const double pr = (c2 - 128.0) / (full ? 255.0 : 224.0);
+
+                rgb[0] = l + 2.0 * (1.0 - kr) * pr;
+                rgb[2] = l + 2.0 * (1.0 - kb) * pb;
+                rgb[1] = (l - kr * rgb[0] - kb * rgb[2]) / (1.0 - kr - kb);
+                for(int j = 0; j < 3; j++) {
+                    rgb[j] = std::min(std::max(rgb[j] * 255.0, 0.0), 255.0);
+                }
+            }
+
+            for(int c = 0; c < 3; c++) {
+                double v = (rgb[p.bgr ? 2 - c : c] - p.mean[c]) * p.scale[c];
+                if(p.output == TENSOR_INT8) {
+                    v = std::min(std::max(std::nearbyint(v / p.int8Scale), -128.0), 127.0);
+                }
+                out[(c * p.dstHeight + y) * p.dstWidth + x] = v;
+            }
+        }
+    }
+}
+
+static bool check(PixelFormat format, size_t sw, size_t sh, size_t dw, size_t dh, TensorType type, bool bgr,
+                  const ColourSpace& colour = ColourSpace())
+{
+    PreprocessParams p;
+    p.format = format;
+    p.colour = colour;
+    p.srcWidth = sw;  p.srcHeight = sh;
+    p.dstWidth = dw;  p.dstHeight = dh;
+    p.bgr = bgr;
+    p.output = type;
+    for(int c = 0; c < 3; c++) {
+        p.mean[c]  = 100.0f + 10.0f * c;
+        p.scale[c] = 1.0f / (50.0f + c);
+    }
+    p.int8Scale = 1.0f / 64.0f;
+
+    std::vector<uint8_t> src(sw * sh * 3);
+    for(size_t i = 0; i < src.size(); i++) {
+        src[i] = (uint8_t)(rand() & 0xFF);
+    }
+
+    Preprocessor pre(p);
+    std::vector<uint8_t> out(pre.GetOutputSize());
+    std::vector<double> ref;
+
+    if(!pre.Process(src.data(), out.data())) {
+        printf("%-4s process failed\n", formatName(format));
+        return false;
+    }
+    reference(src, p, ref);
+
+    // float tolerance is relative to the normalized range, int8 may round either way at .5
+    const double tolerance = (type == TENSOR_INT8) ? 1.0 : 1e-3;
+    double worst = 0.0;
+
+    for(size_t i = 0; i < ref.size(); i++) {
+        const double v = (type == TENSOR_INT8) ? (double)((int8_t*)out.data())[i] : (double)((float*)out.data())[i];
+        worst = std::max(worst, fabs(v - ref[i]));
+    }
+
+    const bool ok = worst <= tolerance;
+    printf("%-4s %4zux%-4zu -> %4zux%-4zu %s%s max diff %g  %s\n", formatName(format), sw, sh, dw, dh,
+           type == TENSOR_INT8 ? "int8 " : "float", bgr ? " bgr" : "    ", worst, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+int main(int argc, char const *argv[])
+{
+    const PixelFormat formats[] = { PIXEL_NV12, PIXEL_UYVY, PIXEL_YUYV, PIXEL_RGB, PIXEL_BGR };
+    bool ok = true;
+
+    srand(1234);
+
+    for(PixelFormat format : formats) {
+        ok &= check(format, 640, 480, 300, 300, TENSOR_FLOAT32, false);
+        ok &= check(format, 64, 36, 101, 57, TENSOR_FLOAT32, true);     // upscale, odd output width
+        ok &= check(format, 640, 480, 224, 224, TENSOR_INT8, true);
+    }
+
+    ColourSpace hd;
+    hd.matrix = COLOUR_BT709;
+    hd.range = COLOUR_RANGE_FULL;
+    ok &= check(PIXEL_NV12, 64, 36, 101, 57, TENSOR_FLOAT32, false, hd);
+    ok &= check(PIXEL_UYVY, 64, 36, 101, 57, TENSOR_FLOAT32, true, hd);
+
+    // fused stage against convert + resize + normalize as separate passes
+    const size_t sw = 1920, sh = 1080, dw = 640, dh = 368;
+    std::vector<uint8_t> src(sw * sh * 2, 128);
+    ConvertBackend* backend = GetCpuConvertBackend();
+    float* rgba = (float*)backend->Alloc(sw * sh * 4 * sizeof(float));
+    std::vector<float> resized(dw * dh * 4);
+    std::vector<float> tensor(dw * dh * 3);
+    const int iterations = 10;
+
+    double start = mtsai::utils::cpuSecond();
+    for(int i = 0; i < iterations; i++) {
+        backend->NV12toRGBAf(src.data(), rgba, sw, sh);
+        for(size_t y = 0; y < dh; y++) {
+            for(size_t x = 0; x < dw; x++) {
+                const float* px = rgba + ((y * sh / dh) * sw + (x * sw / dw)) * 4;
+                for(int c = 0; c < 4; c++) {
+                    resized[(y * dw + x) * 4 + c] = px[c];
+                }
+            }
+        }
+        for(size_t n = 0; n < dw * dh; n++) {
+            for(int c = 0; c < 3; c++) {
+                tensor[c * dw * dh + n] = resized[n * 4 + c] * (1.0f / 255.0f);
+            }
+        }
+    }
+    printf("separate passes NV12 1080p -> %zux%zu: %.2f ms\n", dw, dh, (mtsai::utils::cpuSecond() - start) * 1000.0 / iterations);
+
+    PreprocessParams p;
+    p.format = PIXEL_NV12;
+    p.srcWidth = sw;  p.srcHeight = sh;
+    p.dstWidth = dw;  p.dstHeight = dh;
+    p.scale[0] = p.scale[1] = p.scale[2] = 1.0f / 255.0f;
+    Preprocessor pre(p);
+
+    start = mtsai::utils::cpuSecond();
+    for(int i = 0; i < iterations; i++) {
+        pre.Process(src.data(), tensor.data());
+    }
+    printf("fused           NV12 1080p -> %zux%zu: %.2f ms\n", dw, dh, (mtsai::utils::cpuSecond() - start) * 1000.0 / iterations);
+
+    backend->Free(rgba);
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,234 @@
+/*
+ * Checks the bilinear / area resize against direct double precision
+ * filtering, and times it against nearest-neighbour sampling
+ */
+#include "image/resize.h"
+#include "utils/mt_utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace mtsai::image;
+
+// weight of source pixel k for output index i along one axis
+static double weight(ResizeMode mode, size_t srcSize, size_t dstSize, size_t i, int k)
+{
+    const double scale = (double)srcSize / dstSize;
+
+    if(mode == RESIZE_AREA && srcSize > dstSize) {
+        const double x0 = i * scale, x1 = x0 + scale;
+        const double cover = std::min(x1, k + 1.0) - std::max(x0, (double)k);
+        return cover > 0.0 ? cover / scale : 0.0;
+    }
+
+    double pos = (i + 0.5) * scale - 0.5;
+    pos = std::min(std::max(pos, 0.0), (double)(srcSize - 1));
+    const int i0 = (int)pos;
+    const double w = pos - i0;
+    return (k == i0) ? 1.0 - w : (k == i0 + 1) ? w : 0.0;
+}
+
+static void reference(const std::vector<double>& src, size_t sw, size_t sh, int channels, const Rect& roi,
+                      std::vector<double>& dst, size_t dw, size_t dh, ResizeMode mode)
+{
+    dst.assign(dw * dh * channels, 0.0);
+
+    for(size_t y = 0; y < dh; y++) {
+        for(int ky = 0; ky < roi.height; ky++) {
+            const double wy = weight(mode, roi.height, dh, y, ky);
+            if(wy == 0.0) continue;
+
+            for(size_t x = 0; x < dw; x++) {
+                for(int kx = 0; kx < roi.width; kx++) {
+                    const double wx = weight(mode, roi.width, dw, x, kx);
+                    if(wx == 0.0) continue;
+
+                    for(int c = 0; c < channels; c++) {
+                        dst[(y * dw + x) * channels + c] +=
+                            wx * wy * src[((roi.y + ky) * sw + roi.x + kx) * channels + c];
+                    }
+                }
+            }
+        }
+    }
+}
+
+static bool check(ResizeFormat format, int channels, bool isFloat, size_t sw, size_t sh,
+                  const Rect& roi, size_t dw, size_t dh, ResizeMode mode, Resizer& resizer)
+{
+    std::vector<double> values(sw * sh * channels);
+    std::vector<uint8_t> src8(values.size());
+    std::vector<float> srcF(values.size());
+
+    for(size_t i = 0; i < values.size(); i++) {
+        src8[i] = (uint8_t)(rand() & 0xFF);
+        srcF[i] = src8[i] * 0.5f;
+        values[i] = isFloat ? srcF[i] : src8[i];
+    }
+
+    ImageView src, dst;
+    src.data = isFloat ? (void*)srcF.data() : (void*)src8.data();
+    src.width = sw;
+    src.height = sh;
+
+    std::vector<uint8_t> out8(dw * dh * channels);
+    std::vector<float> outF(dw * dh * channels);
+    dst.data = isFloat ? (void*)outF.data() : (void*)out8.data();
+    dst.width = dw;
+    dst.height = dh;
+
+    if(!resizer.ResizeROI(src, roi, dst, format, mode)) {
+        printf("resize failed\n");
+        return false;
+    }
+
+    std::vector<double> ref;
+    reference(values, sw, sh, channels, roi, ref, dw, dh, mode);
+
+    double worst = 0.0;
+    for(size_t i = 0; i < ref.size(); i++) {
+        const double v = isFloat ? outF[i] : out8[i];
+        const double r = isFloat ? ref[i] : std::min(std::max(ref[i], 0.0), 255.0);
+        worst = std::max(worst, fabs(v - r));
+    }
+
+    // uint8 may round either way when the float sum lands near .5
+    const bool ok = worst <= (isFloat ? 1e-3 : 0.51);
+    printf("%-8s c%d %s %4zux%-4zu roi(%d,%d %dx%d) -> %4zux%-4zu max diff %g  %s\n",
+           mode == RESIZE_AREA ? "area" : "bilinear", channels, isFloat ? "f32" : "u8 ",
+           sw, sh, roi.x, roi.y, roi.width, roi.height, dw, dh, worst, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+static Rect fullRect(size_t w, size_t h)
+{
+    Rect r;
+    r.width = (int)w;
+    r.height = (int)h;
+    return r;
+}
+
+int main(int argc, char const *argv[])
+{
+    Resizer resizer;
+    bool ok = true;
+
+    srand(1234);
+
+    const ResizeMode modes[] = { RESIZE_BILINEAR, RESIZE_AREA };
+    for(ResizeMode mode : modes) {
+        ok &= check(RESIZE_GRAY8, 1, false, 97, 61, fullRect(97, 61), 31, 17, mode, resizer);
+        ok &= check(RESIZE_RGB8,  3, false, 97, 61, fullRect(97, 61), 40, 30, mode, resizer);
+        ok &= check(RESIZE_RGBA8, 4, false, 64, 48, fullRect(64, 48), 101, 77, mode, resizer);
+        ok &= check(RESIZE_RGBA8, 4, false, 160, 120, fullRect(160, 120), 37, 23, mode, resizer);
+        ok &= check(RESIZE_GRAYF, 1, true,  80, 60, fullRect(80, 60), 33, 21, mode, resizer);
+        ok &= check(RESIZE_RGBAF, 4, true,  80, 60, fullRect(80, 60), 19, 45, mode, resizer);
+
+        Rect roi;
+        roi.x = 13; roi.y = 7; roi.width = 50; roi.height = 40;
+        ok &= check(RESIZE_RGB8, 3, false, 97, 61, roi, 24, 24, mode, resizer);
+        ok &= check(RESIZE_RGBAF, 4, true, 97, 61, roi, 64, 64, mode, resizer);
+    }
+
+    // identity must be an exact copy
+    {
+        std::vector<uint8_t> src(33 * 9 * 3), out(src.size());
+        for(size_t i = 0; i < src.size(); i++) src[i] = (uint8_t)(rand() & 0xFF);
+
+        ImageView s, d;
+        s.data = src.data(); s.width = 33; s.height = 9;
+        d.data = out.data(); d.width = 33; d.height = 9;
+        resizer.Resize(s, d, RESIZE_RGB8);
+
+        const bool same = (src == out);
+        printf("identity copy  %s\n", same ? "ok" : "FAILED");
+        ok &= same;
+    }
+
+    // NV12, both planes follow the luma/chroma reference
+    {
+        const size_t sw = 64, sh = 48, dw = 24, dh = 18;
+        std::vector<uint8_t> src(sw * sh * 3 / 2), out(dw * dh * 3 / 2);
+        for(size_t i = 0; i < src.size(); i++) src[i] = (uint8_t)(rand() & 0xFF);
+
+        ImageView s, d;
+        s.data = src.data(); s.width = sw; s.height = sh;
+        d.data = out.data(); d.width = dw; d.height = dh;
+        resizer.Resize(s, d, RESIZE_NV12, RESIZE_AREA);
+
+        std::vector<double> luma(src.begin(), src.begin() + sw * sh), chroma(src.begin() + sw * sh, src.end());
+        std::vector<double> refY, refC;
+        reference(luma, sw, sh, 1, fullRect(sw, sh), refY, dw, dh, RESIZE_AREA);
+        reference(chroma, sw / 2, sh / 2, 2, fullRect(sw / 2, sh / 2), refC, dw / 2, dh / 2, RESIZE_AREA);
+
+        double worst = 0.0;
+        for(size_t i = 0; i < refY.size(); i++) worst = std::max(worst, fabs(out[i] - refY[i]));
+        for(size_t i = 0; i < refC.size(); i++) worst = std::max(worst, fabs(out[dw * dh + i] - refC[i]));
+
+        printf("NV12 area      max diff %g  %s\n", worst, worst <= 0.51 ? "ok" : "FAILED");
+        ok &= worst <= 0.51;
+    }
+
+    // batch of detections, one coefficient table per distinct size
+    {
+        std::vector<uint8_t> src(640 * 480 * 4);
+        std::vector<std::vector<uint8_t>> crops(8, std::vector<uint8_t>(64 * 64 * 4));
+        std::vector<Rect> rois;
+        std::vector<ImageView> dsts;
+
+        for(int i = 0; i < 8; i++) {
+            Rect r;
+            r.x = i * 40; r.y = i * 20; r.width = 120; r.height = 200;
+            rois.push_back(r);
+
+            ImageView d;
+            d.data = crops[i].data(); d.width = 64; d.height = 64;
+            dsts.push_back(d);
+        }
+
+        ImageView s;
+        s.data = src.data(); s.width = 640; s.height = 480;
+
+        resizer.ClearCache();
+        const bool batch = resizer.ResizeBatch(s, rois, dsts, RESIZE_RGBA8);
+        printf("batch of 8 crops, %zu cached tables  %s\n", resizer.GetCacheSize(),
+               batch && resizer.GetCacheSize() == 2 ? "ok" : "FAILED");
+        ok &= batch && resizer.GetCacheSize() == 2;
+    }
+
+    // 4K RGBA -> detector input
+    {
+        const size_t sw = 3840, sh = 2160, dw = 640, dh = 360;
+        std::vector<uint8_t> src(sw * sh * 4, 128), out(dw * dh * 4);
+        ImageView s, d;
+        s.data = src.data(); s.width = sw; s.height = sh;
+        d.data = out.data(); d.width = dw; d.height = dh;
+        const int iterations = 5;
+
+        double start = mtsai::utils::cpuSecond();
+        for(int i = 0; i < iterations; i++) {
+            for(size_t y = 0; y < dh; y++) {
+                for(size_t x = 0; x < dw; x++) {
+                    memcpy(&out[(y * dw + x) * 4], &src[((y * sh / dh) * sw + x * sw / dw) * 4], 4);
+                }
+            }
+        }
+        printf("nearest  4K -> %zux%zu: %.2f ms\n", dw, dh, (mtsai::utils::cpuSecond() - start) * 1000.0 / iterations);
+
+        for(ResizeMode mode : modes) {
+            start = mtsai::utils::cpuSecond();
+            for(int i = 0; i < iterations; i++) {
+                resizer.Resize(s, d, RESIZE_RGBA8, mode);
+            }
+            printf("%-8s 4K -> %zux%zu: %.2f ms\n", mode == RESIZE_AREA ? "area" : "bilinear",
+                   dw, dh, (mtsai::utils::cpuSecond() - start) * 1000.0 / iterations);
+        }
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,171 @@
+/*
+ * Checks the CPU text overlay against blending the atlas glyphs directly,
+ * the per digit cache refresh, and times cached against uncached strings
+ */
+#include "image/text.h"
+#include "utils/mt_utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace mtsai::image;
+
+template<typename T>
+static void reference(T* image, int width, int height, const std::string& text, int x, int y,
+                      const PixelRGBA8& color, int scale)
+{
+    const uint8_t rgb[3] = { color.r, color.g, color.b };
+
+    for(size_t n = 0; n < text.size(); n++) {
+        const uint8_t* glyph = TextOverlay::GetGlyph(text[n]);
+        if(!glyph) continue;
+
+        for(int gy = 0; gy < 16 * scale; gy++) {
+            for(int gx = 0; gx < 8 * scale; gx++) {
+                const int px = x + (int)n * 8 * scale + gx, py = y + gy;
+                if(px < 0 || py < 0 || px >= width || py >= height) continue;
+
+                const uint32_t cov = glyph[(gy / scale) * 8 + gx / scale];
+                if(!cov) continue;
+
+                T* p = image + (py * width + px) * 4;
+                for(int c = 0; c < 3; c++) {
+                    if(sizeof(T) == 1) {
+                        const uint32_t a = (cov * color.a + 127) / 255;
+                        p[c] = (T)((p[c] * (255 - a) + rgb[c] * a + 127) / 255);
+                    } else {
+                        const float a = cov * (color.a / (255.0f * 255.0f));
+                        p[c] = p[c] * (1.0f - a) + rgb[c] * a;
+                    }
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+static bool check(PixelType type, int width, int height, int scale, const PixelRGBA8& color)
+{
+    TextOverlay text(scale);
+    std::vector<T> image(width * height * 4), expect;
+
+    for(size_t i = 0; i < image.size(); i++) {
+        image[i] = (T)(rand() & 0xFF);
+    }
+    expect = image;
+
+    ImageView view;
+    view.data = image.data();
+    view.width = width;
+    view.height = height;
+
+    // one string hangs off the left, one off the bottom right
+    const std::string a = "cam-03 | 2024-05-17 12:34:56.789";
+    const std::string b = "{[gjpqy]} ~!@#$%^&*()_+";
+
+    text.Add(a, 3, 5, color);
+    text.Add(b, -11, height / 2, color);
+    text.Add(b, width - 60, height - 9, color);
+    const bool drawn = text.Render(view, type);
+
+    reference(expect.data(), width, height, a, 3, 5, color, scale);
+    reference(expect.data(), width, height, b, -11, height / 2, color, scale);
+    reference(expect.data(), width, height, b, width - 60, height - 9, color, scale);
+
+    double worst = 0.0;
+    for(size_t i = 0; i < image.size(); i++) {
+        worst = std::max(worst, fabs((double)image[i] - (double)expect[i]));
+    }
+
+    const bool ok = drawn && worst <= (sizeof(T) == 1 ? 0.0 : 1e-3);
+    printf("text %s scale %d opacity %3u  max diff %g  %s\n", sizeof(T) == 1 ? "u8 " : "f32",
+           scale, color.a, worst, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+int main(int argc, char const *argv[])
+{
+    bool ok = true;
+
+    srand(99);
+
+    ok &= check<uint8_t>(PIXEL_TYPE_RGBA8, 320, 120, 1, PixelRGBA8{255, 255, 0, 255});
+    ok &= check<uint8_t>(PIXEL_TYPE_RGBA8, 320, 120, 1, PixelRGBA8{10, 200, 90, 160});
+    ok &= check<uint8_t>(PIXEL_TYPE_RGBA8, 501, 77, 2, PixelRGBA8{255, 255, 255, 255});
+    ok &= check<float>(PIXEL_TYPE_RGBAF, 320, 120, 1, PixelRGBA8{255, 255, 0, 200});
+    ok &= check<float>(PIXEL_TYPE_RGBAF, 501, 77, 3, PixelRGBA8{0, 0, 255, 255});
+
+    // a ticking clock only rasterises the digits that changed
+    {
+        TextOverlay text;
+        std::vector<uint8_t> image(640 * 480 * 4);
+        ImageView view;
+        view.data = image.data();
+        view.width = 640;
+        view.height = 480;
+
+        const PixelRGBA8 white = {255, 255, 255, 255};
+        text.Draw(view, PIXEL_TYPE_RGBA8, "2024-05-17 12:34:56", 10, 10, white);
+        const size_t first = text.GetGlyphsRasterised();
+
+        text.Draw(view, PIXEL_TYPE_RGBA8, "2024-05-17 12:34:56", 10, 10, white);
+        const size_t same = text.GetGlyphsRasterised() - first;
+
+        text.Draw(view, PIXEL_TYPE_RGBA8, "2024-05-17 12:34:57", 10, 10, white);
+        const size_t tick = text.GetGlyphsRasterised() - first;
+
+        text.Draw(view, PIXEL_TYPE_RGBA8, "2024-05-17 12:35:00", 10, 10, white);
+        const size_t carry = text.GetGlyphsRasterised() - first - tick;
+
+        const bool cached = (first == 19 && same == 0 && tick == 1 && carry == 3);
+        printf("clock tick rasterised %zu / %zu / %zu / %zu glyphs  %s\n", first, same, tick, carry,
+               cached ? "ok" : "FAILED");
+        ok &= cached;
+
+        // strings not drawn any more leave the cache
+        for(int i = 0; i < TextOverlay::kCacheFrames; i++) {
+            text.Draw(view, PIXEL_TYPE_RGBA8, "cam-01", 10, 40, white);
+        }
+        const bool evicted = (text.GetCacheSize() == 1);
+        printf("stale strings evicted, %zu cached  %s\n", text.GetCacheSize(), evicted ? "ok" : "FAILED");
+        ok &= evicted;
+    }
+
+    // 1080p, 16 camera labels and clocks per frame
+    {
+        const int width = 1920, height = 1080, iterations = 50;
+        std::vector<uint8_t> image(width * height * 4, 80);
+        ImageView view;
+        view.data = image.data();
+        view.width = width;
+        view.height = height;
+
+        TextOverlay text(2);
+        const PixelRGBA8 white = {255, 255, 255, 255};
+        char clock[64];
+
+        for(int cached = 0; cached < 2; cached++) {
+            const double start = mtsai::utils::cpuSecond();
+
+            for(int i = 0; i < iterations; i++) {
+                for(int cam = 0; cam < 16; cam++) {
+                    snprintf(clock, sizeof(clock), "cam-%02d 2024-05-17 12:34:%02d.%03d", cam, i / 30, (i * 33) % 1000);
+                    text.Add(clock, (cam % 4) * 480, (cam / 4) * 270, white);
+                }
+                text.Render(view, PIXEL_TYPE_RGBA8);
+
+                if(!cached) {
+                    text.ClearCache();
+                }
+            }
+            printf("%-8s 16 strings per frame: %.3f ms\n", cached ? "cached" : "uncached",
+                   (mtsai::utils::cpuSecond() - start) * 1000.0 / iterations);
+        }
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? 0 : 1;
+}